@@ -27,6 +27,7 @@
 #include "Application.h"
 #include "GrblComm.h"
 #include "Tetris.h"
+#include "GraphDemo.h"
 
 // Hardware
 #include "tim.h"
@@ -95,6 +96,11 @@ extern "C" void AppMain(void)
     // If left up button pressed - run Tetris
     Tetris::GetInstance().InitTask();
   }
+  else if(btn_ld.IsLow())
+  {
+    // If left down button pressed - run graphics benchmark
+    GraphDemo::GetInstance().InitTask();
+  }
   else
   {
     // Init GRBL Communication task
@@ -20,6 +20,13 @@
 // *****************************************************************************
 #include "Application.h"
 
+#if defined(JOG_TRACE_ENABLED) // For sending jog latency report to USB
+#if defined(SEND_DATA_TO_USB)
+  #error "JOG_TRACE_ENABLED and SEND_DATA_TO_USB use the same USB CDC"
+#endif
+#include "usbd_cdc_if.h"
+#endif
+
 // *****************************************************************************
 // ***   Public: Get Instance   ************************************************
 // *****************************************************************************
@@ -43,6 +50,15 @@ Result Application::Setup()
   display_drv.SetRotation((IDisplay::Rotation)rotation);
   // Set display background color
   display_drv.SetBackgroundColor(COLOR_DARKGREY);
+  // Setup dirty regions before any object invalidate itself
+  DirtyRegions::GetInstance().Setup();
+  // Setup performance overlay under the header
+  PerfHud::GetInstance().Setup(0, 40);
+#if defined(JOG_TRACE_ENABLED)
+  // Jog latency trace timestamps are DWT cycles. DWT already enabled by
+  // DirtyRegions.
+  JogTrace::GetInstance().Setup(SystemCoreClock / 1000000u);
+#endif
 
   // Box for status
   status_box.SetParams(0, display_drv.GetScreenH() - Font_8x12::GetInstance().GetCharH() * 3 - Font_12x16::GetInstance().GetCharH() * 2 - 2, display_drv.GetScreenW() - Font_12x16::GetInstance().GetCharW() * 6, Font_12x16::GetInstance().GetCharH() * 2, COLOR_GREY, false);
@@ -69,7 +85,7 @@ Result Application::Setup()
   pins_str.Show(1003u);
 
   // Set callback handler for left and right buttons
-  input_drv.AddButtonsCallbackHandler(this, reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_USR | InputDrv::BTNM_LEFT | InputDrv::BTNM_RIGHT, btn_cble);
+  Result result = input_drv.AddButtonsCallbackHandler(this, reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_USR | InputDrv::BTNM_LEFT | InputDrv::BTNM_RIGHT, btn_cble, InputDrv::PRIORITY_BACKGROUND);
 
   // Set Soft Buttons parameters
   InitSoftButtons();
@@ -108,7 +124,9 @@ Result Application::Setup()
   // Set new page
   header.SetSelectedPage(scr_idx);
   // Show new screen
-  scr[scr_idx]->Show();
+  result |= scr[scr_idx]->Show();
+  // Screen can setup shared objects - update everything
+  grbl_comm.ForceChanges(grbl_changes);
 
   // Auto control request, if enabled
   if(NVM::GetInstance().GetValue(NVM::AUTO_MPG_ON_START))
@@ -116,8 +134,8 @@ Result Application::Setup()
     grbl_comm.GainControl();
   }
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -125,15 +143,36 @@ Result Application::Setup()
 // *****************************************************************************
 Result Application::TimerExpired(uint32_t missed_cnt)
 {
+  // Start frame time measurement
+  DirtyRegions::GetInstance().StartFrame();
+
+  // Data changed since previous tick
+  uint32_t changes = grbl_comm.GetChanges(grbl_changes);
+
   // Update state & status
-  state_str.SetString(grbl_comm.GetCurrentStateName());
-  status_str.SetString(grbl_comm.GetCurrentStatusName());
-  pins_str.SetString(grbl_comm.GetPinsStr(), grbl_comm.IsPinsStrChanged());
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_STATE))
+  {
+    state_str.SetString(grbl_comm.GetCurrentStateName());
+  }
+  // Status set by commands responses as well as by control requests, so check
+  // name itself
+  if(status_name != grbl_comm.GetCurrentStatusName())
+  {
+    status_name = grbl_comm.GetCurrentStatusName();
+    status_str.SetString(status_name);
+  }
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_PINS))
+  {
+    pins_str.SetString(grbl_comm.GetPinsStr(), grbl_comm.IsPinsStrChanged());
+  }
 
   // Update numbers with current position and position difference
-  for(uint32_t i = 0u; i < NumberOf(dw_real); i++)
+  if(changes & (GrblComm::ChangeMask(GrblComm::CHG_POS) | GrblComm::ChangeMask(GrblComm::CHG_XMODE)))
   {
-    dw_real[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    for(uint32_t i = 0u; i < NumberOf(dw_real); i++)
+    {
+      dw_real[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    }
   }
 
   // MPG button always reflect MPG request from GrblComm
@@ -177,13 +216,20 @@ Result Application::TimerExpired(uint32_t missed_cnt)
     scr_idx = 0u;
     // Show first screen
     scr[scr_idx]->Show();
+    // Screen can setup shared objects - update everything
+    grbl_comm.ForceChanges(grbl_changes);
   }
 
   // Call timer callback for current screen
   scr[scr_idx]->TimerExpired(TASK_TIMER_PERIOD_MS);
 
-  // Update Display
-  display_drv.UpdateDisplay();
+  // Update performance overlay with statistic of the previous frame
+  PerfHud::GetInstance().Process(TASK_TIMER_PERIOD_MS);
+  // Send jog latency report
+  ProcessJogTrace(TASK_TIMER_PERIOD_MS);
+  // Invalidate dirty regions that fit into the frame pixel budget and update
+  // display
+  DirtyRegions::GetInstance().EndFrame();
 
   // Return ok - we don't check semaphore give error, because we don't need to.
   return Result::RESULT_OK;
@@ -401,6 +447,8 @@ void Application::ChangeScreen(IScreen& screen)
       header.SetSelectedPage(scr_idx);
       // Show new screen
       scr[scr_idx]->Show();
+      // Screen can setup shared objects - update everything
+      grbl_comm.ForceChanges(grbl_changes);
       // Break the cycle
       break;
     }
@@ -491,6 +539,29 @@ void Application::ChangeScreen(uint8_t scrn)
   header.SetSelectedPage(scr_idx);
   // Show new screen
   scr[scr_idx]->Show();
+  // Screen can setup shared objects - update everything
+  grbl_comm.ForceChanges(grbl_changes);
+}
+
+// *****************************************************************************
+// ***   Private: ProcessJogTrace function   ***********************************
+// *****************************************************************************
+void Application::ProcessJogTrace(uint32_t interval)
+{
+#if defined(JOG_TRACE_ENABLED)
+  jog_trace_ms += interval;
+  // Report only if there are new traces
+  if((jog_trace_ms >= JOG_TRACE_REPORT_MS) && (JogTrace::GetInstance().GetCount() != jog_trace_cnt))
+  {
+    jog_trace_ms = 0u;
+    jog_trace_cnt = JogTrace::GetInstance().GetCount();
+    uint32_t len = JogTrace::GetInstance().Report(jog_trace_buf, NumberOf(jog_trace_buf));
+    // Previous transfer is done long ago, if USB isn't connected report is lost
+    CDC_Transmit_FS((uint8_t*)jog_trace_buf, len);
+  }
+#else
+  (void)interval;
+#endif
 }
 
 // *****************************************************************************
@@ -40,6 +40,7 @@
 #include "ProbeScr.h"
 #include "GCodeGeneratorScr.h"
 #include "SettingsScr.h"
+#include "JogTrace.h"
 
 // *****************************************************************************
 // ***   Local const variables   ***********************************************
@@ -198,27 +199,31 @@ class Application : public AppTask
     Header header;
 
     // MPG button
-    UiButton mpg_btn;
+    Dirty<UiButton> mpg_btn;
 
     // Status objects
-    Box status_box;
-    String state_str;
-    String status_str;
-    String pins_str;
+    Dirty<Box> status_box;
+    Dirty<String> state_str;
+    Dirty<String> status_str;
+    Dirty<String> pins_str;
+    // Status name shown in status string
+    const char* status_name = nullptr;
+    // GrblComm change counters to update only changed data
+    uint32_t grbl_changes[GrblComm::CHG_CNT] = {0u};
 
     // Data windows to show real position
     DataWindow dw_real[GrblComm::AXIS_CNT];
     // String for caption
-    String dw_real_name[NumberOf(dw_real)];
+    Dirty<String> dw_real_name[NumberOf(dw_real)];
 
     // Memory info
-    String mem_info;
+    Dirty<String> mem_info;
     char mem_info_buf[32u];
 
     // Soft Buttons
-    UiButton left_btn;
-    UiButton middle_btn;
-    UiButton right_btn;
+    Dirty<UiButton> left_btn;
+    Dirty<UiButton> middle_btn;
+    Dirty<UiButton> right_btn;
 
     // Message box to display errors and other info
     MsgBox msg_box;
@@ -259,6 +264,15 @@ class Application : public AppTask
     // Button callback entry
     InputDrv::CallbackListEntry btn_cble;
 
+#if defined(JOG_TRACE_ENABLED)
+    // Time since last jog latency report
+    uint32_t jog_trace_ms = 0u;
+    // Number of traces in last report
+    uint32_t jog_trace_cnt = 0u;
+    // Report buffer, have to be valid until USB transfer is done
+    char jog_trace_buf[512u] = {0};
+#endif
+
     // *************************************************************************
     // ***   Private: ProcessButtonCallback function   *************************
     // *************************************************************************
@@ -274,6 +288,11 @@ class Application : public AppTask
     // *************************************************************************
     void InitHeader();
 
+    // *************************************************************************
+    // ***   Private: ProcessJogTrace function   *******************************
+    // *************************************************************************
+    void ProcessJogTrace(uint32_t interval);
+
     // *************************************************************************
     // ***   Private constructor   *********************************************
     // *************************************************************************
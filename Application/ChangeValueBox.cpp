@@ -172,12 +172,12 @@ Result ChangeValueBox::Show(uint32_t z)
   right_btn.Show(z+3);
 
   // Set encoder callback handler
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_MODAL);
   // Set callback handler for all buttons
-  InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_ALL, btn_cble);
+  result |= InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_ALL, btn_cble, InputDrv::PRIORITY_MODAL);
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
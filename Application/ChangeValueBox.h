@@ -114,28 +114,28 @@ class ChangeValueBox
     int32_t items_cnt = 0u;
 
     // List that contains all menu elements
-    VisList list;
+    Dirty<VisList> list;
 
     // Box around
-    Box box;
+    Dirty<Box> box;
     // Box around
-    ShadowBox shadowbox;
+    Dirty<ShadowBox> shadowbox;
 
     // String for caption
-    String value_name;
+    Dirty<String> value_name;
     // Data windows to show value
     DataWindow value_dw;
 
     // Buttons to choose scale
-    UiButton scale_btn[3u];
+    Dirty<UiButton> scale_btn[3u];
     // Scale options(value)
     const uint32_t scale_val[NumberOf(scale_btn)] = {1, 10, 100};
     // Scale options(string)
     char scale_str[NumberOf(scale_btn)][16u] = {"", "", ""};
 
     // Soft Buttons
-    UiButton left_btn;
-    UiButton right_btn;
+    Dirty<UiButton> left_btn;
+    Dirty<UiButton> right_btn;
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
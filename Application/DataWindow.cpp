@@ -52,11 +52,11 @@ void DataWindow::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
   // Create format string
   if(ths)
   {
-    snprintf(format_str_buf, NumberOf(format_str_buf), "%%%luld.%%0%lulu", before_decimal, after_decimal);
+    snprintf(format_str_buf, NumberOf(format_str_buf), "%%%luld.%%0%lulu", (unsigned long)before_decimal, (unsigned long)after_decimal);
   }
   else
   {
-    snprintf(format_str_buf, NumberOf(format_str_buf), "%%%luld", before_decimal);
+    snprintf(format_str_buf, NumberOf(format_str_buf), "%%%luld", (unsigned long)before_decimal);
   }
 
   // Add one to account for '.'
@@ -74,7 +74,10 @@ void DataWindow::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
   // Set box parameters
   box.SetParams(0, 0, w, h, COLOR_BLACK, true);
   // Set data string parameters
-  data_str.SetParams(data_str_buf, 0, 0, COLOR_WHITE, Font_8x12::GetInstance());
+  data_str.SetParams(data_str_buf, 0, 0, DATA_COLOR, Font_8x12::GetInstance());
+  // Default font is small, so it isn't cached
+  data_font = nullptr;
+  data_scale = 1u;
   // Data string length: sign, before decimal digits, '.' if we have decimal, after decimal digits
   uint8_t data_str_len = 1u + before_decimal + (after_decimal != 0u ? 1u : 0u) + after_decimal;
   data_str.Move((width - data_str.GetFontW() * data_str_len) / 2u, (h - data_str.GetHeight()) / 2, false);
@@ -94,6 +97,9 @@ void DataWindow::SetDataFont(Font& font, uint32_t scale)
   data_str.SetFont(font);
   // Set scale
   data_str.SetScale(scale);
+  // Save font and scale to draw data from glyph cache if glyphs fit into it
+  data_font = GlyphCache::IsCacheable(font, scale) ? &font : nullptr;
+  data_scale = scale;
   // Update data and units strings positions
   UpdateStringPositions();
   // Invalidate area
@@ -186,16 +192,19 @@ bool DataWindow::SetNumber(int32_t n)
   // If data has changed
   if(n != data)
   {
+    // Save previous string to find changed characters
+    char prev_str_buf[NumberOf(data_str_buf)];
+    memcpy(prev_str_buf, data_str_buf, sizeof(prev_str_buf));
     // Save new value
     data = n;
     // Update string
     if(after_decimal == 0)
     {
-      data_str.SetString(data_str_buf, NumberOf(data_str_buf), format_str_buf, data);
+      data_str.SetString(data_str_buf, NumberOf(data_str_buf), format_str_buf, (long)data);
     }
     else
     {
-      data_str.SetString(data_str_buf, NumberOf(data_str_buf), format_str_buf, data / decimal_multiplier, abs(data % decimal_multiplier));
+      data_str.SetString(data_str_buf, NumberOf(data_str_buf), format_str_buf, (long)(data / decimal_multiplier), (unsigned long)abs(data % decimal_multiplier));
       // If n less than 0, but will give 0 in first part - we have to handle
       // sign differently. Check field width to prevent out of bound access
       // for windows with less than two integer digits.
@@ -204,8 +213,8 @@ bool DataWindow::SetNumber(int32_t n)
         data_str_buf[before_decimal - 2] = '-';
       }
     }
-    // Invalidate area
-    InvalidateObjArea();
+    // Invalidate only characters that changed
+    InvalidateChangedChars(prev_str_buf);
     // Data has changed - set flag
     chganged = true;
   }
@@ -218,8 +227,50 @@ bool DataWindow::SetNumber(int32_t n)
 // *****************************************************************************
 void DataWindow::SetString(const char* str)
 {
-  data_str.SetString(data_str_buf, NumberOf(data_str_buf), "%s", str);
-  data_str.Move((width - data_str.GetWidth()) / 2u, (height - data_str.GetHeight()) / 2, false);
+  // Update object only if there is a change - prevent invalidation of region
+  // that doesn't need it
+  if(strncmp(data_str_buf, str, NumberOf(data_str_buf) - 1u) != 0)
+  {
+    data_str.SetString(data_str_buf, NumberOf(data_str_buf), "%s", str);
+    data_str.Move((width - data_str.GetWidth()) / 2u, (height - data_str.GetHeight()) / 2, false);
+    // Invalidate area
+    InvalidateObjArea();
+  }
+}
+
+// *****************************************************************************
+// ***   InvalidateChangedChars   **********************************************
+// *****************************************************************************
+void DataWindow::InvalidateChangedChars(const char* prev_str)
+{
+  int32_t first = -1;
+  int32_t last = -1;
+  // Find first and last changed characters. Strings can have different length,
+  // so compare until end of both strings.
+  for(int32_t i = 0; (i < (int32_t)NumberOf(data_str_buf)) && ((data_str_buf[i] != '\0') || (prev_str[i] != '\0')); i++)
+  {
+    if(data_str_buf[i] != prev_str[i])
+    {
+      if(first < 0) first = i;
+      last = i;
+    }
+    // Stop at the end of the shorter string: all characters after it changed
+    if((data_str_buf[i] == '\0') || (prev_str[i] == '\0'))
+    {
+      last = (int32_t)((strlen(data_str_buf) > strlen(prev_str)) ? strlen(data_str_buf) : strlen(prev_str)) - 1;
+      break;
+    }
+  }
+  // If there are changed characters
+  if(first >= 0)
+  {
+    // Width of one character cell
+    int32_t char_w = data_str.GetFontW() * data_str.GetScale();
+    // Invalidate area of changed characters only. Character position doesn't
+    // depend on string content since all strings in DataWindow are monospaced.
+    DirtyRegions::GetInstance().Invalidate(p_list, x_start + data_str.GetStartX() + first * char_w, y_start + data_str.GetStartY(),
+                                           x_start + data_str.GetStartX() + (last + 1) * char_w - 1, y_start + data_str.GetEndY());
+  }
 }
 
 // *****************************************************************************
@@ -296,9 +347,53 @@ void DataWindow::SetCallback(AppTask* task, CallbackPtr func, void* param)
 // *****************************************************************************
 void DataWindow::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
+  PERF_HUD_DRAW_START();
   box.DrawInBufW(buf, n, line - y_start, start_x - x_start);
-  data_str.DrawInBufW(buf, n, line - y_start, start_x - x_start);
+  // Draw data from glyph cache if possible, otherwise use string to draw it
+  if(!DrawDataLine(buf, n, line, start_x)) data_str.DrawInBufW(buf, n, line - y_start, start_x - x_start);
   if(units_str_pos != NONE) units_str.DrawInBufW(buf, n, line - y_start, start_x - x_start);
+  PERF_HUD_DRAW_END("DataWindow");
+}
+
+// *****************************************************************************
+// ***   Private: DrawDataLine   ***********************************************
+// *****************************************************************************
+bool DataWindow::DrawDataLine(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  bool result = false;
+
+  // Only scaled fonts are cached: per pixel scaling is the most expensive part
+  // of string drawing
+  if((data_font != nullptr) && (data_scale > 1u) && GlyphCache::GetInstance().IsEnabled())
+  {
+    result = true;
+    // Line in the data string
+    int32_t str_line = line - y_start - data_str.GetStartY();
+    // Draw only if line belongs to the data string
+    if((str_line >= 0) && (str_line < data_str.GetHeight()))
+    {
+      // Character cell width
+      int32_t char_w = data_str.GetFontW() * data_str.GetScale();
+      // Position of the first character in the buffer
+      int32_t x = x_start + data_str.GetStartX() - start_x;
+      // Draw every character
+      for(uint32_t i = 0u; (i < NumberOf(data_str_buf)) && (data_str_buf[i] != '\0') && result; i++)
+      {
+        // Spaces are transparent
+        if(data_str_buf[i] != ' ')
+        {
+          const GlyphCache::Glyph* glyph = GlyphCache::GetInstance().GetGlyph(*data_font, data_scale, data_str_buf[i]);
+          // If glyph can't be cached - whole line will be drawn by string
+          if(glyph == nullptr) result = false;
+          else GlyphCache::DrawGlyphLine(*glyph, buf, n, str_line, x, DATA_COLOR);
+        }
+        x += char_w;
+      }
+    }
+  }
+
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -345,3 +440,13 @@ void DataWindow::Action(VisObject::ActionType action, int32_t tx, int32_t ty, in
       break;
   }
 }
+
+// *****************************************************************************
+// ***   Invalidate Object Area   **********************************************
+// *****************************************************************************
+void DataWindow::InvalidateObjArea(bool force)
+{
+  // Area will be coalesced with other dirty regions and invalidated at the end
+  // of the frame
+  DirtyRegions::GetInstance().Invalidate(p_list, x_start, y_start, x_end, y_end, force);
+}
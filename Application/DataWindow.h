@@ -23,6 +23,10 @@
 // *****************************************************************************
 #include "DevCore.h"
 
+#include "DirtyRegions.h"
+#include "GlyphCache.h"
+#include "PerfHud.h"
+
 // *****************************************************************************
 // ***   DataWindow Class   ****************************************************
 // *****************************************************************************
@@ -124,7 +128,20 @@ class DataWindow : public VisObject
     // *************************************************************************
     virtual void Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy);
 
+    // *************************************************************************
+    // ***   Set List   ********************************************************
+    // *************************************************************************
+    void SetList(VisList& list) {p_list = &list; VisObject::SetList(list);}
+
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false);
+
   private:
+    // List object belongs to
+    VisList* p_list = nullptr;
+
     // Callback function pointer
     AppTask* callback_task = nullptr;
     CallbackPtr callback_func = nullptr;
@@ -156,6 +173,13 @@ class DataWindow : public VisObject
     char data_str_buf[24] = {0};
     char format_str_buf[16] = {0};
     Position units_str_pos = NONE;
+    // Data string color. Fixed: data_str and glyph cache path must draw the
+    // same color, cached glyphs are color independent spans and get it only at
+    // draw time.
+    static const color_t DATA_COLOR = COLOR_WHITE;
+    // Data font and scale to draw large fonts from glyph cache
+    Font* data_font = nullptr;
+    uint32_t data_scale = 1u;
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
@@ -164,6 +188,16 @@ class DataWindow : public VisObject
     // ***   Private: UpdateStringPositions   **********************************
     // *************************************************************************
     void UpdateStringPositions(void);
+
+    // *************************************************************************
+    // ***   Private: InvalidateChangedChars   *********************************
+    // *************************************************************************
+    void InvalidateChangedChars(const char* prev_str);
+
+    // *************************************************************************
+    // ***   Private: DrawDataLine   *******************************************
+    // *************************************************************************
+    bool DrawDataLine(color_t* buf, int32_t n, int32_t line, int32_t start_x);
 };
 
 #endif
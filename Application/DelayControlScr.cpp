@@ -137,10 +137,10 @@ Result DelayControlScr::Show()
   right_btn.Show(102);
 
   // Set encoder callback handler
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
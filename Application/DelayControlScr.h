@@ -86,25 +86,25 @@ class DelayControlScr : public IScreen
     GrblComm::state_t grbl_state = GrblComm::UNKNOWN;
 
     // String for caption
-    String axis_names[GrblComm::AXIS_CNT];
+    Dirty<String> axis_names[GrblComm::AXIS_CNT];
     // Data windows to show DRO
     DataWindow dw[GrblComm::AXIS_CNT];
     // Data windows to show difference in position
     DataWindow dw_diff[GrblComm::AXIS_CNT];
 
     // String for caption
-    String feed_name;
+    Dirty<String> feed_name;
     // Data windows to show feed of movement
     DataWindow dw_feed;
 
     // Buttons to choose scale
-    UiButton scale_btn[3u];
+    Dirty<UiButton> scale_btn[3u];
     // Scale options(string)
     const char scale_str_metric[NumberOf(scale_btn)][9u] = {"0.001\nmm", "0.01\nmm", "0.1\nmm"};
     const char scale_str_imperial[NumberOf(scale_btn)][12u] = {"0.0001\ninch", "0.001\ninch", "0.01\ninch"};
 
     // String for X axis mode(Radius/Diameter)
-    String x_mode_str;
+    Dirty<String> x_mode_str;
 
     // Soft Buttons
     UiButton& left_btn;
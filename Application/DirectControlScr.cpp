@@ -19,9 +19,12 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DirectControlScr.h"
+#include "JogTrace.h"
 
 #include "Application.h"
 
+#include <cmath>  // For cosf(), sinf() & sqrtf()
+
 // *****************************************************************************
 // ***   Get Instance   ********************************************************
 // *****************************************************************************
@@ -31,6 +34,15 @@ DirectControlScr& DirectControlScr::GetInstance()
   return directcontrolscr;
 }
 
+// *****************************************************************************
+// ***   Public: GetVectorPlaneName   ******************************************
+// *****************************************************************************
+const char* DirectControlScr::GetVectorPlaneName(VectorPlane plane)
+{
+  static const char* const names[VECTOR_CNT] = {"off", "XY", "XZ", "YZ"};
+  return (plane < VECTOR_CNT) ? names[plane] : "";
+}
+
 // *****************************************************************************
 // ***   DirectControlScr Setup   **********************************************
 // *****************************************************************************
@@ -63,6 +75,9 @@ Result DirectControlScr::Setup(int32_t y, int32_t height)
     // Set/Zero button
     zero_btn[i].SetParams("<0>", dw[i].GetEndX() + BORDER_W, dw[i].GetStartY(), display_drv.GetScreenW() - dw[i].GetEndX() - BORDER_W * 2, dw[i].GetHeight(), true);
     zero_btn[i].SetCallback(AppTask::GetCurrent());
+    // Go to angle button under axis name, shown for rotary axes only
+    goto_btn[i].SetParams("", BORDER_W, dw[i].GetStartY(), dw[i].GetStartX() - BORDER_W * 2, dw[i].GetHeight(), true);
+    goto_btn[i].SetCallback(AppTask::GetCurrent());
   }
   // Scale buttons
   for(uint32_t i = 0u; i < NumberOf(scale_btn); i++)
@@ -124,6 +139,15 @@ Result DirectControlScr::Show()
   // Version string
   version.Show(1);
 
+  // Rotary settings may be changed while screen was hidden. Index division
+  // taken from position on the first click.
+  rotary_wrap = NVM::GetInstance().GetValue(NVM::ROTARY_WRAP);
+  rotary_div = NVM::GetInstance().GetValue(NVM::ROTARY_DIVISIONS);
+  for(uint32_t i = 0u; i < GrblComm::AXIS_CNT; i++)
+  {
+    index_valid[i] = false;
+  }
+
   // Update scale buttons
   UpdateScaleButtons();
 
@@ -133,6 +157,7 @@ Result DirectControlScr::Show()
     dw[i].Show(100);
     axis_names[i].Show(100);
     zero_btn[i].Show(100);
+    if(grbl_comm.IsRotaryAxis(i)) goto_btn[i].Show(100 - 1);
   }
 
   // Set current axis to none for prevent accidental movement
@@ -170,11 +195,29 @@ Result DirectControlScr::Show()
   left_btn.Show(102);
   right_btn.Show(102);
 
+  // Update everything on first tick
+  grbl_comm.ForceChanges(grbl_changes);
+
+  // Clicks received before screen was hidden mustn't move machine now
+  jog_val = 0;
+  for(uint32_t i = 0u; i < NumberOf(axis_jog_val); i++) axis_jog_val[i] = 0;
+
+  // No velocity jog motion
+  vel_jog_dir = 0;
+  vel_jog_stopping = false;
+
+  // Vector settings may be changed while screen was hidden
+  UpdateVector();
+
+  // Prediction starts from the next status report
+  dro_predict = NVM::GetInstance().GetValue(NVM::DRO_PREDICTION);
+  dro_predictor.Reset();
+
   // Set encoder callback handler
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -185,6 +228,9 @@ Result DirectControlScr::Hide()
   // Delete encoder callback handler
   InputDrv::GetInstance().DeleteEncoderCallbackHandler(enc_cble);
 
+  // Machine shouldn't continue to move after screen change
+  if(vel_jog_dir != 0) StopVelocityJog();
+
   // Version string
   version.Hide();
 
@@ -197,6 +243,7 @@ Result DirectControlScr::Hide()
     dw[i].Hide();
     axis_names[i].Hide();
     zero_btn[i].Hide();
+    goto_btn[i].Hide();
   }
   // Scale buttons
   for(uint32_t i = 0u; i < NumberOf(scale_btn); i++)
@@ -238,47 +285,54 @@ Result DirectControlScr::TimerExpired(uint32_t interval)
   Application::GetInstance().UpdateLeftButtonText();
   Application::GetInstance().UpdateRightButtonText();
 
+  // Data changed since previous tick
+  uint32_t changes = grbl_comm.GetChanges(grbl_changes);
+
   // In Lathe mode show Radius/Diameter string on top of X window
-  if(grbl_comm.GetModeOfOperation() == GrblComm::MODE_OF_OPERATION_LATHE)
+  if((grbl_comm.GetModeOfOperation() == GrblComm::MODE_OF_OPERATION_LATHE) && (changes & GrblComm::ChangeMask(GrblComm::CHG_XMODE)))
   {
     x_mode_str.SetString(grbl_comm.IsLatheDiameterMode() ? "Diameter" : "Radius");
   }
 
   // Update numbers with current position
-  for(uint32_t i = 0u; i < grbl_comm.GetLimitedNumberOfAxis(NumberOf(dw)); i++)
+  UpdateDro(changes);
+
+  // In velocity mode fast handwheel rotation is continuous motion
+  if(NVM::GetInstance().GetValue(NVM::MPG_VELOCITY_JOG))
   {
-    dw[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    result = ProcessVelocityJog(interval);
   }
 
-  // Update numbers with current position
-  for(uint32_t i = 0u; i < GrblComm::AXIS_CNT; i++)
+  // Update numbers with current position. Jog commands sent during jog cancel
+  // would be flushed by controller, so wait until machine stops.
+  for(uint32_t i = 0u; (i < GrblComm::AXIS_CNT) && !vel_jog_stopping; i++)
   {
     // If requested position changed
     if(axis_jog_val[i] != 0)
     {
-      // Calculate distance - number of encoder clicks multiplied by click value
-      int32_t distance = axis_jog_val[i] * scale;
-      // In Lathe mode we need some changes
-      if((i == GrblComm::AXIS_X) && (grbl_comm.GetModeOfOperation() == GrblComm::MODE_OF_OPERATION_LATHE))
-      {
-        // Invert X axis since clockwise rotation moves cutter to work piece(X decreased)
-        // and counterclockwise rotation moves cutter away from work piece(X increased)
-        distance = -distance;
-      }
+      // Handwheel speed in clicks per second and acceleration gain for it
+      uint32_t speed = InputDrv::GetInstance().GetEncoderSpeed();
+      // Index jog moves whole divisions, so there no acceleration gain for it
+      uint32_t gain = IsIndexJog(i) ? ENCODER_GAIN_SCALE : EncoderSpeed::GetGain((EncoderSpeed::Curve)NVM::GetInstance().GetValue(NVM::MPG_ACCEL_CURVE), speed);
+      // Click value: scale in units or, for index jog, scale in divisions
+      int32_t step = IsIndexJog(i) ? (int32_t)((int64_t)scale * GetRevolution() / rotary_div) : scale;
 
-      // Feed in mm/min or deg/min(21600 deg/min is equivalent 60 rpm or 1 revolution per second)
-      uint32_t feed_x100 = (grbl_comm.IsRotaryAxis(i) ? 21600u : 600u) * 100u; // TODO: Make it configurable?
+      // Feed in mm/min or deg/min
+      uint32_t feed_x100 = (grbl_comm.IsRotaryAxis(i) ? ROTARY_JOG_FEED : 600u) * 100u; // TODO: Make it configurable?
       // If jogging direction is not changed
       if(((axis_jog_dir[i] < 0) && (axis_jog_val[i] < 0)) || ((axis_jog_dir[i] > 0) && (axis_jog_val[i] > 0)))
       {
         // Feed in encoder clicks per second
-        feed_x100 = InputDrv::GetInstance().GetEncoderSpeed();
+        feed_x100 = speed;
         // 20 clicks per second as minimum feed
         if(feed_x100 < 20u) feed_x100 = 20u;
-        // Feed in units(1 um or 0.0001 inch depend on controller settings) per second
-        feed_x100 *= scale;
-        // Convert feed from units/sec to units*100/min
-        feed_x100 = feed_x100 * 60u / 10u;
+        // Feed in units(1 um or 0.0001 inch depend on controller settings) per
+        // second and then converted from units/sec to units*100/min
+        uint64_t feed = (uint64_t)feed_x100 * step * gain / ENCODER_GAIN_SCALE * 60u / 10u;
+        // Few clicks per second with large index divisions can be faster than
+        // any rotary table, limit it to the backlash feed
+        if(IsIndexJog(i) && (feed > ROTARY_JOG_FEED * 100u)) feed = ROTARY_JOG_FEED * 100u;
+        feed_x100 = (uint32_t)feed;
       }
       else // And if direction is changed
       {
@@ -295,7 +349,17 @@ Result DirectControlScr::TimerExpired(uint32_t interval)
       }
 
       // Jog machine
-      result = grbl_comm.Jog(i, distance, feed_x100, false);
+      if(IsIndexJog(i))
+      {
+        result = JogIndex(i, axis_jog_val[i] * scale, feed_x100);
+      }
+      else
+      {
+        // Calculate distance - number of encoder clicks multiplied by click value and gain
+        int32_t distance = axis_jog_val[i] * step * (int32_t)gain / (int32_t)ENCODER_GAIN_SCALE;
+        uint32_t id = 0u;
+        result = JogAxis(i, distance, feed_x100, id);
+      }
 
       // Clear value
       axis_jog_val[i] = 0;
@@ -304,29 +368,37 @@ Result DirectControlScr::TimerExpired(uint32_t interval)
     }
   }
 
-  // Update spindle direction button text if spindle is running
-  if(grbl_comm.IsSpindleCCW())
-  {
-    spindle_dir_btn.SetString("CCW");
-  }
-  else
+  // Update spindle buttons only if accessories state changed
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_ACCESSORIES))
   {
-    spindle_dir_btn.SetString("CW");
+    // Update spindle direction button text if spindle is running
+    if(grbl_comm.IsSpindleCCW())
+    {
+      spindle_dir_btn.SetString("CCW");
+    }
+    else
+    {
+      spindle_dir_btn.SetString("CW");
+    }
+
+    // Update spindle control button text
+    if(grbl_comm.IsSpindleRunning())
+    {
+      // If spindle is running - control button is stop button
+      spindle_ctrl_btn.SetString("STOP");
+    }
+    else
+    {
+      // If spindle is not running - control button is start button
+      spindle_ctrl_btn.SetString("START");
+    }
   }
 
-  // Update spindle control button text
-  if(grbl_comm.IsSpindleRunning())
+  // Update current speed if spindle is running
+  if(grbl_comm.IsSpindleRunning() && (changes & (GrblComm::ChangeMask(GrblComm::CHG_RPM) | GrblComm::ChangeMask(GrblComm::CHG_ACCESSORIES))))
   {
-    // If spindle is running - control button is stop button
-    spindle_ctrl_btn.SetString("STOP");
-    // Update current speed
     spindle_dw.SetNumber(grbl_comm.GetSpindleSpeed());
   }
-  else
-  {
-    // If spindle is not running - control button is start button
-    spindle_ctrl_btn.SetString("START");
-  }
 
   // Spindle speed
   if(jog_val != 0)
@@ -350,6 +422,7 @@ Result DirectControlScr::TimerExpired(uint32_t interval)
     for(uint32_t i = 0u; i < NumberOf(zero_btn); i++)
     {
       zero_btn[i].Enable();
+      goto_btn[i].Enable();
     }
     // Enable spindle control button
     spindle_ctrl_btn.Enable();
@@ -371,6 +444,7 @@ Result DirectControlScr::TimerExpired(uint32_t interval)
     for(uint32_t i = 0u; i < NumberOf(zero_btn); i++)
     {
       zero_btn[i].Disable();
+      goto_btn[i].Disable();
     }
     // Disable spindle buttons
     spindle_ctrl_btn.Disable();
@@ -419,7 +493,17 @@ Result DirectControlScr::ProcessCallback(const void* ptr)
   {
     if(change_box.GetResult())
     {
-      grbl_comm.SetAxisPosition(change_box.GetId(), change_box.GetValue());
+      // IDs after axis ones are go to angle requests
+      if(change_box.GetId() >= GrblComm::AXIS_CNT)
+      {
+        GoToAngle(change_box.GetId() - GrblComm::AXIS_CNT, change_box.GetValue());
+      }
+      else
+      {
+        grbl_comm.SetAxisPosition(change_box.GetId(), change_box.GetValue());
+        // Index divisions counted from the new position
+        index_valid[change_box.GetId()] = false;
+      }
     }
   }
   // Process spindle control button
@@ -485,6 +569,12 @@ Result DirectControlScr::ProcessCallback(const void* ptr)
           spindle_dw.SetSelected(false);
           // Then set border to green for selected one
           dw[i].SetSelected(true);
+          // In vector jog both plane axes move together
+          if(IsVectorJog(i))
+          {
+            dw[vec_axis[0u]].SetSelected(true);
+            dw[vec_axis[1u]].SetSelected(true);
+          }
           // Save axis to control
           axis = (GrblComm::Axis_t)i;
           // Update scale buttons
@@ -495,6 +585,20 @@ Result DirectControlScr::ProcessCallback(const void* ptr)
         else if(ptr == &zero_btn[i])
         {
           grbl_comm.ZeroAxis((GrblComm::Axis_t)i);
+          // Index divisions counted from the new zero
+          index_valid[i] = false;
+        }
+        else if(ptr == &goto_btn[i])
+        {
+          snprintf(goto_title, NumberOf(goto_title), "%s go to", grbl_comm.GetAxisName(i));
+          // Setup object to change numerical parameters, start from current angle
+          change_box.Setup(goto_title, grbl_comm.GetReportUnits(i), WrapAngle(grbl_comm.GetAxisPosition(i)), 0, GetRevolution() - 1, grbl_comm.GetReportUnitsPrecision(i));
+          // Set AppTask
+          change_box.SetCallback(AppTask::GetCurrent());
+          // Save axis index after axis IDs
+          change_box.SetId(i + GrblComm::AXIS_CNT);
+          // Show change box
+          change_box.Show(10000u);
         }
       }
       if(ptr == &spindle_dw)
@@ -526,6 +630,381 @@ Result DirectControlScr::ProcessCallback(const void* ptr)
   return result;
 }
 
+// *****************************************************************************
+// ***   Private: UpdateVector function   **************************************
+// *****************************************************************************
+void DirectControlScr::UpdateVector()
+{
+  // Axes for every plane
+  static const uint32_t plane_axis[VECTOR_CNT][2u] =
+  {
+    {GrblComm::AXIS_CNT, GrblComm::AXIS_CNT},
+    {GrblComm::AXIS_X, GrblComm::AXIS_Y},
+    {GrblComm::AXIS_X, GrblComm::AXIS_Z},
+    {GrblComm::AXIS_Y, GrblComm::AXIS_Z}
+  };
+
+  uint32_t plane = NVM::GetInstance().GetValue(NVM::MPG_VECTOR_PLANE);
+  if(plane >= VECTOR_CNT) plane = VECTOR_OFF;
+
+  // Vector jog possible only if controller has both axes
+  if((plane_axis[plane][1u] < GrblComm::AXIS_CNT) && (plane_axis[plane][1u] < grbl_comm.GetNumberOfAxis()))
+  {
+    vec_axis[0u] = plane_axis[plane][0u];
+    vec_axis[1u] = plane_axis[plane][1u];
+    // Direction components calculated once, jogs use integer math only
+    float angle = (float)NVM::GetInstance().GetValue(NVM::MPG_VECTOR_ANGLE) * 3.14159265f / 180.0f;
+    vec_dir[0u] = (int32_t)lroundf(cosf(angle) * VECTOR_JOG_SCALE);
+    vec_dir[1u] = (int32_t)lroundf(sinf(angle) * VECTOR_JOG_SCALE);
+  }
+  else
+  {
+    vec_axis[0u] = GrblComm::AXIS_CNT;
+    vec_axis[1u] = GrblComm::AXIS_CNT;
+  }
+  vec_rem[0u] = 0;
+  vec_rem[1u] = 0;
+}
+
+// *****************************************************************************
+// ***   Private: JogAxis function   *******************************************
+// *****************************************************************************
+Result DirectControlScr::JogAxis(uint32_t ax, int32_t distance, uint32_t feed_x100, uint32_t& id, bool* is_sent)
+{
+  Result result = Result::RESULT_OK;
+  // Command isn't sent yet
+  bool sent = false;
+
+  // Lathe mode: clockwise rotation moves cutter to work piece(X decreased)
+  // and counterclockwise rotation moves cutter away from work piece(X increased)
+  bool invert_x = (grbl_comm.GetModeOfOperation() == GrblComm::MODE_OF_OPERATION_LATHE);
+
+  if(IsVectorJog(ax))
+  {
+    int32_t dist[3u] = {0};
+    // Split distance to components. Remainders are carried to the next jog.
+    for(uint32_t i = 0u; i < NumberOf(vec_axis); i++)
+    {
+      int64_t val = (int64_t)distance * vec_dir[i] + vec_rem[i];
+      dist[vec_axis[i]] = (int32_t)(val / VECTOR_JOG_SCALE);
+      vec_rem[i] = val % VECTOR_JOG_SCALE;
+    }
+    if(invert_x) dist[GrblComm::AXIS_X] = -dist[GrblComm::AXIS_X];
+
+    // Path length after rounding. Feed scaled to keep time of the move.
+    float len = sqrtf((float)dist[0u] * dist[0u] + (float)dist[1u] * dist[1u] + (float)dist[2u] * dist[2u]);
+    // Too short move is kept in remainders
+    if(len >= 1.0f)
+    {
+      feed_x100 = (uint32_t)((float)feed_x100 * len / (float)((distance < 0) ? -distance : distance));
+      if(feed_x100 == 0u) feed_x100 = 1u;
+      // One command moves both axes along the vector
+      result = grbl_comm.JogMultiple(dist[GrblComm::AXIS_X], dist[GrblComm::AXIS_Y], dist[GrblComm::AXIS_Z], feed_x100, false, id);
+      // Save targets to limit DRO prediction
+      if(result.IsGood())
+      {
+        sent = true;
+        for(uint32_t i = 0u; i < NumberOf(dist); i++) dro_predictor.AddTarget(i, dist[i]);
+        dro_jog_id = id;
+        // Jog latency trace: jog sent to GrblComm
+        JOG_TRACE(JOG);
+      }
+    }
+  }
+  else
+  {
+    if(invert_x && (ax == GrblComm::AXIS_X)) distance = -distance;
+    // Jog one axis
+    result = grbl_comm.Jog(ax, distance, feed_x100, false, id);
+    // Save target to limit DRO prediction
+    if(result.IsGood())
+    {
+      sent = true;
+      dro_predictor.AddTarget(ax, distance);
+      dro_jog_id = id;
+      // Jog latency trace: jog sent to GrblComm
+      JOG_TRACE(JOG);
+    }
+  }
+
+  // Report if command was sent
+  if(is_sent != nullptr) *is_sent = sent;
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: IndexPosition function   *************************************
+// *****************************************************************************
+int32_t DirectControlScr::IndexPosition(int32_t div)
+{
+  int64_t rev = GetRevolution();
+  // div * rev / rotary_div rounded to nearest unit
+  return (int32_t)FloorDiv(2 * (int64_t)div * rev + rotary_div, 2 * (int64_t)rotary_div);
+}
+
+// *****************************************************************************
+// ***   Private: JogIndex function   ******************************************
+// *****************************************************************************
+Result DirectControlScr::JogIndex(uint32_t ax, int32_t divs, uint32_t feed_x100)
+{
+  int64_t rev = GetRevolution();
+  int32_t pos = grbl_comm.GetAxisPosition(ax);
+
+  // Axis can be moved by something else(i.e. by program or other sender).
+  // When machine stopped after the last jog it have to be at the division,
+  // otherwise division taken from the position again.
+  if(index_valid[ax] && (grbl_comm.GetState() == GrblComm::IDLE) && grbl_comm.IsStatusReceivedAfterCmd(dro_jog_id))
+  {
+    int64_t diff = pos - IndexPosition(index_div[ax]);
+    if(diff < 0) diff = -diff;
+    // Machine is closer to other division
+    if(diff * 2 * rotary_div > rev) index_valid[ax] = false;
+  }
+
+  if(!index_valid[ax])
+  {
+    // Nearest division
+    int32_t div = (int32_t)FloorDiv(2 * (int64_t)pos * rotary_div + rev, 2 * rev);
+    int64_t diff = pos - IndexPosition(div);
+    // Axis between divisions(more than 1% of division away from the nearest
+    // one, smaller difference is step rounding): the first click moves to the
+    // next division in direction of rotation
+    if((diff < 0 ? -diff : diff) * 100 * rotary_div > rev)
+    {
+      if((diff > 0) && (divs < 0)) div++;
+      if((diff < 0) && (divs > 0)) div--;
+    }
+    index_div[ax] = div;
+    index_valid[ax] = true;
+  }
+
+  // Absolute target calculated from division number: controller never
+  // accumulates rounding of relative moves
+  uint32_t id = 0u;
+  int32_t target = IndexPosition(index_div[ax] + divs);
+  Result result = grbl_comm.Jog(ax, target, feed_x100, true, id);
+  if(result.IsGood())
+  {
+    index_div[ax] += divs;
+    // Save target to limit DRO prediction
+    dro_predictor.SetTarget(ax, target);
+    dro_jog_id = id;
+    // Jog latency trace: jog sent to GrblComm
+    JOG_TRACE(JOG);
+  }
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: GoToAngle function   *****************************************
+// *****************************************************************************
+Result DirectControlScr::GoToAngle(uint32_t ax, int32_t angle)
+{
+  Result result = Result::RESULT_OK;
+
+  int32_t rev = GetRevolution();
+  int32_t pos = grbl_comm.GetAxisPosition(ax);
+  // Distance to the angle in 0-360 deg range, more than half revolution is
+  // shorter in opposite direction. Half revolution goes in positive direction.
+  int32_t delta = WrapAngle(angle - pos);
+  if(delta > rev / 2) delta -= rev;
+
+  if(delta != 0)
+  {
+    // Absolute jog: if machine still moves, target is still at the angle
+    uint32_t id = 0u;
+    result = grbl_comm.Jog(ax, pos + delta, ROTARY_JOG_FEED * 100u, true, id);
+    if(result.IsGood())
+    {
+      // Save target to limit DRO prediction
+      dro_predictor.SetTarget(ax, pos + delta);
+      dro_jog_id = id;
+    }
+  }
+  // Angle may be not on a division
+  index_valid[ax] = false;
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: UpdateDro function   *****************************************
+// *****************************************************************************
+void DirectControlScr::UpdateDro(uint32_t changes)
+{
+  uint32_t axis_cnt = grbl_comm.GetLimitedNumberOfAxis(NumberOf(dw));
+
+  if(dro_predict)
+  {
+    // State and feed can change without position change
+    if(changes & (GrblComm::ChangeMask(GrblComm::CHG_POS) | GrblComm::ChangeMask(GrblComm::CHG_STATE) | GrblComm::ChangeMask(GrblComm::CHG_FEED)))
+    {
+      int32_t pos[GrblComm::AXIS_CNT] = {0};
+      for(uint32_t i = 0u; i < axis_cnt; i++)
+      {
+        pos[i] = grbl_comm.GetAxisPosition(i);
+      }
+      // Feed applies to linear axes unless rotary axis is jogged
+      float feed = grbl_comm.GetFeedRate() * (float)grbl_comm.GetReportUnitsScaler((axis < GrblComm::AXIS_CNT) ? axis : GrblComm::AXIS_X);
+      dro_predictor.Report(grbl_comm.GetStatusTimestamp(), pos, axis_cnt, feed, grbl_comm.GetState() == GrblComm::JOG);
+    }
+
+    // Targets are known only until machine stops after the last jog. Status
+    // have to be received after jog command, otherwise state can be an old one.
+    GrblComm::status_t jog_result = grbl_comm.GetCmdResult(dro_jog_id);
+    if((grbl_comm.GetState() != GrblComm::JOG) && (jog_result != GrblComm::Status_Cmd_Not_Executed_Yet) &&
+       (((jog_result != GrblComm::Status_OK) && (jog_result != GrblComm::Status_Next_Cmd_Executed)) || grbl_comm.IsStatusReceivedAfterCmd(dro_jog_id)))
+    {
+      dro_predictor.ClearTargets();
+    }
+
+    // Estimation changes every tick while machine moves, report snaps it back
+    if(dro_predictor.IsActive() || (changes & (GrblComm::ChangeMask(GrblComm::CHG_POS) | GrblComm::ChangeMask(GrblComm::CHG_XMODE))))
+    {
+      uint32_t time_ms = RtosTick::GetTimeMs();
+      for(uint32_t i = 0u; i < axis_cnt; i++)
+      {
+        int32_t pos = dro_predictor.GetPosition(i, time_ms);
+        dw[i].SetNumber((rotary_wrap && grbl_comm.IsRotaryAxis(i)) ? WrapAngle(pos) : pos);
+      }
+    }
+  }
+  else if(changes & (GrblComm::ChangeMask(GrblComm::CHG_POS) | GrblComm::ChangeMask(GrblComm::CHG_XMODE)))
+  {
+    for(uint32_t i = 0u; i < axis_cnt; i++)
+    {
+      int32_t pos = grbl_comm.GetAxisPosition(i);
+      dw[i].SetNumber((rotary_wrap && grbl_comm.IsRotaryAxis(i)) ? WrapAngle(pos) : pos);
+    }
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+}
+
+// *****************************************************************************
+// ***   Private: ProcessVelocityJog function   ********************************
+// *****************************************************************************
+Result DirectControlScr::ProcessVelocityJog(uint32_t interval)
+{
+  Result result = Result::RESULT_OK;
+
+  // Wait until machine stops after jog cancel: status have to be received
+  // after cancel to be sure that state isn't an old one. If status doesn't
+  // arrive, stop waiting after timeout.
+  if(vel_jog_stopping)
+  {
+    if(((int32_t)(grbl_comm.GetStatusTimestamp() - vel_jog_cancel_ms) > 0) && (grbl_comm.GetState() != GrblComm::JOG))
+    {
+      vel_jog_stopping = false;
+    }
+    else if(RtosTick::GetTimeMs() - vel_jog_cancel_ms >= VELOCITY_JOG_CANCEL_TIMEOUT_MS)
+    {
+      vel_jog_stopping = false;
+    }
+    else
+    {
+      ; // Do nothing - MISRA rule
+    }
+  }
+  // If machine in motion
+  else if(vel_jog_dir != 0)
+  {
+    // Controller executes queued motion while we wait
+    vel_jog_queued_ms = (vel_jog_queued_ms > interval) ? (vel_jog_queued_ms - interval) : 0u;
+    // Clicks since previous tick
+    int32_t clicks = axis_jog_val[vel_jog_axis];
+    // Count time without clicks
+    vel_jog_idle_ms = (clicks == 0) ? (vel_jog_idle_ms + interval) : 0u;
+
+    // Handwheel stopped, reversed or axis changed - stop motion immediately.
+    // Clicks in opposite direction will be processed after machine stops.
+    if((vel_jog_idle_ms >= VELOCITY_JOG_STOP_MS) || (clicks * vel_jog_dir < 0) || (axis != vel_jog_axis))
+    {
+      StopVelocityJog();
+    }
+    else
+    {
+      // Clicks define speed, not distance
+      axis_jog_val[vel_jog_axis] = 0;
+    }
+  }
+  // Handwheel rotates fast enough to start continuous motion. Index jog
+  // always moves by whole divisions.
+  else if((axis < GrblComm::AXIS_CNT) && !IsIndexJog(axis) && (axis_jog_val[axis] != 0) && (InputDrv::GetInstance().GetEncoderSpeed() >= VELOCITY_JOG_MIN_SPEED))
+  {
+    vel_jog_axis = axis;
+    vel_jog_dir = (axis_jog_val[axis] > 0) ? 1 : -1;
+    vel_jog_queued_ms = 0u;
+    vel_jog_idle_ms = 0u;
+    axis_jog_val[axis] = 0;
+    // Step mode have to set feed for backlash movement on next direction change
+    axis_jog_dir[axis] = vel_jog_dir;
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+
+  // Keep controller queue filled up to horizon. Next command sent only when
+  // previous one taken by controller, so commands don't pile up in our queue.
+  if((vel_jog_dir != 0) && (vel_jog_queued_ms + interval <= VELOCITY_JOG_HORIZON_MS) && (grbl_comm.GetCmdResult(vel_jog_id) != GrblComm::Status_Cmd_Not_Executed_Yet))
+  {
+    // Motion time to add
+    uint32_t time_ms = VELOCITY_JOG_HORIZON_MS - vel_jog_queued_ms;
+    // Handwheel speed in clicks per second
+    uint32_t speed = InputDrv::GetInstance().GetEncoderSpeed();
+    // Speed in units(1 um or 0.0001 inch depend on controller settings) per
+    // second with acceleration gain
+    speed = (uint32_t)((uint64_t)speed * scale * EncoderSpeed::GetGain((EncoderSpeed::Curve)NVM::GetInstance().GetValue(NVM::MPG_ACCEL_CURVE), speed) / ENCODER_GAIN_SCALE);
+    // Distance to move for this time, at least one unit
+    int32_t distance = speed * time_ms / 1000u;
+    if(distance == 0) distance = 1;
+    if(vel_jog_dir < 0) distance = -distance;
+    // Convert feed from units/sec to units*100/min
+    uint32_t feed_x100 = speed * 60u / 10u;
+
+    // Jog machine
+    bool is_sent = false;
+    result = JogAxis(vel_jog_axis, distance, feed_x100, vel_jog_id, &is_sent);
+    // Motion queued only if command sent. Too short vector move is kept in
+    // remainders and added to the next jog.
+    if(result.IsGood())
+    {
+      if(is_sent) vel_jog_queued_ms += time_ms;
+    }
+    else // Jog isn't possible now(i.e. alarm or control lost), drop motion
+    {
+      vel_jog_dir = 0;
+    }
+  }
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: StopVelocityJog function   ***********************************
+// *****************************************************************************
+void DirectControlScr::StopVelocityJog()
+{
+  // Cancel motion with deceleration and discard queued jog commands
+  grbl_comm.JogCancel();
+  // Machine stops before targets, so DRO shows reported positions only
+  dro_predictor.ClearTargets();
+  // Save cancel time to wait for the status after it
+  vel_jog_cancel_ms = RtosTick::GetTimeMs();
+  vel_jog_stopping = true;
+  vel_jog_dir = 0;
+  vel_jog_queued_ms = 0u;
+}
+
 // *****************************************************************************
 // ***   Private: ProcessEncoderCallback function   ****************************
 // *****************************************************************************
@@ -572,7 +1051,15 @@ void DirectControlScr::UpdateScaleButtons()
     memset(scale_str[i], 0, NumberOf(scale_str[i]));
 
     // Check if it axis or spindle
-    if(axis < GrblComm::AXIS_CNT)
+    if(IsIndexJog(axis))
+    {
+      // Index jog: scale is number of divisions per click
+      static const uint32_t div_val[NumberOf(scale_btn)] = {1u, 2u, 5u, 10u};
+      scale_val[i] = div_val[i];
+      // Create scale for the button
+      snprintf(scale_str[i], NumberOf(scale_str[i]), "%lu div", scale_val[i]);
+    }
+    else if(axis < GrblComm::AXIS_CNT)
     {
       // Find appropriate scale settings
       uint32_t idx = (grbl_comm.IsMetric() ? NVM::MPG_METRIC_FEED_1 : NVM::MPG_IMPERIAL_FEED_1);
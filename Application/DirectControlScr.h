@@ -28,6 +28,7 @@
 #include "GrblComm.h"
 #include "InputDrv.h"
 #include "ChangeValueBox.h"
+#include "DroPredictor.h"
 
 #include "Version.h"
 
@@ -40,17 +41,53 @@
 // *****************************************************************************
 #define BG_Z (100)
 
+// Velocity jog: maximum motion time queued in controller
+#define VELOCITY_JOG_HORIZON_MS 100u
+// Velocity jog: handwheel considered stopped if there no clicks for this time
+#define VELOCITY_JOG_STOP_MS 40u
+// Velocity jog: minimum handwheel speed in clicks per second to start
+// continuous motion. Slower rotation processed click by click, since time
+// between clicks is longer than stop time.
+#define VELOCITY_JOG_MIN_SPEED 50u
+// Velocity jog: maximum time to wait for status after jog cancel. If no status
+// received(i.e. connection lost) handwheel shouldn't stay blocked forever.
+#define VELOCITY_JOG_CANCEL_TIMEOUT_MS 1000u
+
+// Vector jog: direction components are multiplied by this value
+#define VECTOR_JOG_SCALE 10000
+
+// Rotary axis feed for backlash and go to moves in deg/min: 21600 deg/min is
+// equivalent 60 rpm or 1 revolution per second. Controller limits it to axis
+// maximum rate.
+#define ROTARY_JOG_FEED 21600u
+
 // *****************************************************************************
 // ***   DirectControlScr Class   **********************************************
 // *****************************************************************************
 class DirectControlScr : public IScreen
 {
   public:
+    // Planes for vector jog: handwheel moves both axes of the plane together
+    // along direction set by angle from the first axis
+    enum VectorPlane
+    {
+      VECTOR_OFF, // Every axis jogs separately
+      VECTOR_XY,
+      VECTOR_XZ,
+      VECTOR_YZ,
+      VECTOR_CNT
+    };
+
     // *************************************************************************
     // ***   Get Instance   ****************************************************
     // *************************************************************************
     static DirectControlScr& GetInstance();
 
+    // *************************************************************************
+    // ***   Public: GetVectorPlaneName   **************************************
+    // *************************************************************************
+    static const char* GetVectorPlaneName(VectorPlane plane);
+
     // *************************************************************************
     // ***   Setup function   **************************************************
     // *************************************************************************
@@ -80,7 +117,7 @@ class DirectControlScr : public IScreen
     static constexpr uint8_t BORDER_W = 4u;
 
     // String for version
-    String version;
+    Dirty<String> version;
     // Version text with oscillator frequency
     char ver_txt[40u] = {0};
     // Value for speed
@@ -89,6 +126,48 @@ class DirectControlScr : public IScreen
     int32_t axis_jog_val[GrblComm::AXIS_CNT] = {0};
     // Jogging direction
     int32_t axis_jog_dir[GrblComm::AXIS_CNT] = {0};
+    // GrblComm change counters to update only changed data
+    uint32_t grbl_changes[GrblComm::CHG_CNT] = {0u};
+
+    // Velocity jog: axis in motion
+    uint32_t vel_jog_axis = GrblComm::AXIS_CNT;
+    // Velocity jog: direction of motion, zero if there no motion
+    int32_t vel_jog_dir = 0;
+    // Velocity jog: ID of last jog command
+    uint32_t vel_jog_id = 0u;
+    // Velocity jog: estimated motion time queued in controller
+    uint32_t vel_jog_queued_ms = 0u;
+    // Velocity jog: time since last encoder click
+    uint32_t vel_jog_idle_ms = 0u;
+    // Velocity jog: jog cancel sent, waiting until machine stops
+    bool vel_jog_stopping = false;
+    // Velocity jog: jog cancel timestamp
+    uint32_t vel_jog_cancel_ms = 0u;
+
+    // Vector jog: plane axes, AXIS_CNT if vector jog is off
+    uint32_t vec_axis[2u] = {GrblComm::AXIS_CNT, GrblComm::AXIS_CNT};
+    // Vector jog: direction components multiplied by VECTOR_JOG_SCALE
+    int32_t vec_dir[2u] = {0};
+    // Vector jog: rounding remainders of components multiplied by
+    // VECTOR_JOG_SCALE, so many small jogs don't drift from the vector
+    int64_t vec_rem[2u] = {0};
+
+    // DRO prediction: estimator of positions between status reports
+    DroPredictor dro_predictor;
+    // DRO prediction: enabled in settings
+    bool dro_predict = false;
+    // DRO prediction: ID of last jog command
+    uint32_t dro_jog_id = 0u;
+
+    // Rotary axes: show position in 0-360 deg range
+    bool rotary_wrap = false;
+    // Rotary axes: number of index divisions per revolution, 0 if off
+    int32_t rotary_div = 0;
+    // Rotary axes: current index division for every axis
+    int32_t index_div[GrblComm::AXIS_CNT] = {0};
+    // Rotary axes: index division is known, otherwise it is taken from the
+    // position on the next click
+    bool index_valid[GrblComm::AXIS_CNT] = {false};
 
     // Current selected axis
     GrblComm::Axis_t axis = GrblComm::AXIS_CNT;
@@ -96,18 +175,22 @@ class DirectControlScr : public IScreen
     int32_t scale = 1u;
 
     // String for caption
-    String axis_names[GrblComm::AXIS_CNT];
+    Dirty<String> axis_names[GrblComm::AXIS_CNT];
     // Data windows to show DRO
     DataWindow dw[GrblComm::AXIS_CNT];
     // Buttons to set 0
-    UiButton zero_btn[GrblComm::AXIS_CNT];
+    Dirty<UiButton> zero_btn[GrblComm::AXIS_CNT];
+    // Buttons to go to angle for rotary axes
+    Dirty<UiButton> goto_btn[GrblComm::AXIS_CNT];
+    // Title for go to change box
+    char goto_title[16u] = {0};
     // Buttons to change Radius/Diameter in Lathe Mode
-    UiButton x_mode_btn;
+    Dirty<UiButton> x_mode_btn;
     // String for X axis mode(Radius/Diameter)
-    String x_mode_str;
+    Dirty<String> x_mode_str;
 
     // Buttons to choose scale
-    UiButton scale_btn[4u];
+    Dirty<UiButton> scale_btn[4u];
     // Scale options(string)
     char scale_str[NumberOf(scale_btn)][12u] = {0};
     // Scale options(value)
@@ -116,10 +199,10 @@ class DirectControlScr : public IScreen
     // Data windows to show spindle speed
     DataWindow spindle_dw;
     // String for spindle caption
-    String spindle_name;
+    Dirty<String> spindle_name;
     // Buttons to on/off spindle
-    UiButton spindle_dir_btn;
-    UiButton spindle_ctrl_btn;
+    Dirty<UiButton> spindle_dir_btn;
+    Dirty<UiButton> spindle_ctrl_btn;
 
     // Soft Buttons
     UiButton& left_btn;
@@ -142,6 +225,82 @@ class DirectControlScr : public IScreen
     // *************************************************************************
     void UnpressButtons();
 
+    // *************************************************************************
+    // ***   Private: UpdateVector function   **********************************
+    // *************************************************************************
+    void UpdateVector();
+
+    // *************************************************************************
+    // ***   Private: IsVectorJog function   ***********************************
+    // *************************************************************************
+    bool IsVectorJog(uint32_t ax) {return (vec_axis[0u] < GrblComm::AXIS_CNT) && ((ax == vec_axis[0u]) || (ax == vec_axis[1u]));}
+
+    // *************************************************************************
+    // ***   Private: JogAxis function   ***************************************
+    // *************************************************************************
+    // * Jog selected axis or, if axis is in vector plane, both plane axes with
+    // * one command. Distance and feed are along the vector. Vector move
+    // * shorter than one unit is kept in remainders and no command is sent:
+    // * is_sent(if not nullptr) set to true only if command was sent.
+    Result JogAxis(uint32_t ax, int32_t distance, uint32_t feed_x100, uint32_t& id, bool* is_sent = nullptr);
+
+    // *************************************************************************
+    // ***   Private: IsIndexJog function   ************************************
+    // *************************************************************************
+    bool IsIndexJog(uint32_t ax) {return (rotary_div > 0) && grbl_comm.IsRotaryAxis(ax);}
+
+    // *************************************************************************
+    // ***   Private: GetRevolution function   *********************************
+    // *************************************************************************
+    // * One revolution of rotary axis in position units
+    int32_t GetRevolution() {return 360 * grbl_comm.GetUnitsScaler(GrblComm::MEASUREMENT_SYSTEM_ROTARY);}
+
+    // *************************************************************************
+    // ***   Private: WrapAngle function   *************************************
+    // *************************************************************************
+    // * Rotary axis position in 0-360 deg range
+    int32_t WrapAngle(int32_t pos) {return (int32_t)(pos - FloorDiv(pos, GetRevolution()) * GetRevolution());}
+
+    // *************************************************************************
+    // ***   Private: FloorDiv function   **************************************
+    // *************************************************************************
+    // * Integer division rounded toward minus infinity, divisor is positive
+    static int64_t FloorDiv(int64_t a, int64_t b) {return (a >= 0) ? (a / b) : -((b - 1 - a) / b);}
+
+    // *************************************************************************
+    // ***   Private: IndexPosition function   *********************************
+    // *************************************************************************
+    // * Position of index division. Calculated from division number every time,
+    // * so any number of index steps doesn't accumulate rounding error.
+    int32_t IndexPosition(int32_t div);
+
+    // *************************************************************************
+    // ***   Private: JogIndex function   **************************************
+    // *************************************************************************
+    // * Jog rotary axis by number of index divisions
+    Result JogIndex(uint32_t ax, int32_t divs, uint32_t feed_x100);
+
+    // *************************************************************************
+    // ***   Private: GoToAngle function   *************************************
+    // *************************************************************************
+    // * Jog rotary axis to angle in shortest direction
+    Result GoToAngle(uint32_t ax, int32_t angle);
+
+    // *************************************************************************
+    // ***   Private: UpdateDro function   *************************************
+    // *************************************************************************
+    void UpdateDro(uint32_t changes);
+
+    // *************************************************************************
+    // ***   Private: ProcessVelocityJog function   ****************************
+    // *************************************************************************
+    Result ProcessVelocityJog(uint32_t interval);
+
+    // *************************************************************************
+    // ***   Private: StopVelocityJog function   *******************************
+    // *************************************************************************
+    void StopVelocityJog();
+
     // *************************************************************************
     // ***   Private: ProcessEncoderCallback function   ************************
     // *************************************************************************
@@ -0,0 +1,308 @@
+//******************************************************************************
+//  @file DirtyRegions.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DirtyRegions: User DirtyRegions Class, implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DirtyRegions.h"
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+DirtyRegions& DirtyRegions::GetInstance()
+{
+  static DirtyRegions dirty_regions;
+  return dirty_regions;
+}
+
+// *****************************************************************************
+// ***   Public: Setup   *******************************************************
+// *****************************************************************************
+Result DirtyRegions::Setup()
+{
+  // Enable DWT cycle counter to measure frame time
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if defined(DIRTY_REGIONS_DEBUG_INFO)
+  info_str.SetParams(info_str_buf, 0, 0, COLOR_WHITE, Font_6x8::GetInstance());
+  info_str.Show(32000u);
+#endif
+
+  // All good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Invalidate   **************************************************
+// *****************************************************************************
+void DirtyRegions::Invalidate(int32_t xs, int32_t ys, int32_t xe, int32_t ye, bool force)
+{
+  Region r = {xs, ys, xe, ye, force};
+
+  // Ignore empty regions
+  if((xe >= xs) && (ye >= ys))
+  {
+    mutex.Lock();
+    // Count widget updates
+    updates_cnt++;
+    // Merge region with all regions it overlaps or it is cheap to merge with.
+    // After merge region grows, so check all regions again from the start.
+    for(uint32_t i = 0u; i < regions_cnt;)
+    {
+      if(Waste(r, regions[i]) <= DIRTY_REGIONS_MERGE_WASTE)
+      {
+        Merge(r, regions[i]);
+        Remove(i);
+        i = 0u;
+      }
+      else
+      {
+        i++;
+      }
+    }
+    // If there is no space for a new region
+    while(regions_cnt >= NumberOf(regions))
+    {
+      // Find region with the smallest waste
+      uint32_t idx = 0u;
+      uint32_t min_waste = UINT32_MAX;
+      for(uint32_t i = 0u; i < regions_cnt; i++)
+      {
+        uint32_t waste = Waste(r, regions[i]);
+        if(waste < min_waste)
+        {
+          min_waste = waste;
+          idx = i;
+        }
+      }
+      // And merge it with new region
+      Merge(r, regions[idx]);
+      Remove(idx);
+      // Bigger region can overlap others - merge them too
+      for(uint32_t i = 0u; i < regions_cnt;)
+      {
+        if(Waste(r, regions[i]) <= DIRTY_REGIONS_MERGE_WASTE)
+        {
+          Merge(r, regions[i]);
+          Remove(i);
+          i = 0u;
+        }
+        else
+        {
+          i++;
+        }
+      }
+    }
+    // Add region to the end of list
+    regions[regions_cnt++] = r;
+    mutex.Release();
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Invalidate   **************************************************
+// *****************************************************************************
+void DirtyRegions::Invalidate(VisList* list, int32_t xs, int32_t ys, int32_t xe, int32_t ye, bool force)
+{
+  // Convert list coordinates to screen coordinates
+  if(list != nullptr)
+  {
+    xs += list->GetStartX();
+    ys += list->GetStartY();
+    xe += list->GetStartX();
+    ye += list->GetStartY();
+  }
+  Invalidate(xs, ys, xe, ye, force);
+}
+
+// *****************************************************************************
+// ***   Public: StartFrame   **************************************************
+// *****************************************************************************
+void DirtyRegions::StartFrame()
+{
+  frame_start = DWT->CYCCNT;
+}
+
+// *****************************************************************************
+// ***   Public: EndFrame   ****************************************************
+// *****************************************************************************
+void DirtyRegions::EndFrame()
+{
+  // Display driver keeps one update area: all invalidated areas are merged
+  // into it and it is drawn as a whole. So regions taken in this frame are
+  // merged too and budget applies to that merged area.
+  Region area = {0, 0, -1, -1, false};
+  uint32_t area_cnt = 0u;
+
+  frame_pixels = 0u;
+  deferred_pixels = 0u;
+
+  // Save number of updates made during the frame
+  mutex.Lock();
+  frame_updates = updates_cnt;
+  updates_cnt = 0u;
+  mutex.Release();
+
+#if defined(DIRTY_REGIONS_FILL_RATE_TEST)
+  // Full screen redraw every frame
+  Invalidate(0, 0, DisplayDrv::GetInstance().GetScreenW() - 1, DisplayDrv::GetInstance().GetScreenH() - 1);
+#endif
+
+  mutex.Lock();
+  // Forced regions are taken first regardless of the budget
+  for(uint32_t i = 0u; i < regions_cnt;)
+  {
+    if(regions[i].force)
+    {
+      Take(area, area_cnt, i);
+    }
+    else
+    {
+      i++;
+    }
+  }
+  // Take other regions in order they were invalidated while merged area fits
+  // into the budget. At least one region taken every frame, even if it is
+  // bigger than budget.
+  while(regions_cnt > 0u)
+  {
+    Region u = regions[0u];
+    if(area_cnt != 0u) Merge(u, area);
+    if((pixel_budget != 0u) && (area_cnt != 0u) && (Area(Clip(u)) > pixel_budget)) break;
+    Take(area, area_cnt, 0u);
+  }
+  // Regions inside merged area are drawn anyway
+  for(uint32_t i = 0u; i < regions_cnt;)
+  {
+    if((regions[i].xs >= area.xs) && (regions[i].ys >= area.ys) && (regions[i].xe <= area.xe) && (regions[i].ye <= area.ye))
+    {
+      Take(area, area_cnt, i);
+    }
+    else
+    {
+      i++;
+    }
+  }
+  // Count deferred pixels
+  for(uint32_t i = 0u; i < regions_cnt; i++)
+  {
+    deferred_pixels += Area(Clip(regions[i]));
+  }
+  mutex.Release();
+
+  // Invalidate area outside of the mutex: display driver have its own lock
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  if(area_cnt != 0u)
+  {
+    area = Clip(area);
+    frame_pixels = Area(area);
+    display_drv.InvalidateArea(area.xs, area.ys, area.xe, area.ye);
+  }
+  frame_regions = area_cnt;
+
+  // Calculate application time: from frame start until frame is handed to
+  // the display task. Display task draws and sends area after that.
+  app_time_us = (DWT->CYCCNT - frame_start) / (SystemCoreClock / 1000000u);
+  if(app_time_us > max_app_time_us) max_app_time_us = app_time_us;
+
+  // Wake up display task to draw and send the area
+  display_drv.UpdateDisplay();
+
+#if defined(DIRTY_REGIONS_DEBUG_INFO)
+  // String invalidates itself directly, so it doesn't count in the next frame
+  snprintf(info_str_buf, NumberOf(info_str_buf), "px:%6lu rg:%2lu up:%3lu def:%6lu a:%5luus", frame_pixels, frame_regions, frame_updates, deferred_pixels, app_time_us);
+  info_str.SetString(info_str_buf, true);
+#endif
+}
+
+// *****************************************************************************
+// ***   Private: Waste   ******************************************************
+// *****************************************************************************
+uint32_t DirtyRegions::Waste(const Region& a, const Region& b)
+{
+  uint32_t result = 0u;
+
+  // Intersection of two regions
+  Region i = {(a.xs > b.xs) ? a.xs : b.xs, (a.ys > b.ys) ? a.ys : b.ys,
+              (a.xe < b.xe) ? a.xe : b.xe, (a.ye < b.ye) ? a.ye : b.ye, false};
+  // Overlapped regions have to be merged regardless of waste to keep regions
+  // non-overlapping
+  if((i.xs > i.xe) || (i.ys > i.ye))
+  {
+    // Union of two regions
+    Region u = a;
+    Merge(u, b);
+    // Pixels that will be updated without need
+    result = Area(u) - Area(a) - Area(b);
+  }
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Merge   ******************************************************
+// *****************************************************************************
+void DirtyRegions::Merge(Region& a, const Region& b)
+{
+  a.force = a.force || b.force;
+  if(b.xs < a.xs) a.xs = b.xs;
+  if(b.ys < a.ys) a.ys = b.ys;
+  if(b.xe > a.xe) a.xe = b.xe;
+  if(b.ye > a.ye) a.ye = b.ye;
+}
+
+// *****************************************************************************
+// ***   Private: Take   *******************************************************
+// *****************************************************************************
+void DirtyRegions::Take(Region& area, uint32_t& cnt, uint32_t idx)
+{
+  if(cnt == 0u) area = regions[idx];
+  else          Merge(area, regions[idx]);
+  cnt++;
+  Remove(idx);
+}
+
+// *****************************************************************************
+// ***   Private: Clip   *******************************************************
+// *****************************************************************************
+DirtyRegions::Region DirtyRegions::Clip(Region r)
+{
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  if(r.xs < 0) r.xs = 0;
+  if(r.ys < 0) r.ys = 0;
+  if(r.xe >= display_drv.GetScreenW()) r.xe = display_drv.GetScreenW() - 1;
+  if(r.ye >= display_drv.GetScreenH()) r.ye = display_drv.GetScreenH() - 1;
+  // Region outside of the screen is empty
+  if(r.xe < r.xs) r.xe = r.xs - 1;
+  if(r.ye < r.ys) r.ye = r.ys - 1;
+  return r;
+}
+
+// *****************************************************************************
+// ***   Private: Remove   *****************************************************
+// *****************************************************************************
+void DirtyRegions::Remove(uint32_t idx)
+{
+  // Shift regions to keep invalidation order
+  for(uint32_t i = idx + 1u; i < regions_cnt; i++)
+  {
+    regions[i - 1u] = regions[i];
+  }
+  regions_cnt--;
+}
@@ -0,0 +1,257 @@
+//******************************************************************************
+//  @file DirtyRegions.h
+//  @author Nicolai Shlapunov
+//
+//  @details DirtyRegions: User DirtyRegions Class, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef DirtyRegions_h
+#define DirtyRegions_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+
+// *****************************************************************************
+// ***   Debug defines   *******************************************************
+// *****************************************************************************
+
+// Show pixels invalidated and application time on the screen
+//#define DIRTY_REGIONS_DEBUG_INFO
+
+// Invalidate whole screen every frame to measure fill rate. Enable
+// DISPLAY_DEBUG_INFO in DevCfgUsr.h to see display FPS.
+//#define DIRTY_REGIONS_FILL_RATE_TEST
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Maximum number of dirty regions. In case of overflow, regions with the
+// smallest waste will be merged. Regions are kept separate to decide which
+// of them are deferred: display driver updates one area per frame, so
+// regions taken in one frame are merged into it.
+#define DIRTY_REGIONS_MAX 16u
+
+// Two regions merged into one if it adds less than this number of pixels.
+#define DIRTY_REGIONS_MERGE_WASTE 512u
+
+// Default number of pixels that can be updated in one frame. Default value is
+// roughly what SPI can push to ILI9488 in 20 ms. Budget applies to the area
+// that covers all regions of the frame, since display driver redraws that
+// area as a whole. Regions that doesn't fit into the budget deferred to the
+// next frame. Zero - no limit.
+#define DIRTY_REGIONS_PIXEL_BUDGET (480u * 320u / 4u)
+
+// *****************************************************************************
+// ***   DirtyRegions Class   **************************************************
+// *****************************************************************************
+class DirtyRegions
+{
+  public:
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static DirtyRegions& GetInstance();
+
+    // *************************************************************************
+    // ***   Public: Setup   ***************************************************
+    // *************************************************************************
+    Result Setup();
+
+    // *************************************************************************
+    // ***   Public: Invalidate   **********************************************
+    // *************************************************************************
+    // Forced region is updated in the current frame even if it doesn't fit into
+    // the pixel budget
+    void Invalidate(int32_t xs, int32_t ys, int32_t xe, int32_t ye, bool force = false);
+
+    // *************************************************************************
+    // ***   Public: Invalidate   **********************************************
+    // *************************************************************************
+    void Invalidate(VisObject& obj, bool force = false) {Invalidate(obj.GetStartX(), obj.GetStartY(), obj.GetEndX(), obj.GetEndY(), force);}
+
+    // *************************************************************************
+    // ***   Public: Invalidate   **********************************************
+    // *************************************************************************
+    // Coordinates are relative to the list if list isn't nullptr
+    void Invalidate(VisList* list, int32_t xs, int32_t ys, int32_t xe, int32_t ye, bool force = false);
+
+    // *************************************************************************
+    // ***   Public: StartFrame   **********************************************
+    // *************************************************************************
+    void StartFrame();
+
+    // *************************************************************************
+    // ***   Public: EndFrame   ************************************************
+    // *************************************************************************
+    // Invalidates area that covers regions fit into the budget and wakes up
+    // display task to draw it. Display task draws and sends area after that,
+    // so it isn't included in application time.
+    void EndFrame();
+
+    // *************************************************************************
+    // ***   Public: SetPixelBudget   ******************************************
+    // *************************************************************************
+    void SetPixelBudget(uint32_t budget) {pixel_budget = budget;}
+
+    // *************************************************************************
+    // ***   Public: GetPixelBudget   ******************************************
+    // *************************************************************************
+    uint32_t GetPixelBudget() {return pixel_budget;}
+
+    // *************************************************************************
+    // ***   Public: GetFramePixels   ******************************************
+    // *************************************************************************
+    // Pixels in the area invalidated in the last frame
+    uint32_t GetFramePixels() {return frame_pixels;}
+
+    // *************************************************************************
+    // ***   Public: GetFrameRegions   *****************************************
+    // *************************************************************************
+    uint32_t GetFrameRegions() {return frame_regions;}
+
+    // *************************************************************************
+    // ***   Public: GetFrameUpdates   *****************************************
+    // *************************************************************************
+    uint32_t GetFrameUpdates() {return frame_updates;}
+
+    // *************************************************************************
+    // ***   Public: GetDeferredPixels   ***************************************
+    // *************************************************************************
+    uint32_t GetDeferredPixels() {return deferred_pixels;}
+
+    // *************************************************************************
+    // ***   Public: GetAppTimeUs   ********************************************
+    // *************************************************************************
+    // Time from StartFrame() until frame is handed to display task: object
+    // updates and invalidation
+    uint32_t GetAppTimeUs() {return app_time_us;}
+
+    // *************************************************************************
+    // ***   Public: GetMaxAppTimeUs   *****************************************
+    // *************************************************************************
+    uint32_t GetMaxAppTimeUs() {return max_app_time_us;}
+
+    // *************************************************************************
+    // ***   Public: ResetStatistic   ******************************************
+    // *************************************************************************
+    void ResetStatistic() {max_app_time_us = 0u;}
+
+  private:
+    // Region
+    typedef struct
+    {
+      int32_t xs;
+      int32_t ys;
+      int32_t xe;
+      int32_t ye;
+      bool force;
+    } Region;
+
+    // Dirty regions in order they were invalidated
+    Region regions[DIRTY_REGIONS_MAX];
+    // Number of dirty regions
+    uint32_t regions_cnt = 0u;
+    // Number of invalidations since frame start - how many widgets were updated
+    uint32_t updates_cnt = 0u;
+
+    // Pixel budget for one frame
+    uint32_t pixel_budget = DIRTY_REGIONS_PIXEL_BUDGET;
+
+    // Statistic for the last frame
+    uint32_t frame_pixels = 0u;
+    uint32_t frame_regions = 0u;
+    uint32_t frame_updates = 0u;
+    uint32_t deferred_pixels = 0u;
+    uint32_t app_time_us = 0u;
+    uint32_t max_app_time_us = 0u;
+    // Cycle counter value at the frame start
+    uint32_t frame_start = 0u;
+
+#if defined(DIRTY_REGIONS_DEBUG_INFO)
+    // String to show statistic
+    String info_str;
+    char info_str_buf[48u] = {0};
+#endif
+
+    // Mutex to protect regions: objects can be invalidated from the display
+    // task by touch actions
+    RtosMutex mutex;
+
+    // *************************************************************************
+    // ***   Private: Area   ***************************************************
+    // *************************************************************************
+    static uint32_t Area(const Region& r) {return (uint32_t)(r.xe - r.xs + 1) * (uint32_t)(r.ye - r.ys + 1);}
+
+    // *************************************************************************
+    // ***   Private: Waste   **************************************************
+    // *************************************************************************
+    static uint32_t Waste(const Region& a, const Region& b);
+
+    // *************************************************************************
+    // ***   Private: Merge   **************************************************
+    // *************************************************************************
+    static void Merge(Region& a, const Region& b);
+
+    // *************************************************************************
+    // ***   Private: Remove   *************************************************
+    // *************************************************************************
+    void Remove(uint32_t idx);
+
+    // *************************************************************************
+    // ***   Private: Take   ***************************************************
+    // *************************************************************************
+    // Merge region into update area and remove it from the list
+    void Take(Region& area, uint32_t& cnt, uint32_t idx);
+
+    // *************************************************************************
+    // ***   Private: Clip   ***************************************************
+    // *************************************************************************
+    static Region Clip(Region r);
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    DirtyRegions() {};
+};
+
+// *****************************************************************************
+// ***   Dirty Template Class   ************************************************
+// *****************************************************************************
+// DevCore object that invalidates its area through DirtyRegions. Application
+// objects override InvalidateObjArea() themselves.
+template<class T> class Dirty : public T
+{
+  public:
+    // Use constructors of the DevCore object
+    using T::T;
+
+    // *************************************************************************
+    // ***   Set List   ********************************************************
+    // *************************************************************************
+    // Object in the list has coordinates relative to the list
+    void SetList(VisList& list) {p_list = &list; T::SetList(list);}
+
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false) {DirtyRegions::GetInstance().Invalidate(p_list, T::GetStartX(), T::GetStartY(), T::GetEndX(), T::GetEndY(), force);}
+
+  private:
+    // List object belongs to
+    VisList* p_list = nullptr;
+};
+
+#endif
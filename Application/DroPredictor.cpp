@@ -0,0 +1,171 @@
+//******************************************************************************
+//  @file DroPredictor.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DroPredictor: DRO position estimator between status reports,
+//           implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DroPredictor.h"
+
+#include <cmath>  // For sqrtf()
+
+// *****************************************************************************
+// ***   Public: Report   ******************************************************
+// *****************************************************************************
+void DroPredictor::Report(uint32_t time_ms, const int32_t* position, uint32_t n, float feed, bool moving)
+{
+  if(n > AXIS_MAX) n = AXIS_MAX;
+
+  // Position change since previous report
+  float len = 0.0f;
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    float delta = (i < axis_cnt) ? (float)(position[i] - pos[i]) : 0.0f;
+    len += delta * delta;
+  }
+  len = sqrtf(len);
+
+  // Direction updated only if position changed. Report can be caused by state
+  // or feed change only, direction stays the same in this case.
+  if(len > 0.0f)
+  {
+    for(uint32_t i = 0u; i < n; i++)
+    {
+      dir[i] = (i < axis_cnt) ? (float)(position[i] - pos[i]) / len : 0.0f;
+    }
+  }
+  else if(n != axis_cnt)
+  {
+    for(uint32_t i = 0u; i < n; i++) dir[i] = 0.0f;
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+
+  // Feed is speed along the path, split it between axes
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    pos[i] = position[i];
+    vel[i] = (moving && (feed > 0.0f)) ? dir[i] * feed / 60000.0f : 0.0f;
+  }
+  axis_cnt = n;
+  report_ms = time_ms;
+}
+
+// *****************************************************************************
+// ***   Public: AddTarget   ***************************************************
+// *****************************************************************************
+void DroPredictor::AddTarget(uint32_t axis, int32_t distance)
+{
+  if(axis < axis_cnt)
+  {
+    if(!target_valid[axis])
+    {
+      target[axis] = pos[axis];
+      target_valid[axis] = true;
+    }
+    target[axis] += distance;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: SetTarget   ***************************************************
+// *****************************************************************************
+void DroPredictor::SetTarget(uint32_t axis, int32_t position)
+{
+  if(axis < axis_cnt)
+  {
+    target[axis] = position;
+    target_valid[axis] = true;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: ClearTargets   ************************************************
+// *****************************************************************************
+void DroPredictor::ClearTargets()
+{
+  for(uint32_t i = 0u; i < AXIS_MAX; i++)
+  {
+    target_valid[i] = false;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: IsActive   ****************************************************
+// *****************************************************************************
+bool DroPredictor::IsActive()
+{
+  bool result = false;
+  for(uint32_t i = 0u; (i < axis_cnt) && !result; i++)
+  {
+    result = target_valid[i] && (vel[i] != 0.0f);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: GetPosition   *************************************************
+// *****************************************************************************
+int32_t DroPredictor::GetPosition(uint32_t axis, uint32_t time_ms)
+{
+  int32_t result = 0;
+
+  if(axis < axis_cnt)
+  {
+    result = pos[axis];
+    // Axis without target or not moving shows reported position
+    if(target_valid[axis] && (vel[axis] != 0.0f))
+    {
+      uint32_t dt = time_ms - report_ms;
+      if(dt > DRO_PREDICT_MAX_MS) dt = DRO_PREDICT_MAX_MS;
+      // Truncation toward zero: estimation stays behind real position rather
+      // than ahead of it
+      int32_t est = pos[axis] + (int32_t)(vel[axis] * (float)dt);
+      // Estimation never passes the target. If report already passed target
+      // (i.e. target is stale), reported position is shown.
+      if(vel[axis] > 0.0f)
+      {
+        if(est > target[axis]) est = target[axis];
+        if(est < pos[axis]) est = pos[axis];
+      }
+      else
+      {
+        if(est < target[axis]) est = target[axis];
+        if(est > pos[axis]) est = pos[axis];
+      }
+      result = est;
+    }
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Reset   *******************************************************
+// *****************************************************************************
+void DroPredictor::Reset()
+{
+  axis_cnt = 0u;
+  for(uint32_t i = 0u; i < AXIS_MAX; i++)
+  {
+    dir[i] = 0.0f;
+    vel[i] = 0.0f;
+  }
+  ClearTargets();
+}
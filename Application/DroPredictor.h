@@ -0,0 +1,109 @@
+//******************************************************************************
+//  @file DroPredictor.h
+//  @author Nicolai Shlapunov
+//
+//  @details DroPredictor: DRO position estimator between status reports, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef DroPredictor_h
+#define DroPredictor_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Position isn't extrapolated longer than this time after the last report, so
+// display doesn't run away if reports stop coming
+#define DRO_PREDICT_MAX_MS 250u
+
+// *****************************************************************************
+// ***   DroPredictor Class   **************************************************
+// *****************************************************************************
+// Extrapolates axis positions between status reports. Direction of motion is
+// taken from position change between last two reports, speed from the current
+// feed. Only axes with known target are extrapolated and estimation never
+// passes the target, so display never shows position machine won't reach.
+// Every report replaces the estimation. Pure C++ without HAL or RTOS calls.
+class DroPredictor
+{
+  public:
+    // Maximum number of axes
+    static const uint32_t AXIS_MAX = 6u;
+
+    // *************************************************************************
+    // ***   Public: Report   **************************************************
+    // *************************************************************************
+    // New status report: positions of n axes, feed in position units per
+    // minute and flag that machine moves.
+    void Report(uint32_t time_ms, const int32_t* position, uint32_t n, float feed, bool moving);
+
+    // *************************************************************************
+    // ***   Public: AddTarget   ***********************************************
+    // *************************************************************************
+    // Relative move commanded for axis. First move after ClearTargets()
+    // starts from the last reported position.
+    void AddTarget(uint32_t axis, int32_t distance);
+
+    // *************************************************************************
+    // ***   Public: SetTarget   ***********************************************
+    // *************************************************************************
+    // Absolute move commanded for axis
+    void SetTarget(uint32_t axis, int32_t position);
+
+    // *************************************************************************
+    // ***   Public: ClearTargets   ********************************************
+    // *************************************************************************
+    // Targets unknown(i.e. jog canceled or machine stopped) - stop estimation
+    void ClearTargets();
+
+    // *************************************************************************
+    // ***   Public: IsActive   ************************************************
+    // *************************************************************************
+    // True if any axis position is extrapolated
+    bool IsActive();
+
+    // *************************************************************************
+    // ***   Public: GetPosition   *********************************************
+    // *************************************************************************
+    // Estimated axis position at given time
+    int32_t GetPosition(uint32_t axis, uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Public: Reset   ***************************************************
+    // *************************************************************************
+    // Forget reports and targets, i.e. when screen is shown
+    void Reset();
+
+  private:
+    // Number of reported axes
+    uint32_t axis_cnt = 0u;
+    // Time of the last report
+    uint32_t report_ms = 0u;
+    // Last reported positions
+    int32_t pos[AXIS_MAX] = {0};
+    // Direction of motion, unit vector
+    float dir[AXIS_MAX] = {0.0f};
+    // Velocity, position units per millisecond
+    float vel[AXIS_MAX] = {0.0f};
+    // Commanded targets
+    int32_t target[AXIS_MAX] = {0};
+    // Target is known
+    bool target_valid[AXIS_MAX] = {false};
+};
+
+#endif
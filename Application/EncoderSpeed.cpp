@@ -0,0 +1,135 @@
+//******************************************************************************
+//  @file EncoderSpeed.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details EncoderSpeed: handwheel speed estimator and acceleration curves,
+//           implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "EncoderSpeed.h"
+
+// *****************************************************************************
+// ***   Public: AddClicks   ***************************************************
+// *****************************************************************************
+void EncoderSpeed::AddClicks(uint32_t time_ms, int32_t clicks)
+{
+  if(clicks != 0)
+  {
+    // Speed in new direction have nothing to do with old clicks
+    int32_t new_dir = (clicks > 0) ? 1 : -1;
+    if(new_dir != dir)
+    {
+      dir = new_dir;
+      cnt = 0u;
+    }
+
+    // Save timestamp for every click
+    uint32_t n = (clicks > 0) ? clicks : -clicks;
+    for(uint32_t i = 0u; i < n; i++)
+    {
+      head = (head + 1u) & (ENCODER_SPEED_RING_SIZE - 1u);
+      click_ms[head] = time_ms;
+      if(cnt < ENCODER_SPEED_RING_SIZE) cnt++;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Public: GetSpeed   ****************************************************
+// *****************************************************************************
+uint32_t EncoderSpeed::GetSpeed(uint32_t time_ms)
+{
+  uint32_t speed = 0u;
+
+  // Time since the newest click
+  uint32_t idle_ms = time_ms - click_ms[head];
+
+  // At least two clicks needed and handwheel shouldn't be stopped
+  if((cnt >= 2u) && (idle_ms < ENCODER_SPEED_TIMEOUT_MS))
+  {
+    // Find the oldest click inside the window. Previous click is always
+    // used, so slow rotation with one click per window still has a speed.
+    uint32_t clicks = 1u;
+    uint32_t oldest_ms = click_ms[(head - 1u) & (ENCODER_SPEED_RING_SIZE - 1u)];
+    for(uint32_t i = 2u; i < cnt; i++)
+    {
+      uint32_t t = click_ms[(head - i) & (ENCODER_SPEED_RING_SIZE - 1u)];
+      if(time_ms - t > ENCODER_SPEED_WINDOW_MS) break;
+      oldest_ms = t;
+      clicks = i;
+    }
+
+    // Average speed over the window. Clicks are timestamped with 1 ms
+    // resolution, so few clicks may share the same timestamp.
+    uint32_t span_ms = click_ms[head] - oldest_ms;
+    if(span_ms == 0u) span_ms = 1u;
+    speed = clicks * 1000u / span_ms;
+
+    // If next click is late, handwheel slows down: speed can't be more than
+    // one click per time passed since the last click
+    if((idle_ms != 0u) && (idle_ms > span_ms / clicks) && (speed > 1000u / idle_ms))
+    {
+      speed = 1000u / idle_ms;
+    }
+  }
+
+  // Return result
+  return speed;
+}
+
+// *****************************************************************************
+// ***   Public: GetGain   *****************************************************
+// *****************************************************************************
+uint32_t EncoderSpeed::GetGain(Curve curve, uint32_t speed)
+{
+  uint32_t gain = ENCODER_GAIN_SCALE;
+
+  if((curve == CURVE_EXPONENTIAL) && (speed > ENCODER_EXP_START_SPEED))
+  {
+    uint32_t delta = speed - ENCODER_EXP_START_SPEED;
+    // Double gain for every full step
+    while((delta >= ENCODER_EXP_DOUBLING_SPEED) && (gain < ENCODER_GAIN_MAX))
+    {
+      gain *= 2u;
+      delta -= ENCODER_EXP_DOUBLING_SPEED;
+    }
+    // Interpolate inside the step to avoid jumps
+    gain += gain * delta / ENCODER_EXP_DOUBLING_SPEED;
+  }
+  else if((curve == CURVE_DETENT) && (speed > ENCODER_DETENT_SPEED))
+  {
+    gain += (speed - ENCODER_DETENT_SPEED) * ENCODER_DETENT_SLOPE;
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+
+  // Limit gain
+  if(gain > ENCODER_GAIN_MAX) gain = ENCODER_GAIN_MAX;
+
+  // Return result
+  return gain;
+}
+
+// *****************************************************************************
+// ***   Public: GetCurveName   ************************************************
+// *****************************************************************************
+const char* EncoderSpeed::GetCurveName(Curve curve)
+{
+  static const char* const names[CURVE_CNT] = {"linear", "exponential", "detent"};
+  return (curve < CURVE_CNT) ? names[curve] : "";
+}
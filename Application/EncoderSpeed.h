@@ -0,0 +1,107 @@
+//******************************************************************************
+//  @file EncoderSpeed.h
+//  @author Nicolai Shlapunov
+//
+//  @details EncoderSpeed: handwheel speed estimator and acceleration curves,
+//           header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef EncoderSpeed_h
+#define EncoderSpeed_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Number of click timestamps to keep, must be power of two
+#define ENCODER_SPEED_RING_SIZE 32u
+// Sliding window to average speed over
+#define ENCODER_SPEED_WINDOW_MS 100u
+// Handwheel considered stopped if there no clicks for this time
+#define ENCODER_SPEED_TIMEOUT_MS 500u
+
+// Gain returned by curves is multiplied by this value: 100 is 1x
+#define ENCODER_GAIN_SCALE 100u
+// Maximum gain for exponential & detent curves: 10x
+#define ENCODER_GAIN_MAX 1000u
+// Exponential curve: speed in clicks per second where acceleration starts
+#define ENCODER_EXP_START_SPEED 20u
+// Exponential curve: speed increase in clicks per second that doubles gain
+#define ENCODER_EXP_DOUBLING_SPEED 50u
+// Detent curve: maximum speed in clicks per second of turning detent by detent
+#define ENCODER_DETENT_SPEED 10u
+// Detent curve: gain increase per each click per second above detent speed
+#define ENCODER_DETENT_SLOPE 4u
+
+// *****************************************************************************
+// ***   EncoderSpeed Class   **************************************************
+// *****************************************************************************
+class EncoderSpeed
+{
+  public:
+    // Acceleration curves to map handwheel speed to jog distance and feed
+    enum Curve
+    {
+      CURVE_LINEAR,      // No acceleration: one click is always one step
+      CURVE_EXPONENTIAL, // Gain doubles every ENCODER_EXP_DOUBLING_SPEED
+      CURVE_DETENT,      // One step per detent on slow rotation, then linear
+      CURVE_CNT
+    };
+
+    // *************************************************************************
+    // ***   Public: AddClicks   ***********************************************
+    // *************************************************************************
+    // Should be called when encoder clicks received. Clicks in one call share
+    // the same timestamp.
+    void AddClicks(uint32_t time_ms, int32_t clicks);
+
+    // *************************************************************************
+    // ***   Public: GetSpeed   ************************************************
+    // *************************************************************************
+    // Return speed in clicks per second at the given time. Speed decreases if
+    // next click is late and becomes zero when handwheel stops.
+    uint32_t GetSpeed(uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Public: Reset   ***************************************************
+    // *************************************************************************
+    void Reset() {cnt = 0u;}
+
+    // *************************************************************************
+    // ***   Public: GetGain   *************************************************
+    // *************************************************************************
+    // Return gain multiplied by ENCODER_GAIN_SCALE for speed in clicks per second
+    static uint32_t GetGain(Curve curve, uint32_t speed);
+
+    // *************************************************************************
+    // ***   Public: GetCurveName   ********************************************
+    // *************************************************************************
+    static const char* GetCurveName(Curve curve);
+
+  private:
+    // Click timestamps ring
+    uint32_t click_ms[ENCODER_SPEED_RING_SIZE] = {0u};
+    // Index of the newest click
+    uint32_t head = 0u;
+    // Number of clicks in ring
+    uint32_t cnt = 0u;
+    // Direction of the last clicks
+    int32_t dir = 0;
+};
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "fatfs.h"
 #include <cctype> // For tolower()
+#include <cmath>  // For sqrtf()
 
 // *****************************************************************************
 // ***   Get Instance   ********************************************************
@@ -39,11 +40,13 @@ GCodeGeneratorScr& GCodeGeneratorScr::GetInstance()
 Result GCodeGeneratorScr::Setup(int32_t y, int32_t height)
 {
   // Tabs for screens
-  tabs.SetParams(0, y, DisplayDrv::GetInstance().GetScreenW(), 40, 2u);
+  tabs.SetParams(0, y, DisplayDrv::GetInstance().GetScreenW(), 40, 3u);
   // Current loaded script tab
   tabs.SetText(0u, "----", nullptr, Font_10x18::GetInstance());
   // Scripts tab
   tabs.SetText(1u, "Scripts", nullptr, Font_10x18::GetInstance());
+  // Preview tab
+  tabs.SetText(2u, "Preview", nullptr, Font_10x18::GetInstance());
   // Set callback
   tabs.SetCallback(AppTask::GetCurrent());
 
@@ -60,6 +63,15 @@ Result GCodeGeneratorScr::Setup(int32_t y, int32_t height)
   // Set number of items in menu
   menu.SetCount(0);
 
+  // Setup preview text box in the same area as menu
+  preview_box.Setup(0, y + tabs.GetHeight(), display_drv.GetScreenW(), height - Font_8x12::GetInstance().GetCharH() * 2u - BORDER_W * 2 - tabs.GetHeight());
+  // Preview summary strings below menu
+  for(uint32_t i = 0u; i < NumberOf(preview_str); i++)
+  {
+    preview_str_buf[i][0] = '\0';
+    preview_str[i].SetParams(preview_str_buf[i], BORDER_W, y + height - Font_8x12::GetInstance().GetCharH() * (2u - i) - BORDER_W, COLOR_WHITE, Font_8x12::GetInstance());
+  }
+
   // All good
   return Result::RESULT_OK;
 }
@@ -79,6 +91,8 @@ Result GCodeGeneratorScr::Show()
   if(p_text == nullptr) tabs.SetSelectedTab(1u);
   // Call Process callback to redraw files or parameters
   ProcessCallback(&tabs);
+  // Axis position may be changed - request preview for the loaded script
+  if(p_text != nullptr) RequestPreview();
 
   // All good
   return Result::RESULT_OK;
@@ -96,8 +110,13 @@ Result GCodeGeneratorScr::Hide()
   change_box.Hide();
   // Hide menu
   menu.Hide();
+  // Hide preview
+  preview_box.Hide();
+  for(uint32_t i = 0u; i < NumberOf(preview_str); i++) preview_str[i].Hide();
   // Show tabs
   tabs.Hide();
+  // Drop pending preview request
+  preview_timer = -1;
 
   // All good
   return Result::RESULT_OK;
@@ -108,6 +127,21 @@ Result GCodeGeneratorScr::Hide()
 // *****************************************************************************
 Result GCodeGeneratorScr::TimerExpired(uint32_t interval)
 {
+  // Touch scrolling of menu and preview
+  menu.ProcessGestures();
+  preview_box.ProcessGestures();
+
+  // If preview requested - wait until parameters stop changing before run it
+  if(preview_timer >= 0)
+  {
+    preview_timer -= (int32_t)interval;
+    // Time to run preview
+    if(preview_timer < 0)
+    {
+      RunPreview();
+    }
+  }
+
   // Return ok - we don't check semaphore give error, because we don't need to.
   return Result::RESULT_OK;
 }
@@ -219,6 +253,8 @@ Result GCodeGeneratorScr::ProcessMenuOkCallback(GCodeGeneratorScr* obj_ptr, void
             ths.interpreter.SetGlobalVariableValue(idx, var_val);
             // Update strings on display
             ths.UpdateMenuStrings();
+            // Update preview for new value
+            ths.RequestPreview();
           }
           else
           {
@@ -327,6 +363,11 @@ Result GCodeGeneratorScr::ProcessMenuOkCallback(GCodeGeneratorScr* obj_ptr, void
             ths.tabs.SetSelectedTab(0u);
             // We don't need this data pointer - it will allocate again before execution
             ProgramSender::GetInstance().ReleaseDataPointer();
+            // Previews of previous script aren't valid anymore
+            ths.ClearPreview();
+            // Show preview strings and request preview for default values
+            for(uint32_t i = 0u; i < NumberOf(ths.preview_str); i++) ths.preview_str[i].Show(100);
+            ths.RequestPreview();
           }
           else
           {
@@ -389,6 +430,8 @@ Result GCodeGeneratorScr::ProcessMenuCancelCallback(GCodeGeneratorScr* obj_ptr,
       {
         ths.interpreter.ResetGlobalVariableValue(idx);
         ths.UpdateMenuStrings();
+        // Update preview for default value
+        ths.RequestPreview();
       }
     }
     else
@@ -415,6 +458,10 @@ Result GCodeGeneratorScr::ProcessCallback(const void* ptr)
   // Process tabs
   if(ptr == &tabs)
   {
+    // Preview shown only for loaded script
+    preview_box.Hide();
+    for(uint32_t i = 0u; i < NumberOf(preview_str); i++) preview_str[i].Hide();
+
     // If "Scripts" tab is selected
     if(tabs.GetSelectedTab() == 1u)
     {
@@ -502,6 +549,15 @@ Result GCodeGeneratorScr::ProcessCallback(const void* ptr)
       // Show menu
       menu.Show(100);
     }
+    // If "Preview" tab is selected
+    else if((tabs.GetSelectedTab() == 2u) && (p_text != nullptr))
+    {
+      menu.Hide();
+      // Show first lines of the result
+      UpdatePreview();
+      preview_box.Show(100);
+      for(uint32_t i = 0u; i < NumberOf(preview_str); i++) preview_str[i].Show(100);
+    }
     else
     {
       // If we have program text(prescan successful)
@@ -511,6 +567,8 @@ Result GCodeGeneratorScr::ProcessCallback(const void* ptr)
         UpdateMenuStrings();
         menu.Show(100);
         tabs.SetSelectedTab(0u);
+        // Show preview summary below menu
+        for(uint32_t i = 0u; i < NumberOf(preview_str); i++) preview_str[i].Show(100);
       }
       else // otherwise hide menu
       {
@@ -528,6 +586,8 @@ Result GCodeGeneratorScr::ProcessCallback(const void* ptr)
       interpreter.SetGlobalVariableValue(change_box.GetId(), change_box.GetValue());
       // Update strings on display
       UpdateMenuStrings();
+      // Update preview for new value
+      RequestPreview();
     }
   }
   // Process message box with an error
@@ -590,6 +650,363 @@ void GCodeGeneratorScr::UpdateMenuStrings(void)
   }
 }
 
+// *****************************************************************************
+// ***   Private: RequestPreview function   ************************************
+// *****************************************************************************
+void GCodeGeneratorScr::RequestPreview()
+{
+  // Check if we already have result for these parameters
+  Preview* preview = FindPreview(GetParametersHash());
+  // If result found - show it right away
+  if(preview != nullptr)
+  {
+    p_preview = preview;
+    preview_timer = -1;
+    UpdatePreview();
+  }
+  else // Otherwise restart delay, so script runs only after user stops changing parameters
+  {
+    preview_timer = PREVIEW_DELAY_MS;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: RunPreview function   ****************************************
+// *****************************************************************************
+void GCodeGeneratorScr::RunPreview()
+{
+  // We can run script only if it is loaded
+  if(p_text != nullptr)
+  {
+    // Script execution blocks the task, so run it only in IDLE or UNKNOWN state
+    if((grbl_comm.GetState() == GrblComm::IDLE) || (grbl_comm.GetState() == GrblComm::UNKNOWN))
+    {
+      uint32_t hash = GetParametersHash();
+      // Replace oldest entry
+      Preview& preview = preview_cache[preview_next];
+      preview_next = (preview_next + 1u) % NumberOf(preview_cache);
+      preview.valid = false;
+
+      // Get maximum available block size from FreeRTOS and use it. We can't use
+      // ProgramSender buffer since it can hold previously generated program.
+      HeapStats_t HeapStats;
+      vPortGetHeapStats(&HeapStats);
+      uint32_t size = (HeapStats.xSizeOfLargestFreeBlockInBytes > 32u) ? HeapStats.xSizeOfLargestFreeBlockInBytes - 32u : 0u;
+      // Allocate buffer for the result
+      char* txt = (size > 0u) ? new(std::nothrow) char[size] : nullptr;
+
+      // Set output buffer and if successful(allocation can fail)
+      if((txt != nullptr) && interpreter.SetOutputBuf(txt, size))
+      {
+        // Script can change global variables, so save them before execution
+        uint32_t n = interpreter.GetGlobalVariablesCnt();
+        for(uint32_t i = 0u; (i < n) && (i < NumberOf(preview_vars)); i++)
+        {
+          interpreter.GetGlobalVariableValue(i, preview_vars[i]);
+        }
+        // Generate GCode and analyze it
+        preview.ok = interpreter.Execute();
+        AnalyzeResult(preview, txt);
+        // Restore global variables
+        for(uint32_t i = 0u; (i < n) && (i < NumberOf(preview_vars)); i++)
+        {
+          interpreter.SetGlobalVariableValue(i, preview_vars[i]);
+        }
+        // Save hash to find this result later
+        preview.hash = hash;
+        preview.valid = true;
+        p_preview = &preview;
+      }
+      else
+      {
+        // No result to show
+        p_preview = nullptr;
+      }
+      // Clear output buffer before release memory
+      interpreter.SetOutputBuf(nullptr, 0);
+      // Release buffer
+      delete[] txt;
+
+      // Show result
+      UpdatePreview();
+      // Show error if we can't run script
+      if(p_preview == nullptr)
+      {
+        snprintf(preview_str_buf[0u], NumberOf(preview_str_buf[0u]), "Preview: not enough memory");
+        preview_str[0u].SetString(preview_str_buf[0u], true);
+      }
+    }
+    else
+    {
+      // Try again later
+      preview_timer = PREVIEW_DELAY_MS;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: ClearPreview function   **************************************
+// *****************************************************************************
+void GCodeGeneratorScr::ClearPreview()
+{
+  // Invalidate all memoized results
+  for(uint32_t i = 0u; i < NumberOf(preview_cache); i++)
+  {
+    preview_cache[i].valid = false;
+  }
+  preview_next = 0u;
+  p_preview = nullptr;
+  preview_timer = -1;
+  // Clear preview on display
+  UpdatePreview();
+}
+
+// *****************************************************************************
+// ***   Private: UpdatePreview function   *************************************
+// *****************************************************************************
+void GCodeGeneratorScr::UpdatePreview()
+{
+  // Clear summary strings
+  preview_str_buf[0u][0u] = '\0';
+  preview_str_buf[1u][0u] = '\0';
+
+  // If there is no result
+  if(p_preview == nullptr)
+  {
+    preview_box.SetText("; No preview");
+  }
+  else if(p_preview->ok == false) // If script failed - show error
+  {
+    preview_box.SetText(p_preview->text);
+    snprintf(preview_str_buf[0u], NumberOf(preview_str_buf[0u]), "Error: %s", p_preview->text);
+    // Leave only the first line of an error
+    for(uint32_t i = 0u; i < NumberOf(preview_str_buf[0u]); i++)
+    {
+      if((preview_str_buf[0u][i] == '\n') || (preview_str_buf[0u][i] == '\r')) preview_str_buf[0u][i] = '\0';
+      if(preview_str_buf[0u][i] == '\0') break;
+    }
+  }
+  else
+  {
+    char val_str[3u][16u];
+    // Lines count and path length
+    grbl_comm.ValueToStringWithScaler(val_str[0u], NumberOf(val_str[0u]), p_preview->path, 1000);
+    snprintf(preview_str_buf[0u], NumberOf(preview_str_buf[0u]), "Lines: %lu Path: %s", p_preview->lines, val_str[0u]);
+    // Bounding box
+    static const char axis_name[3u] = {'X', 'Y', 'Z'};
+    uint32_t len = 0u;
+    for(uint32_t i = 0u; i < NumberOf(axis_name); i++)
+    {
+      if(p_preview->axes & (1u << i))
+      {
+        grbl_comm.ValueToStringWithScaler(val_str[1u], NumberOf(val_str[1u]), p_preview->min[i], 1000);
+        grbl_comm.ValueToStringWithScaler(val_str[2u], NumberOf(val_str[2u]), p_preview->max[i], 1000);
+        len += snprintf(&preview_str_buf[1u][len], NumberOf(preview_str_buf[1u]) - len, "%c:%s..%s ", axis_name[i], val_str[1u], val_str[2u]);
+        // Stop if string is full
+        if(len >= NumberOf(preview_str_buf[1u])) break;
+      }
+    }
+    // Show first lines of the result
+    preview_box.SetText(p_preview->text);
+  }
+
+  // Update strings on display
+  preview_str[0u].SetString(preview_str_buf[0u], true);
+  preview_str[1u].SetString(preview_str_buf[1u], true);
+}
+
+// *****************************************************************************
+// ***   Private: AnalyzeResult function   *************************************
+// *****************************************************************************
+void GCodeGeneratorScr::AnalyzeResult(Preview& preview, const char* txt)
+{
+  // Current position and flags if it is known
+  int32_t pos[3u] = {0};
+  bool known[3u] = {false};
+  // Absolute distance mode by default
+  bool absolute = true;
+  // Path length
+  float path = 0.0f;
+  // Position in preview text
+  uint32_t text_len = 0u;
+
+  // Clear result
+  preview.lines = 0u;
+  preview.path = 0;
+  preview.axes = 0u;
+  preview.text[0u] = '\0';
+
+  // If script failed - output buffer contains an error
+  if(preview.ok == false)
+  {
+    strncpy(preview.text, txt, NumberOf(preview.text));
+    preview.text[NumberOf(preview.text) - 1u] = '\0';
+  }
+  else
+  {
+    // Cycle for all lines
+    while(*txt != '\0')
+    {
+      // Find line length
+      uint32_t len = 0u;
+      while((txt[len] != '\0') && (txt[len] != '\n') && (txt[len] != '\r')) len++;
+
+      // Skip empty lines
+      if(len > 0u)
+      {
+        preview.lines++;
+        // Copy first lines to preview text, but not more than can fit on the screen
+        if(preview.lines <= PREVIEW_LINES)
+        {
+          uint32_t n = (len < PREVIEW_LINE_LEN) ? len : PREVIEW_LINE_LEN;
+          memcpy(&preview.text[text_len], txt, n);
+          text_len += n;
+          preview.text[text_len++] = '\n';
+          preview.text[text_len] = '\0';
+        }
+
+        // Target position
+        int32_t target[3u] = {pos[0u], pos[1u], pos[2u]};
+        uint8_t moved = 0u;
+        // Parse words in the line
+        for(uint32_t i = 0u; i < len; i++)
+        {
+          char c = toupper(txt[i]);
+          // Rest of the line is comment
+          if(c == ';') break;
+          // Skip comment in parentheses
+          if(c == '(')
+          {
+            while((i < len) && (txt[i] != ')')) i++;
+          }
+          // Distance mode
+          else if(c == 'G')
+          {
+            int32_t g = atoi(&txt[i + 1u]);
+            if(g == 90) absolute = true;
+            else if(g == 91) absolute = false;
+            else ; // Do nothing - MISRA rule
+          }
+          // Coordinates. Arcs counted as straight lines - it is enough for estimation.
+          else if((c == 'X') || (c == 'Y') || (c == 'Z'))
+          {
+            uint32_t axis = c - 'X';
+            // Convert number to thousandths of units
+            int32_t val = 0;
+            int32_t frac = 0;
+            bool neg = false;
+            uint32_t j = i + 1u;
+            if((j < len) && ((txt[j] == '-') || (txt[j] == '+'))) neg = (txt[j++] == '-');
+            while((j < len) && isdigit(txt[j])) val = val * 10 + (txt[j++] - '0');
+            if((j < len) && (txt[j] == '.'))
+            {
+              j++;
+              for(int32_t scaler = 100; (j < len) && isdigit(txt[j]); j++, scaler /= 10)
+              {
+                frac += (txt[j] - '0') * scaler;
+              }
+            }
+            val = val * 1000 + frac;
+            if(neg) val = -val;
+            // Relative move starts from position where program starts
+            target[axis] = absolute ? val : target[axis] + val;
+            moved |= 1u << axis;
+            // Continue from the last digit
+            i = j - 1u;
+          }
+          else
+          {
+            ; // Do nothing - MISRA rule
+          }
+        }
+
+        // If there was a move
+        if(moved)
+        {
+          float dist = 0.0f;
+          for(uint32_t axis = 0u; axis < NumberOf(pos); axis++)
+          {
+            if(moved & (1u << axis))
+            {
+              // Relative moves are known from the start
+              if(known[axis] || !absolute)
+              {
+                float delta = (float)(target[axis] - pos[axis]);
+                dist += delta * delta;
+              }
+              // First position of the axis - starting point of the box
+              if(!known[axis])
+              {
+                preview.min[axis] = absolute ? target[axis] : 0;
+                preview.max[axis] = preview.min[axis];
+                preview.axes |= 1u << axis;
+                known[axis] = true;
+              }
+              // Update bounding box
+              if(target[axis] < preview.min[axis]) preview.min[axis] = target[axis];
+              if(target[axis] > preview.max[axis]) preview.max[axis] = target[axis];
+            }
+          }
+          path += sqrtf(dist);
+          // Save new position
+          for(uint32_t axis = 0u; axis < NumberOf(pos); axis++) pos[axis] = target[axis];
+        }
+      }
+
+      // Skip line end characters
+      txt += len;
+      while((*txt == '\n') || (*txt == '\r')) txt++;
+    }
+    // Save path length
+    preview.path = (int32_t)path;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: FindPreview function   ***************************************
+// *****************************************************************************
+GCodeGeneratorScr::Preview* GCodeGeneratorScr::FindPreview(uint32_t hash)
+{
+  Preview* result = nullptr;
+  // Search memoized results
+  for(uint32_t i = 0u; i < NumberOf(preview_cache); i++)
+  {
+    if(preview_cache[i].valid && (preview_cache[i].hash == hash))
+    {
+      result = &preview_cache[i];
+      break;
+    }
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: GetParametersHash function   *********************************
+// *****************************************************************************
+uint32_t GCodeGeneratorScr::GetParametersHash()
+{
+  // FNV-1a hash
+  uint32_t hash = 2166136261u;
+  // Values script can depend on: all global variables, axis positions and X mode
+  uint32_t n = interpreter.GetGlobalVariablesCnt();
+  for(uint32_t i = 0u; i < n + 4u; i++)
+  {
+    int val = 0;
+    if(i < n)           interpreter.GetGlobalVariableValue(i, val);
+    else if(i < n + 3u) val = grbl_comm.GetAxisPosition(GrblComm::AXIS_X + (i - n));
+    else                val = grbl_comm.IsLatheDiameterMode();
+    // Hash all bytes of value
+    for(uint32_t j = 0u; j < sizeof(val); j++)
+    {
+      hash ^= (uint8_t)(val >> (j * 8u));
+      hash *= 16777619u;
+    }
+  }
+  // Return result
+  return hash;
+}
+
 // *****************************************************************************
 // ***   Private: AllocateDataBuffer   *****************************************
 // *****************************************************************************
@@ -626,6 +1043,8 @@ void GCodeGeneratorScr::ReleaseDataPointer()
   }
   // Clear program buffer
   interpreter.SetPgmBuffer(nullptr, 0);
+  // Previews aren't valid without script
+  ClearPreview();
   // Clear loaded script tab caption
   tabs.SetText(0u, "----", nullptr, Font_10x18::GetInstance());
   // Update free memory info
@@ -28,6 +28,7 @@
 #include "Menu.h"
 #include "MsgBox.h"
 #include "ChangeValueBox.h"
+#include "TextBox.h"
 
 #include "Little-C.h"
 
@@ -75,6 +76,29 @@ class GCodeGeneratorScr : public IScreen
   private:
     static const uint8_t BORDER_W = 4u;
 
+    // Delay after last parameter change before preview run
+    static const int32_t PREVIEW_DELAY_MS = 500;
+    // Number of result lines in preview
+    static const uint32_t PREVIEW_LINES = 10u;
+    // Maximum length of result line in preview
+    static const uint32_t PREVIEW_LINE_LEN = 48u;
+    // Number of memoized previews
+    static const uint32_t PREVIEW_CACHE_SIZE = 4u;
+
+    // Preview of the script result
+    typedef struct
+    {
+      bool valid;       // Entry contains result
+      bool ok;          // Script executed successfully
+      uint32_t hash;    // Hash of parameters used to generate result
+      uint32_t lines;   // Number of lines in result
+      int32_t path;     // Path length in thousandths of units
+      uint8_t axes;     // Bit mask of axes with valid bounding box
+      int32_t min[3u];  // Bounding box minimum in thousandths of units
+      int32_t max[3u];  // Bounding box maximum in thousandths of units
+      char text[PREVIEW_LINES * (PREVIEW_LINE_LEN + 1u) + 1u]; // First lines of result or error
+    } Preview;
+
     // Pointer to text buffer used if program loaded completely
     char* p_text = nullptr;
 
@@ -103,6 +127,22 @@ class GCodeGeneratorScr : public IScreen
     // Units for change_box
     char change_box_units_str[16u];
 
+    // Memoized previews
+    Preview preview_cache[PREVIEW_CACHE_SIZE];
+    // Index of preview entry to replace next
+    uint32_t preview_next = 0u;
+    // Preview currently shown
+    Preview* p_preview = nullptr;
+    // Time left before preview run, negative if preview isn't requested
+    int32_t preview_timer = -1;
+    // Global variables saved before preview run
+    int preview_vars[NUM_VARS];
+    // Text box to show first lines of result
+    TextBox preview_box;
+    // Strings to show preview summary
+    Dirty<String> preview_str[2u];
+    char preview_str_buf[2u][64u];
+
     // *************************************************************************
     // *************************************************************************
     // *************************************************************************
@@ -127,6 +167,41 @@ class GCodeGeneratorScr : public IScreen
     // *************************************************************************
     void UpdateMenuStrings();
 
+    // *************************************************************************
+    // ***   Private: RequestPreview   *****************************************
+    // *************************************************************************
+    void RequestPreview();
+
+    // *************************************************************************
+    // ***   Private: RunPreview   *********************************************
+    // *************************************************************************
+    void RunPreview();
+
+    // *************************************************************************
+    // ***   Private: ClearPreview   *******************************************
+    // *************************************************************************
+    void ClearPreview();
+
+    // *************************************************************************
+    // ***   Private: UpdatePreview   ******************************************
+    // *************************************************************************
+    void UpdatePreview();
+
+    // *************************************************************************
+    // ***   Private: AnalyzeResult   ******************************************
+    // *************************************************************************
+    void AnalyzeResult(Preview& preview, const char* txt);
+
+    // *************************************************************************
+    // ***   Private: FindPreview   ********************************************
+    // *************************************************************************
+    Preview* FindPreview(uint32_t hash);
+
+    // *************************************************************************
+    // ***   Private: GetParametersHash   **************************************
+    // *************************************************************************
+    uint32_t GetParametersHash();
+
     // *************************************************************************
     // ***   Private: AllocateDataBuffer   *************************************
     // *************************************************************************
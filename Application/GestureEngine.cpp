@@ -0,0 +1,217 @@
+//******************************************************************************
+//  @file GestureEngine.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details GestureEngine: touch gesture recognizer, implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "GestureEngine.h"
+
+#include <cmath>  // For expf() & sqrtf()
+
+// *****************************************************************************
+// ***   Public: Process   *****************************************************
+// *****************************************************************************
+void GestureEngine::Process(const Sample& sample)
+{
+  if(sample.event == TOUCH)
+  {
+    Touch(sample.time_ms, sample.x, sample.y);
+  }
+  else if(sample.event == MOVE)
+  {
+    Move(sample.time_ms, sample.x, sample.y);
+  }
+  else
+  {
+    Move(sample.time_ms, sample.x, sample.y);
+    Release(sample.time_ms);
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Touch   *******************************************************
+// *****************************************************************************
+void GestureEngine::Touch(uint32_t time_ms, int32_t x, int32_t y)
+{
+  // Touch during fling only stops content
+  caught = (state == FLING);
+  state = PRESSED;
+  start_x = x;
+  start_y = y;
+  last_x = x;
+  last_y = y;
+  last_ms = time_ms;
+  move_ms = time_ms;
+  vx = 0.0f;
+  vy = 0.0f;
+}
+
+// *****************************************************************************
+// ***   Public: Move   ********************************************************
+// *****************************************************************************
+void GestureEngine::Move(uint32_t time_ms, int32_t x, int32_t y)
+{
+  // Position matters only while finger is down
+  if((state == PRESSED) || (state == DRAG))
+  {
+    int32_t dx = x - last_x;
+    int32_t dy = y - last_y;
+    // Few samples can share the same timestamp
+    uint32_t dt = time_ms - last_ms;
+    if(dt == 0u) dt = 1u;
+
+    // Filter velocity. Weight of the new sample depends on time since previous
+    // one, so result is the same for any sample rate. Samples without move
+    // slow velocity down as well.
+    float k = 1.0f - expf(-(float)dt / GESTURE_VELOCITY_TAU_MS);
+    vx += k * ((float)dx * 1000.0f / (float)dt - vx);
+    vy += k * ((float)dy * 1000.0f / (float)dt - vy);
+
+    if((dx != 0) || (dy != 0)) move_ms = time_ms;
+
+    if(state == PRESSED)
+    {
+      // Finger moved far enough - start drag. Content catches up with the
+      // finger, so slop distance isn't lost.
+      if((x - start_x > GESTURE_DRAG_SLOP_PX) || (start_x - x > GESTURE_DRAG_SLOP_PX) ||
+         (y - start_y > GESTURE_DRAG_SLOP_PX) || (start_y - y > GESTURE_DRAG_SLOP_PX))
+      {
+        state = DRAG;
+        acc_x += (float)(x - start_x);
+        acc_y += (float)(y - start_y);
+      }
+    }
+    else
+    {
+      acc_x += (float)dx;
+      acc_y += (float)dy;
+    }
+
+    last_x = x;
+    last_y = y;
+    last_ms = time_ms;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Release   *****************************************************
+// *****************************************************************************
+void GestureEngine::Release(uint32_t time_ms)
+{
+  if(state == PRESSED)
+  {
+    // Finger didn't move - tap, unless it just stopped fling
+    if(!caught)
+    {
+      tap = true;
+      tap_x = start_x;
+      tap_y = start_y;
+    }
+    state = IDLE;
+  }
+  else if(state == DRAG)
+  {
+    // Finger stopped before release - no fling
+    float speed = sqrtf(vx * vx + vy * vy);
+    if((time_ms - move_ms <= GESTURE_FLING_MAX_IDLE_MS) && (speed >= GESTURE_FLING_MIN_SPEED))
+    {
+      state = FLING;
+      last_ms = time_ms;
+    }
+    else
+    {
+      state = IDLE;
+      vx = 0.0f;
+      vy = 0.0f;
+    }
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+  caught = false;
+}
+
+// *****************************************************************************
+// ***   Public: Update   ******************************************************
+// *****************************************************************************
+void GestureEngine::Update(uint32_t time_ms)
+{
+  if(state == FLING)
+  {
+    uint32_t dt = time_ms - last_ms;
+    if(dt != 0u)
+    {
+      // Exponential deceleration. Distance is an integral of velocity over
+      // the period, so it doesn't depend on how often Update() is called.
+      float k = expf(-(float)dt / GESTURE_FLING_TAU_MS);
+      acc_x += vx * (GESTURE_FLING_TAU_MS / 1000.0f) * (1.0f - k);
+      acc_y += vy * (GESTURE_FLING_TAU_MS / 1000.0f) * (1.0f - k);
+      vx *= k;
+      vy *= k;
+      last_ms = time_ms;
+
+      // Stop when content barely moves
+      if(sqrtf(vx * vx + vy * vy) < GESTURE_FLING_STOP_SPEED)
+      {
+        state = IDLE;
+        vx = 0.0f;
+        vy = 0.0f;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Public: TakeDelta   ***************************************************
+// *****************************************************************************
+void GestureEngine::TakeDelta(int32_t& dx, int32_t& dy)
+{
+  dx = (int32_t)acc_x;
+  dy = (int32_t)acc_y;
+  acc_x -= (float)dx;
+  acc_y -= (float)dy;
+}
+
+// *****************************************************************************
+// ***   Public: TakeTap   *****************************************************
+// *****************************************************************************
+bool GestureEngine::TakeTap(int32_t& x, int32_t& y)
+{
+  bool result = tap;
+  if(tap)
+  {
+    x = tap_x;
+    y = tap_y;
+    tap = false;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Stop   ********************************************************
+// *****************************************************************************
+void GestureEngine::Stop()
+{
+  state = IDLE;
+  vx = 0.0f;
+  vy = 0.0f;
+  acc_x = 0.0f;
+  acc_y = 0.0f;
+  tap = false;
+  caught = false;
+}
@@ -0,0 +1,169 @@
+//******************************************************************************
+//  @file GestureEngine.h
+//  @author Nicolai Shlapunov
+//
+//  @details GestureEngine: touch gesture recognizer, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef GestureEngine_h
+#define GestureEngine_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Finger have to move more than this distance to start drag, shorter move is
+// a tap
+#define GESTURE_DRAG_SLOP_PX 8
+// Time constant of velocity filter
+#define GESTURE_VELOCITY_TAU_MS 40.0f
+// Minimum velocity on release to start fling, pixels per second
+#define GESTURE_FLING_MIN_SPEED 150.0f
+// Finger should move not earlier than this time before release to start fling
+#define GESTURE_FLING_MAX_IDLE_MS 60u
+// Time constant of fling deceleration
+#define GESTURE_FLING_TAU_MS 325.0f
+// Fling stops when velocity drops below this value, pixels per second
+#define GESTURE_FLING_STOP_SPEED 15.0f
+
+// *****************************************************************************
+// ***   GestureEngine Class   *************************************************
+// *****************************************************************************
+// Recognizes tap, drag and fling from raw touch samples. All filters are based
+// on time between samples, so result doesn't depend on touch sample rate.
+// Pure C++ without HAL or RTOS calls, so it can be checked on the host.
+class GestureEngine
+{
+  public:
+    // Gesture states
+    enum State
+    {
+      IDLE,    // No touch and no motion
+      PRESSED, // Finger is down, but didn't move far enough to start drag
+      DRAG,    // Finger is dragging content
+      FLING    // Finger released, content moves by inertia
+    };
+
+    // Touch events
+    enum Event : uint8_t
+    {
+      TOUCH,   // Finger down
+      MOVE,    // Finger position while it is down
+      RELEASE  // Finger up
+    };
+
+    // Touch sample. Allows to pass samples from touch handler to the task that
+    // processes gestures.
+    typedef struct
+    {
+      uint32_t time_ms;
+      Event event;
+      int32_t x;
+      int32_t y;
+    } Sample;
+
+    // *************************************************************************
+    // ***   Public: Process   *************************************************
+    // *************************************************************************
+    // Pass sample to Touch(), Move() or Release(). Release moves finger to
+    // sample position first.
+    void Process(const Sample& sample);
+
+    // *************************************************************************
+    // ***   Public: Touch   ***************************************************
+    // *************************************************************************
+    // Finger down. Touch during fling stops it without tap.
+    void Touch(uint32_t time_ms, int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Public: Move   ****************************************************
+    // *************************************************************************
+    // Finger position while it is down
+    void Move(uint32_t time_ms, int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Public: Release   *************************************************
+    // *************************************************************************
+    // Finger up. Starts fling if finger moved fast enough before release.
+    void Release(uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Public: Update   **************************************************
+    // *************************************************************************
+    // Advance fling to the given time. Should be called periodically.
+    void Update(uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Public: TakeDelta   ***********************************************
+    // *************************************************************************
+    // Return whole pixels content moved since previous call, fractional part
+    // is kept for the next call
+    void TakeDelta(int32_t& dx, int32_t& dy);
+
+    // *************************************************************************
+    // ***   Public: TakeTap   *************************************************
+    // *************************************************************************
+    // Return true once after tap and position of it
+    bool TakeTap(int32_t& x, int32_t& y);
+
+    // *************************************************************************
+    // ***   Public: GetState   ************************************************
+    // *************************************************************************
+    State GetState() {return state;}
+
+    // *************************************************************************
+    // ***   Public: GetVelocity   *********************************************
+    // *************************************************************************
+    // Filtered velocity in pixels per second
+    float GetVelocityX() {return vx;}
+    float GetVelocityY() {return vy;}
+
+    // *************************************************************************
+    // ***   Public: Stop   ****************************************************
+    // *************************************************************************
+    // Stop any motion and drop not taken delta, i.e. when content is reset
+    void Stop();
+
+  private:
+    // Current state
+    State state = IDLE;
+    // Touch down position
+    int32_t start_x = 0;
+    int32_t start_y = 0;
+    // Last finger position
+    int32_t last_x = 0;
+    int32_t last_y = 0;
+    // Time of the last sample
+    uint32_t last_ms = 0u;
+    // Time of the last finger move
+    uint32_t move_ms = 0u;
+    // Filtered velocity, pixels per second
+    float vx = 0.0f;
+    float vy = 0.0f;
+    // Content movement not taken yet
+    float acc_x = 0.0f;
+    float acc_y = 0.0f;
+    // Touch stopped fling, so it can't be a tap
+    bool caught = false;
+    // Tap waiting to be taken
+    bool tap = false;
+    int32_t tap_x = 0;
+    int32_t tap_y = 0;
+};
+
+#endif
@@ -0,0 +1,174 @@
+//******************************************************************************
+//  @file GlyphCache.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details GlyphCache: User GlyphCache Class, implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "GlyphCache.h"
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+GlyphCache& GlyphCache::GetInstance()
+{
+  static GlyphCache glyph_cache;
+  return glyph_cache;
+}
+
+// *****************************************************************************
+// ***   Public: GetGlyph   ****************************************************
+// *****************************************************************************
+const GlyphCache::Glyph* GlyphCache::GetGlyph(Font& font, uint32_t scale, char c)
+{
+  Glyph* result = nullptr;
+  // Least recently used entry
+  Glyph* lru = &glyphs[0u];
+
+  // Increase use counter
+  use_cnt++;
+
+  // Search glyph in cache
+  for(uint32_t i = 0u; i < NumberOf(glyphs); i++)
+  {
+    if((glyphs[i].font == &font) && (glyphs[i].scale == scale) && (glyphs[i].c == c))
+    {
+      result = &glyphs[i];
+      break;
+    }
+    // Empty entry or entry that wasn't used longer
+    if((glyphs[i].font == nullptr) || ((lru->font != nullptr) && (glyphs[i].used < lru->used)))
+    {
+      lru = &glyphs[i];
+    }
+  }
+
+  // If glyph found
+  if(result != nullptr)
+  {
+    hit_cnt++;
+  }
+  else if(IsCacheable(c) && IsCacheable(font, scale)) // Otherwise render it in place of least recently used one
+  {
+    miss_cnt++;
+    // Glyph that can't be cached stays in cache too, so it will not be rendered
+    // again on every line
+    RenderGlyph(*lru, font, scale, c);
+    result = lru;
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+
+  // Update use counter for found glyph
+  if(result != nullptr)
+  {
+    result->used = use_cnt;
+    // Glyph can't be cached
+    if(result->h == 0u) result = nullptr;
+  }
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: DrawGlyphLine   ***********************************************
+// *****************************************************************************
+void GlyphCache::DrawGlyphLine(const Glyph& glyph, color_t* buf, int32_t n, int32_t line, int32_t x, color_t color)
+{
+  // Draw only if line belongs to glyph
+  if((line >= 0) && (line < glyph.h))
+  {
+    const uint8_t* spans = glyph.spans[line];
+    // Fill all spans of line, clipped by buffer
+    for(uint32_t i = 0u; i < spans[0u]; i++)
+    {
+      int32_t start = x + spans[1u + i * 2u];
+      int32_t end = start + spans[2u + i * 2u];
+      if(start < 0) start = 0;
+      if(end > n) end = n;
+      for(int32_t j = start; j < end; j++) buf[j] = color;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: RenderGlyph   ************************************************
+// *****************************************************************************
+bool GlyphCache::RenderGlyph(Glyph& glyph, Font& font, uint32_t scale, char c)
+{
+  bool result = true;
+
+  // Setup string with one character. Font rendered by string itself, so
+  // glyph is exactly the same as string would draw.
+  str_buf[0u] = c;
+  str_buf[1u] = '\0';
+  str.SetParams(str_buf, 0, 0, COLOR_WHITE, font);
+  str.SetScale(scale);
+
+  // Check glyph size
+  if((str.GetWidth() > (int32_t)GLYPH_CACHE_MAX_W) || (str.GetHeight() > (int32_t)GLYPH_CACHE_MAX_H))
+  {
+    result = false;
+  }
+  else
+  {
+    glyph.w = str.GetWidth();
+    glyph.h = str.GetHeight();
+    // Render every line and convert it to spans
+    for(uint32_t line = 0u; (line < glyph.h) && result; line++)
+    {
+      // Clear line buffer and draw glyph line
+      for(uint32_t i = 0u; i < glyph.w; i++) line_buf[i] = COLOR_BLACK;
+      str.DrawInBufW(line_buf, glyph.w, line, 0);
+      // Find spans
+      uint8_t* spans = glyph.spans[line];
+      spans[0u] = 0u;
+      for(uint32_t i = 0u; (i < glyph.w) && result; i++)
+      {
+        if(line_buf[i] == COLOR_WHITE)
+        {
+          // If pixel continue previous span - increase its length
+          if((spans[0u] > 0u) && (spans[(spans[0u] - 1u) * 2u + 1u] + spans[(spans[0u] - 1u) * 2u + 2u] == i))
+          {
+            spans[(spans[0u] - 1u) * 2u + 2u]++;
+          }
+          else if(spans[0u] < GLYPH_CACHE_MAX_SPANS) // Otherwise start a new one
+          {
+            spans[spans[0u] * 2u + 1u] = i;
+            spans[spans[0u] * 2u + 2u] = 1u;
+            spans[0u]++;
+          }
+          else // Too many spans - glyph can't be cached
+          {
+            result = false;
+          }
+        }
+      }
+    }
+  }
+
+  // Fill key. If glyph can't be cached, mark it by zero height.
+  glyph.font = &font;
+  glyph.scale = scale;
+  glyph.c = c;
+  if(result == false) glyph.h = 0u;
+
+  // Return result
+  return result;
+}
@@ -0,0 +1,130 @@
+//******************************************************************************
+//  @file GlyphCache.h
+//  @author Nicolai Shlapunov
+//
+//  @details GlyphCache: User GlyphCache Class, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef GlyphCache_h
+#define GlyphCache_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Number of glyphs in cache: digits, '-' and '.' for one font
+#define GLYPH_CACHE_SIZE 12u
+// Maximum glyph width and height in pixels after scaling
+#define GLYPH_CACHE_MAX_W 32u
+#define GLYPH_CACHE_MAX_H 32u
+// Maximum number of pixel spans in one glyph line
+#define GLYPH_CACHE_MAX_SPANS 4u
+
+// *****************************************************************************
+// ***   GlyphCache Class   ****************************************************
+// *****************************************************************************
+class GlyphCache
+{
+  public:
+    // Glyph expanded to pixel spans
+    typedef struct
+    {
+      Font* font;       // Font of the glyph, nullptr if entry is empty
+      uint32_t scale;   // Scale of the glyph
+      char c;           // Character
+      uint32_t used;    // Last use counter value for LRU
+      uint8_t w;        // Width in pixels
+      uint8_t h;        // Height in pixels, zero if glyph can't be cached
+      uint8_t spans[GLYPH_CACHE_MAX_H][1u + GLYPH_CACHE_MAX_SPANS * 2u]; // Spans count, then start & length pairs
+    } Glyph;
+
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static GlyphCache& GetInstance();
+
+    // *************************************************************************
+    // ***   Public: IsCacheable   *********************************************
+    // *************************************************************************
+    static bool IsCacheable(char c) {return ((c >= '0') && (c <= '9')) || (c == '-') || (c == '.');}
+
+    // *************************************************************************
+    // ***   Public: IsCacheable   *********************************************
+    // *************************************************************************
+    static bool IsCacheable(Font& font, uint32_t scale) {return (font.GetCharW() * scale <= GLYPH_CACHE_MAX_W) && (font.GetCharH() * scale <= GLYPH_CACHE_MAX_H);}
+
+    // *************************************************************************
+    // ***   Public: GetGlyph   ************************************************
+    // *************************************************************************
+    const Glyph* GetGlyph(Font& font, uint32_t scale, char c);
+
+    // *************************************************************************
+    // ***   Public: DrawGlyphLine   *******************************************
+    // *************************************************************************
+    static void DrawGlyphLine(const Glyph& glyph, color_t* buf, int32_t n, int32_t line, int32_t x, color_t color);
+
+    // *************************************************************************
+    // ***   Public: SetEnabled   **********************************************
+    // *************************************************************************
+    // Disabled cache isn't used by objects, they draw strings directly
+    void SetEnabled(bool en) {enabled = en;}
+
+    // *************************************************************************
+    // ***   Public: IsEnabled   ***********************************************
+    // *************************************************************************
+    bool IsEnabled() {return enabled;}
+
+    // *************************************************************************
+    // ***   Public: GetHitCnt   ***********************************************
+    // *************************************************************************
+    uint32_t GetHitCnt() {return hit_cnt;}
+
+    // *************************************************************************
+    // ***   Public: GetMissCnt   **********************************************
+    // *************************************************************************
+    uint32_t GetMissCnt() {return miss_cnt;}
+
+  private:
+    // Cache enabled flag
+    bool enabled = true;
+    // Cached glyphs
+    Glyph glyphs[GLYPH_CACHE_SIZE];
+    // Use counter for LRU
+    uint32_t use_cnt = 0u;
+    // Statistic
+    uint32_t hit_cnt = 0u;
+    uint32_t miss_cnt = 0u;
+
+    // String to render glyphs
+    String str;
+    char str_buf[2u] = {0};
+    // Line buffer to render glyphs
+    color_t line_buf[GLYPH_CACHE_MAX_W];
+
+    // *************************************************************************
+    // ***   Private: RenderGlyph   ********************************************
+    // *************************************************************************
+    bool RenderGlyph(Glyph& glyph, Font& font, uint32_t scale, char c);
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    GlyphCache() {};
+};
+
+#endif
@@ -53,36 +53,39 @@ Result GraphDemo::Loop()
   snd_box.Move((display_drv.GetScreenW() - snd_box.GetWidth())/2, (display_drv.GetScreenH() - snd_box.GetHeight())/2);
   snd_box.Show(32768);
 
-  Circle circle1(150-30, 120+30, 30, COLOR_MAGENTA, true);
+  Dirty<Circle> circle1(150-30, 120+30, 30, COLOR_MAGENTA, true);
   circle1.Show(40);
 
-  Circle circle2(150, 120, 30, COLOR_BLUE);
+  Dirty<Circle> circle2(150, 120, 30, COLOR_BLUE);
   circle2.Show(50);
 
-  Line line1(46, 34, 96, 120, COLOR_GREEN);
+  Dirty<Line> line1(46, 34, 96, 120, COLOR_GREEN);
   line1.Show(30);
-  Line line2(46, 34, 110, 76, COLOR_CYAN);
+  Dirty<Line> line2(46, 34, 110, 76, COLOR_CYAN);
   line2.Show(30);
 
-  String str1("Hello World!", 0, 10, COLOR_MAGENTA, Font_4x6::GetInstance());
+  Dirty<String> str1("Hello World!", 0, 10, COLOR_MAGENTA, Font_4x6::GetInstance());
   str1.Show(70);
-  String str2("Hello World!", 0, 20, COLOR_CYAN, Font_6x8::GetInstance());
+  Dirty<String> str2("Hello World!", 0, 20, COLOR_CYAN, Font_6x8::GetInstance());
   str2.Show(80);
-  String str3("Hello World!", 0, 30, COLOR_YELLOW, Font_8x8::GetInstance());
+  Dirty<String> str3("Hello World!", 0, 30, COLOR_YELLOW, Font_8x8::GetInstance());
   str3.Show(90);
-  String str4("Hello World!", 0, 50, COLOR_GREEN, COLOR_MAGENTA, Font_6x8::GetInstance());
+  Dirty<String> str4("Hello World!", 0, 50, COLOR_GREEN, COLOR_MAGENTA, Font_6x8::GetInstance());
   str4.Show(100);
-  String str5("Hello World!", 0, 70, COLOR_RED, Font_10x18::GetInstance());
+  Dirty<String> str5("Hello World!", 0, 70, COLOR_RED, Font_10x18::GetInstance());
   str5.Show(110);
 
-  Box box1(0, 0, 100, 10, COLOR_RED, true);
+  Dirty<Box> box1(0, 0, 100, 10, COLOR_RED, true);
   box1.Show(10);
-  Box box2(100, 70, 20, 10, COLOR_YELLOW);
+  Dirty<Box> box2(100, 70, 20, 10, COLOR_YELLOW);
   box2.Show(20);
 
   static VisObjectRandomMover* pointer_list[60];
   uint32_t list_item_cnt = 0;
 
+  // Same directions every time for reproducible benchmark
+  srand(GRAPH_DEMO_BENCH_SEED);
+
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(circle1);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(circle2);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(line1);
@@ -102,6 +105,16 @@ Result GraphDemo::Loop()
 //  display_drv.SetUpdateMode(DisplayDrv::UPDATE_LEFT_RIGHT);
 //  display_drv.SetUpdateArea(display_drv.GetScreenW()/4, display_drv.GetScreenH()/4, display_drv.GetScreenW()/4*3, display_drv.GetScreenH()/4*3);
 
+  // Benchmark result string
+  char bench_str_buf[48u] = {" "};
+  Dirty<String> bench_str(bench_str_buf, 0, display_drv.GetScreenH() - Font_8x12::GetInstance().GetCharH(), COLOR_WHITE, Font_8x12::GetInstance());
+  bench_str.Show(32767);
+
+  // Benchmark counters
+  uint32_t frame_cnt = 0u;
+  uint32_t pixels = 0u;
+  uint32_t start_ms = RtosTick::GetTimeMs();
+
   // Infinite loop
   while (1)
   {
@@ -125,15 +138,35 @@ Result GraphDemo::Loop()
 //    area++;
 //    if(area + 40 >= 320) area = 0u;
 
+    // Start frame time measurement
+    DirtyRegions::GetInstance().StartFrame();
     // Lock Display
     if(display_drv.LockDisplay() == Result::RESULT_OK)
     {
       // Move all objects
       for(uint32_t i=0; i < list_item_cnt; i++) pointer_list[i]->Process();
+      // Count frames
+      frame_cnt++;
+      // If benchmark run is finished
+      if(frame_cnt >= GRAPH_DEMO_BENCH_FRAMES)
+      {
+        uint32_t time_ms = RtosTick::GetTimeMs() - start_ms;
+        if(time_ms == 0u) time_ms = 1u;
+        // Frames per second multiplied by 10 to show one decimal digit
+        uint32_t fps_x10 = frame_cnt * 10000u / time_ms;
+        bench_str.SetString(bench_str_buf, NumberOf(bench_str_buf), "FPS: %lu.%lu px/s: %lu", fps_x10 / 10u, fps_x10 % 10u, (uint32_t)((uint64_t)pixels * 1000u / time_ms));
+        // Start scripted animation from the beginning
+        for(uint32_t i=0; i < list_item_cnt; i++) pointer_list[i]->Reset();
+        frame_cnt = 0u;
+        pixels = 0u;
+        start_ms = RtosTick::GetTimeMs();
+      }
       // Unlock Display
       display_drv.UnlockDisplay();
-      // Update Display
-      display_drv.UpdateDisplay();
+      // Invalidate dirty regions and update display
+      DirtyRegions::GetInstance().EndFrame();
+      // Count pixels actually sent to the display
+      pixels += DirtyRegions::GetInstance().GetFramePixels();
       // Pause for switch to Display Task
       RtosTick::DelayTicks(1U);
     }
@@ -150,10 +183,25 @@ VisObjectRandomMover::VisObjectRandomMover(VisObject& obj) : object(obj)
   x_dir = 1 + rand()%6;
   y_dir = 1 + rand()%6;
   speed = 1;
+  // Save initial state
+  start_x = object.GetStartX();
+  start_y = object.GetStartY();
+  start_x_dir = x_dir;
+  start_y_dir = y_dir;
 }
 
 // *************************************************************************
-// ***   Constructor   *****************************************************
+// ***   Reset   ***********************************************************
+// *************************************************************************
+void VisObjectRandomMover::Reset(void)
+{
+  x_dir = start_x_dir;
+  y_dir = start_y_dir;
+  object.Move(start_x, start_y);
+}
+
+// *************************************************************************
+// ***   Process   *********************************************************
 // *************************************************************************
 void VisObjectRandomMover::Process(void)
 {
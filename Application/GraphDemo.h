@@ -22,6 +22,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "DirtyRegions.h"
 
 // *****************************************************************************
 // ***   Local const variables   ***********************************************
@@ -32,6 +33,14 @@
 // *****************************************************************************
 #define BG_Z (100)
 
+// Number of frames in one run of the scripted animation. After each run
+// benchmark shows FPS and pixels per second flushed by dirty regions and starts
+// again.
+#define GRAPH_DEMO_BENCH_FRAMES (500u)
+
+// Seed for objects directions: every run is the same animation
+#define GRAPH_DEMO_BENCH_SEED (12345u)
+
 // *****************************************************************************
 // ***   Application Class   ***************************************************
 // *****************************************************************************
@@ -76,16 +85,29 @@ class VisObjectRandomMover
     explicit VisObjectRandomMover(VisObject& obj);
 
     // *************************************************************************
-    // ***   Init Application Task   *******************************************
+    // ***   Process   *********************************************************
     // *************************************************************************
+    // Move object one step
     void Process(void);
-    
+
+    // *************************************************************************
+    // ***   Reset   ***********************************************************
+    // *************************************************************************
+    // Return object to initial position and direction
+    void Reset(void);
+
   private:
     VisObject& object;
     int8_t x_dir = 0;
     int8_t y_dir = 0;
     int8_t speed = 0;
 
+    // Initial position and direction
+    int32_t start_x = 0;
+    int32_t start_y = 0;
+    int8_t start_x_dir = 0;
+    int8_t start_y_dir = 0;
+
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
 };
@@ -106,6 +128,11 @@ class SoundControlBox : public Image
     // *************************************************************************
     virtual void Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy);
 
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false) {DirtyRegions::GetInstance().Invalidate(*this, force);}
+
   private:
     // Mute flag
     bool mute = false;
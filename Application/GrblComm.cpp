@@ -19,6 +19,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "GrblComm.h"
+#include "JogTrace.h"
 
 #include <cstring>
 #include <cstdlib>
@@ -84,6 +85,7 @@ Result GrblComm::TimerExpired(uint32_t missed_cnt)
   if(RtosTick::GetTimeMs() - status_rx_timestamp > 300u)
   {
     // Since there no status received, state is Unknown
+    if(grbl_state != UNKNOWN) SetChanged(CHG_STATE);
     grbl_state = UNKNOWN;
     // Set status_received to request status again
     status_received = true;
@@ -203,8 +205,17 @@ Result GrblComm::ProcessMessage()
     }
     else if(IsInControl() && !respond_pending)
     {
+      // Jog command queued before jog cancel - discard it, otherwise machine
+      // will continue to move after cancel
+      if((rcv_msg.id < jog_cancel_id) && (strncmp((const char*)rcv_msg.cmd, "$J=", 3u) == 0))
+      {
+        // Set ID
+        send_id = rcv_msg.id;
+        // Result ok, but not really
+        result = Result::RESULT_OK;
+      }
       // If previous command successful
-      if(grbl_status == Status_OK)
+      else if(grbl_status == Status_OK)
       {
         // Lock mutex before parsing data
         mutex.Lock();
@@ -220,6 +231,11 @@ Result GrblComm::ProcessMessage()
         strncpy((char*)tx_buf, (const char*)rcv_msg.cmd, NumberOf(tx_buf));
         // Send command
         result = uart->Write(tx_buf, strlen((char*)tx_buf));
+        // Jog latency trace: jog command transmission started
+        if(strncmp((const char*)tx_buf, "$J=", 3u) == 0)
+        {
+          JOG_TRACE(UART_TX);
+        }
 
 #if defined(SEND_DATA_TO_USB)
         // Send to USB
@@ -463,6 +479,26 @@ int32_t GrblComm::GetAxisMachinePosition(uint8_t axis)
   return value;
 }
 
+// *****************************************************************************
+// ***   Public: GetChanges function   *****************************************
+// *****************************************************************************
+uint32_t GrblComm::GetChanges(uint32_t (&cnt)[CHG_CNT])
+{
+  uint32_t changes = 0u;
+  // Counters written by GrblComm task only, 32-bit reads are atomic
+  for(uint32_t i = 0u; i < CHG_CNT; i++)
+  {
+    uint32_t val = change_cnt[i];
+    if(cnt[i] != val)
+    {
+      changes |= 1u << i;
+      cnt[i] = val;
+    }
+  }
+  // Return changes mask
+  return changes;
+}
+
 // *****************************************************************************
 // ***   Public: GetAxisPosition function   ************************************
 // *****************************************************************************
@@ -657,6 +693,22 @@ Result GrblComm::SendRealTimeCmd(uint8_t cmd)
   return SendTaskMessage(&msg, true);
 }
 
+// *****************************************************************************
+// ***   Public: JogCancel   ***************************************************
+// *****************************************************************************
+Result GrblComm::JogCancel()
+{
+  // Lock mutex before change ID
+  mutex.Lock();
+  // All jog commands queued before this point have to be discarded
+  jog_cancel_id = next_id;
+  // Release mutex
+  mutex.Release();
+
+  // Controller stops jog motion and flushes its own buffer
+  return SendRealTimeCmd(CMD_JOG_CANCEL);
+}
+
 // *****************************************************************************
 // ***   Public: UpdateStatus function   ***************************************
 // *****************************************************************************
@@ -686,7 +738,7 @@ void GrblComm::UpdateStatus()
 // *****************************************************************************
 // ***   Public: Jog   *********************************************************
 // *****************************************************************************
-Result GrblComm::Jog(uint8_t axis, int32_t distance, uint32_t feed_x100, bool is_absolute)
+Result GrblComm::Jog(uint8_t axis, int32_t distance, uint32_t feed_x100, bool is_absolute, uint32_t &id)
 {
   Result result = Result::ERR_BAD_PARAMETER;
 
@@ -711,6 +763,8 @@ Result GrblComm::Jog(uint8_t axis, int32_t distance, uint32_t feed_x100, bool is
 
       // Send message
       result = SendTaskMessage(&msg);
+      // Save ID
+      id = msg.id;
     }
     else
     {
@@ -762,7 +816,7 @@ Result GrblComm::JogInMachineCoodinates(uint8_t axis, int32_t distance, uint32_t
 // *****************************************************************************
 // ***   Public: JogMultiple   *************************************************
 // *****************************************************************************
-Result GrblComm::JogMultiple(int32_t distance_x, int32_t distance_y, int32_t distance_z, uint32_t feed_x100, bool is_absolute)
+Result GrblComm::JogMultiple(int32_t distance_x, int32_t distance_y, int32_t distance_z, uint32_t feed_x100, bool is_absolute, uint32_t &id)
 {
   Result result = Result::RESULT_OK;
 
@@ -800,6 +854,8 @@ Result GrblComm::JogMultiple(int32_t distance_x, int32_t distance_y, int32_t dis
 
     // Send message
     result = SendTaskMessage(&msg);
+    // Save ID
+    id = msg.id;
   }
   else
   {
@@ -1500,6 +1556,8 @@ void GrblComm::ParseOffsets(char* data)
 {
   grbl_changed.offset = ParseAxisData(data, grbl_offset);
   grbl_changed.await_wco_ok = grbl_awaitWCO;
+  // Work position depends on offset
+  if(grbl_changed.offset) SetChanged(CHG_POS);
 }
 
 // *****************************************************************************
@@ -1528,9 +1586,9 @@ void GrblComm::ParseOverrides(char* data)
   }
 
   // ParseInt check for nullptr, so can be called even if data only partially there
-  if(ParseInt(grbl_feed_override, value_ptr[0u])) grbl_changed.feed_override = true;
-  if(ParseInt(grbl_rapid_override, value_ptr[1u])) grbl_changed.rapid_override = true;
-  if(ParseInt(spindle_rpm_override, value_ptr[2u])) grbl_changed.rpm_override = true;
+  if(ParseInt(grbl_feed_override, value_ptr[0u])) {grbl_changed.feed_override = true; SetChanged(CHG_OVERRIDES);}
+  if(ParseInt(grbl_rapid_override, value_ptr[1u])) {grbl_changed.rapid_override = true; SetChanged(CHG_OVERRIDES);}
+  if(ParseInt(spindle_rpm_override, value_ptr[2u])) {grbl_changed.rpm_override = true; SetChanged(CHG_OVERRIDES);}
 }
 
 // *****************************************************************************
@@ -1559,15 +1617,16 @@ void GrblComm::ParseFeedSpeed(char* data)
   }
 
   // ParseDecimal check for nullptr, so can be called even if data only partially there
-  if(ParseDecimal(grbl_feed_rate, value_ptr[0u])) grbl_changed.feed = true;
-  if(ParseDecimal(spindle_rpm_programmed, value_ptr[1u])) grbl_changed.rpm = true;
-  if(ParseDecimal(spindle_rpm_actual, value_ptr[2u])) grbl_changed.rpm = true;
+  if(ParseDecimal(grbl_feed_rate, value_ptr[0u])) {grbl_changed.feed = true; SetChanged(CHG_FEED);}
+  if(ParseDecimal(spindle_rpm_programmed, value_ptr[1u])) {grbl_changed.rpm = true; SetChanged(CHG_RPM);}
+  if(ParseDecimal(spindle_rpm_actual, value_ptr[2u])) {grbl_changed.rpm = true; SetChanged(CHG_RPM);}
   // No actual speed in data - set actual RPM to zero
   if((value_ptr[2u] == nullptr) && (spindle_rpm_actual != 0.0f))
   {
     spindle_rpm_actual = 0.0f;
     // Set changed flag so UI can update displayed value
     grbl_changed.rpm = true;
+    SetChanged(CHG_RPM);
   }
 }
 
@@ -1587,6 +1646,8 @@ void GrblComm::ParseData(void)
     cmd_rx_timestamp = RtosTick::GetTimeMs();
     respond_pending = false;
     grbl_status = Status_OK;
+    // Jog latency trace: controller accepted command
+    JOG_TRACE(ACK);
     return;
   }
 
@@ -1606,12 +1667,14 @@ void GrblComm::ParseData(void)
       if(ParseState(line))
       {
         grbl_changed.state = true;
+        SetChanged(CHG_STATE);
 //        if(!(grbl_state == ALARM || grbl_state == TOOL) && grbl_message[0] != '\0') grblClearMessage();
       }
       if(grbl_alarm && grbl_state != ALARM)
       {
         grbl_alarm = 0u;
         grbl_changed.alarm = false;
+        SetChanged(CHG_ALARM);
       }
       line = strtok(NULL, "|");
     }
@@ -1626,6 +1689,7 @@ void GrblComm::ParseData(void)
           grbl_changed.offset = true;
         }
         grbl_changed.pos = ParseAxisData(line + 5, grbl_position);
+        if(grbl_changed.pos || grbl_changed.offset) SetChanged(CHG_POS);
       }
       else if(!strncmp(line, "MPos:", 5))
       {
@@ -1635,6 +1699,7 @@ void GrblComm::ParseData(void)
           grbl_changed.offset = true;
         }
         grbl_changed.pos = ParseAxisData(line + 5, grbl_position);
+        if(grbl_changed.pos || grbl_changed.offset) SetChanged(CHG_POS);
       }
       else if(!strncmp(line, "FS:", 3))
       {
@@ -1654,7 +1719,11 @@ void GrblComm::ParseData(void)
         for(uint32_t i = 0u; i < NumberOf(grbl_pins); i++)
         {
           // Check if sting changed and set flag
-          if(grbl_pins[i] != line[3 + i]) grbl_changed.pins = true;
+          if(grbl_pins[i] != line[3 + i])
+          {
+            grbl_changed.pins = true;
+            SetChanged(CHG_PINS);
+          }
           // Terminate string
           grbl_pins[i] = '\0';
           // If we reach end of sting or closing bracket - break the cycle
@@ -1671,12 +1740,23 @@ void GrblComm::ParseData(void)
       }
       else if(!strncmp(line, "D:", 2))
       {
+        // Position of X axis depends on mode, so it changes too
+        if(grbl_xModeDiameter != (line[2] == '1'))
+        {
+          SetChanged(CHG_XMODE);
+          SetChanged(CHG_POS);
+        }
         grbl_xModeDiameter = line[2] == '1';
         grbl_changed.xmode = true;
       }
       else if(!strncmp(line, "A:", 2))
       {
         line = &line[2];
+        // Save previous state to find changes
+        bool prev_spindle_on = spindle_on;
+        bool prev_spindle_ccw = spindle_ccw;
+        bool prev_coolant_flood = coolant_flood;
+        bool prev_coolant_mist = coolant_mist;
         spindle_on = coolant_flood = coolant_mist = false;
         grbl_changed.leds = true;
 
@@ -1703,6 +1783,10 @@ void GrblComm::ParseData(void)
               break;
           }
         }
+        if((spindle_on != prev_spindle_on) || (spindle_ccw != prev_spindle_ccw) || (coolant_flood != prev_coolant_flood) || (coolant_mist != prev_coolant_mist))
+        {
+          SetChanged(CHG_ACCESSORIES);
+        }
       }
       else if(!strncmp(line, "Ov:", 3)) ParseOverrides(line + 3);
 
@@ -1712,6 +1796,7 @@ void GrblComm::ParseData(void)
         {
           grbl_mpgMode = !grbl_mpgMode;
           grbl_changed.mpg = true;
+          SetChanged(CHG_MPG);
 //          grbl_event.on_line_received = parseData;
         }
         grbl_received.mpg = true;
@@ -1724,7 +1809,18 @@ void GrblComm::ParseData(void)
       line = strtok(NULL, "|");
     }
 
-    if(!pins && (grbl_changed.pins = (grbl_pins[0] != '\0'))) grbl_pins[0] = '\0';
+    // Jog latency trace: first report with motion. Short jog can finish
+    // between reports, so Idle with changed position is motion too.
+    if(((grbl_state == JOG) || (grbl_state == IDLE)) && grbl_changed.pos)
+    {
+      JOG_TRACE(MOTION);
+    }
+
+    if(!pins && (grbl_changed.pins = (grbl_pins[0] != '\0')))
+    {
+      grbl_pins[0] = '\0';
+      SetChanged(CHG_PINS);
+    }
 
     // Clear probe flag if no pins reported
     if(!pins) grbl_probe_triggered = false;
@@ -1735,14 +1831,18 @@ void GrblComm::ParseData(void)
     {
       // Probe position
       grbl_changed.probe = ParseAxisData(line + 1 + 4, grbl_probe_position);
+      if(grbl_changed.probe) SetChanged(CHG_PROBE);
     }
     else if(!strncmp(&line[1], "TLO:", 4))
     {
       // Tool Length Offset
       grbl_changed.tlo = ParseAxisData(line + 1 + 4, grbl_tool_length_offset);
+      if(grbl_changed.tlo) SetChanged(CHG_PROBE);
     }
     if(!strncmp(&line[1], "AXS:", 4))
     {
+      // Save number of axis to find out if it changed
+      int32_t prev_number_of_axis = number_of_axis;
       // Move line pointer to number of axis
       line += 4 + 1;
       // Parse number of axis
@@ -1751,6 +1851,7 @@ void GrblComm::ParseData(void)
       // controller can report more axis than supported by the pendant.
       if(number_of_axis < 0) number_of_axis = 0;
       if(number_of_axis > AXIS_CNT) number_of_axis = AXIS_CNT;
+      if(number_of_axis != prev_number_of_axis) SetChanged(CHG_AXES);
 
       // Find line where axis names are
       line = strchr(line, ':');
@@ -1764,6 +1865,7 @@ void GrblComm::ParseData(void)
         {
           // Stop at end of string or closing bracket to avoid copying garbage
           if((line[i] == '\0') || (line[i] == ']')) break;
+          if(axis_str[i][0] != line[i]) SetChanged(CHG_AXES);
           axis_str[i][0] = line[i];
         }
       }
@@ -1789,6 +1891,7 @@ void GrblComm::ParseData(void)
   {
     grbl_alarm = (uint8_t)atoi(line + 6);
     grbl_changed.alarm = true;
+    SetChanged(CHG_ALARM);
   }
   else
   {
@@ -287,6 +287,26 @@ class GrblComm : public AppTask
       MEASUREMENT_SYSTEM_CNT
     } measurement_system_t;
 
+    // *************************************************************************
+    // ***   Changes Enum   ****************************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      CHG_STATE = 0u,   // State or substate
+      CHG_POS,          // Axis position or work offset
+      CHG_FEED,         // Feed rate
+      CHG_RPM,          // Programmed or actual spindle speed
+      CHG_ACCESSORIES,  // Spindle on/direction, flood & mist coolant
+      CHG_OVERRIDES,    // Feed, rapid & spindle overrides
+      CHG_PINS,         // Pins string
+      CHG_MPG,          // MPG mode
+      CHG_XMODE,        // Lathe diameter/radius mode
+      CHG_PROBE,        // Probe position or tool length offset
+      CHG_ALARM,        // Alarm code
+      CHG_AXES,         // Number of axis or axis names
+      CHG_CNT
+    } change_t;
+
     // *************************************************************************
     // ***   Public: Get Instance   ********************************************
     // *************************************************************************
@@ -377,6 +397,25 @@ class GrblComm : public AppTask
     // *************************************************************************
     bool IsPinsStrChanged() {bool ret = grbl_changed.pins; grbl_changed.pins = false; return ret;}
 
+    // *************************************************************************
+    // ***   Public: GetChanges function   *************************************
+    // *************************************************************************
+    // Every consumer keeps its own array of change counters, so any number of
+    // screens can track changes independently. Function returns mask of
+    // changes(1 << change_t) since previous call and updates the counters.
+    uint32_t GetChanges(uint32_t (&cnt)[CHG_CNT]);
+
+    // *************************************************************************
+    // ***   Public: ChangeMask function   *************************************
+    // *************************************************************************
+    static constexpr uint32_t ChangeMask(change_t chg) {return 1u << chg;}
+
+    // *************************************************************************
+    // ***   Public: ForceChanges function   ***********************************
+    // *************************************************************************
+    // Next GetChanges() call will report all changes
+    void ForceChanges(uint32_t (&cnt)[CHG_CNT]) {for(uint32_t i = 0u; i < CHG_CNT; i++) cnt[i] = change_cnt[i] - 1u;}
+
     // *************************************************************************
     // ***   Public: GetStateName function   ***********************************
     // *************************************************************************
@@ -562,6 +601,12 @@ class GrblComm : public AppTask
     // *************************************************************************
     inline int32_t GetFeedOverride() {return grbl_feed_override;}
 
+    // *************************************************************************
+    // ***   Public: GetFeedRate function   ************************************
+    // *************************************************************************
+    // Current feed from status report in report units per minute
+    inline float GetFeedRate() {return grbl_feed_rate;}
+
     // *************************************************************************
     // ***   Public: GetSpeedOverride function   *******************************
     // *************************************************************************
@@ -622,6 +667,11 @@ class GrblComm : public AppTask
     // *************************************************************************
     inline bool IsRespondPending() {return respond_pending;}
 
+    // *************************************************************************
+    // ***   Public: GetStatusTimestamp function   *****************************
+    // *************************************************************************
+    inline uint32_t GetStatusTimestamp() {return status_rx_timestamp;}
+
     // *************************************************************************
     // ***   Public: GetCmdResult   ********************************************
     // *************************************************************************
@@ -662,6 +712,13 @@ class GrblComm : public AppTask
     // *************************************************************************
     inline Result Hold() {return SendRealTimeCmd(CMD_FEED_HOLD);}
 
+    // *************************************************************************
+    // ***   Public: JogCancel   ***********************************************
+    // *************************************************************************
+    // Stop jog motion with deceleration. Jog commands that still waiting in the
+    // queue are discarded.
+    Result JogCancel();
+
     // *************************************************************************
     // ***   Public: Stop   ****************************************************
     // *************************************************************************
@@ -780,7 +837,12 @@ class GrblComm : public AppTask
     // *************************************************************************
     // ***   Public: Jog   *****************************************************
     // *************************************************************************
-    Result Jog(uint8_t axis, int32_t distance, uint32_t feed_x100, bool is_absolute);
+    Result Jog(uint8_t axis, int32_t distance, uint32_t feed_x100, bool is_absolute, uint32_t &id);
+
+    // *************************************************************************
+    // ***   Public: Jog   *****************************************************
+    // *************************************************************************
+    inline Result Jog(uint8_t axis, int32_t distance, uint32_t feed_x100, bool is_absolute) {uint32_t id = 0u; return Jog(axis, distance, feed_x100, is_absolute, id);}
 
     // *************************************************************************
     // ***   Public: JogInMachineCoodinates   **********************************
@@ -790,7 +852,14 @@ class GrblComm : public AppTask
     // *************************************************************************
     // ***   Public: JogMultiple   *********************************************
     // *************************************************************************
-    Result JogMultiple(int32_t distance_x, int32_t distance_y, int32_t distance_z, uint32_t feed_x100, bool is_absolute);
+    // * Feed applies to the vector, so in relative mode all axes move
+    // * simultaneously along straight line.
+    Result JogMultiple(int32_t distance_x, int32_t distance_y, int32_t distance_z, uint32_t feed_x100, bool is_absolute, uint32_t &id);
+
+    // *************************************************************************
+    // ***   Public: JogMultiple   *********************************************
+    // *************************************************************************
+    inline Result JogMultiple(int32_t distance_x, int32_t distance_y, int32_t distance_z, uint32_t feed_x100, bool is_absolute) {uint32_t id = 0u; return JogMultiple(distance_x, distance_y, distance_z, feed_x100, is_absolute, id);}
 
     // *************************************************************************
     // ***   Public: JogArcXY   ************************************************
@@ -903,6 +972,8 @@ class GrblComm : public AppTask
     uint32_t next_id = 1u;
     // ID of command that was send
     uint32_t send_id = 0u;
+    // Jog commands with ID less than this one was canceled
+    uint32_t jog_cancel_id = 0u;
 
     // *************************************************************************
     // ***   GRBL Data   *******************************************************
@@ -939,6 +1010,8 @@ class GrblComm : public AppTask
     bool      grbl_probe_triggered = false;
     changes_t grbl_changed;
     changes_t grbl_received;
+    // Change counters, incremented every time data changed
+    uint32_t change_cnt[CHG_CNT] = {0u};
     uint8_t   grbl_alarm;
     status_t  grbl_status;
     char      grbl_pins[10];
@@ -1041,6 +1114,11 @@ class GrblComm : public AppTask
     // *************************************************************************
     const char* GetMeasurementSystemGcode() {return (IsMetric() ? "G21" : "G20");}
 
+    // *************************************************************************
+    // ***   Private: SetChanged function   ************************************
+    // *************************************************************************
+    inline void SetChanged(change_t chg) {change_cnt[chg]++;}
+
     // *************************************************************************
     // ***   Private: ParseState function   ************************************
     // *************************************************************************
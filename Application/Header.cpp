@@ -50,8 +50,9 @@ void Header::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t n)
   btn_right.SetFont(Font_12x16::GetInstance());
   btn_right.SetCallback(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessUiCallback), this);
 
-  // Set callback handler for left and right buttons
-  InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT_UP | InputDrv::BTNM_RIGHT_UP, btn_cble);
+  // Set callback handler for left and right buttons. Header is set up once
+  // at start up, when handlers table is almost empty, so it can't fail.
+  (void)InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT_UP | InputDrv::BTNM_RIGHT_UP, btn_cble, InputDrv::PRIORITY_BACKGROUND);
 
   // Set box params
   box.SetParams(x_start, y_end + 1, width, display_drv.GetScreenH() - height, COLOR_DARKGREY, true);
@@ -72,7 +73,7 @@ void Header::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t n)
 // *****************************************************************************
 // ***   Public: SetImage   ****************************************************
 // *****************************************************************************
-void Header::SetImage(uint32_t page_idx, const ImageDesc& img_dsc)
+void Header::SetImage(uint32_t page_idx, const RleImageDesc& img_dsc)
 {
   if(page_idx < NumberOf(img))
   {
@@ -22,8 +22,10 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "DirtyRegions.h"
 
 #include "InputDrv.h"
+#include "RleImage.h"
 
 // *****************************************************************************
 // ***   Header Class   ********************************************************
@@ -47,7 +49,7 @@ class Header : public VisObject
     // *************************************************************************
     // ***   Public: SetImage   ************************************************
     // *************************************************************************
-    void SetImage(uint32_t page_idx, const ImageDesc& img_dsc);
+    void SetImage(uint32_t page_idx, const RleImageDesc& img_dsc);
 
     // *************************************************************************
     // ***   Public: SetText   *************************************************
@@ -124,6 +126,11 @@ class Header : public VisObject
     // *************************************************************************
     virtual void Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy);
 
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false) {DirtyRegions::GetInstance().Invalidate(*this, force);}
+
   private:
 
     // Callback function pointer
@@ -137,22 +144,22 @@ class Header : public VisObject
     uint32_t pages_cnt = 0u;
 
     // Image object for each page
-    Image img[MAX_PAGES];
+    RleImage img[MAX_PAGES];
     // String objects for each page
-    String str[MAX_PAGES];
+    Dirty<String> str[MAX_PAGES];
     // Button objects for each page
-    UiButton button[MAX_PAGES];
+    Dirty<UiButton> button[MAX_PAGES];
 
     // Line
-    Line line_bottom;
+    Dirty<Line> line_bottom;
     // Buttons
-    UiButton btn_left;
-    UiButton btn_right;
+    Dirty<UiButton> btn_left;
+    Dirty<UiButton> btn_right;
     // Box for cover screen
-    Box box;
+    Dirty<Box> box;
 
     // Box to disable header
-    ShadowBox shadowbox;
+    Dirty<ShadowBox> shadowbox;
 
     // Button callback entry
     InputDrv::CallbackListEntry btn_cble;
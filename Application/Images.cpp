@@ -24,207 +24,168 @@
 // ***   Data   ****************************************************************
 // *****************************************************************************
 
-const ImageDesc MPG = {40, 40, 32, {.imgp = MPG_data}, PALETTE_884, (int32_t)PALETTE_884[0xC7]};
-const ImageDesc RotaryTable = {40, 39, 32, {.imgp = RotaryTable_data}, PALETTE_884,  (int32_t)PALETTE_884[0xC7]};
+// Generated by Tools/ImageRle from 8-bit PALETTE_884 images
 
-const uint8_t MPG_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xA4, 0xA4, 0xA4, 0xAD, 0xAD, 0x5B, 0xAD, 0xA4, 0xA4, 
-0x5B, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x5B, 0xA4, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xA4, 0xAD, 0xFF, 0xFF, 0xF6, 0x5B, 0x52, 0x52, 0x00, 0x00, 0x00, 0x00, 0x52, 0x52, 
-0x5B, 0xFF, 0xFF, 0xFF, 0xA4, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xA4, 0xFF, 0xF6, 0xAD, 0x00, 0x00, 0x09, 
-0x5B, 0xA4, 0xA4, 0x5B, 0x5B, 0xA4, 0xA4, 0xA4, 0x09, 0x00, 0x52, 0xAD, 0xF6, 0xFF, 0xA4, 0xFF, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 
-0xAD, 0xFF, 0xF6, 0x09, 0x00, 0x5B, 0xAD, 0xAD, 0xFF, 0xFF, 0xFF, 0xA4, 0xAD, 0xFF, 0xFF, 0xFF, 
-0xA4, 0xAD, 0x52, 0x00, 0x52, 0xF6, 0xFF, 0xAD, 0xAD, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xFF, 0xFF, 0x5B, 0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x09, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xA4, 0xFF, 
-0xFF, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xFF, 0xFF, 
-0x5B, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xA4, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x5B, 0xFF, 0xFF, 0xAD, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0xAD, 0xFF, 0x5B, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x5B, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF6, 0x00, 
-0xA4, 0xFF, 0xAD, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x5B, 0xFF, 0x5B, 0x00, 
-0xFF, 0xFF, 0xFF, 0x00, 0x09, 0x52, 0x00, 0x00, 0x52, 0x5B, 0xAD, 0xFF, 0xFF, 0xAD, 0x52, 0x52, 
-0x00, 0x00, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0x00, 0xA4, 0xFF, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x5B, 0xFF, 0xF6, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x52, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x5B, 0x00, 0xF6, 0xFF, 0x5B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xF6, 0x52, 0x52, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x52, 0xFF, 0xA4, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x5B, 0xFF, 0x5B, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x09, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xAD, 0xFF, 0x52, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xFF, 0x00, 0x52, 0xFF, 0xFF, 
-0xFF, 0x5B, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0x5B, 0x09, 0xFF, 0x5B, 0xC7, 0xC7, 
-0xC7, 0xA4, 0xFF, 0xF6, 0x00, 0xFF, 0xF6, 0xFF, 0xFF, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFF, 
-0xFF, 0xFF, 0xAD, 0x00, 0xFF, 0xFF, 0xF6, 0xC7, 0xC7, 0xA4, 0xFF, 0x09, 0x09, 0xAD, 0x00, 0x00, 
-0x52, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x52, 0x00, 0x00, 0xF6, 0x09, 0x5B, 0xFF, 0x5B, 0xC7, 
-0xC7, 0x5B, 0xFF, 0x52, 0x5B, 0xFF, 0x52, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 
-0x52, 0x09, 0xFF, 0xA4, 0x52, 0xFF, 0xA4, 0xC7, 0xC7, 0xA4, 0xFF, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 
-0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0xFF, 0xFF, 0xFF, 0xA4, 0x5B, 0xF6, 0xAD, 0xC7, 
-0xC7, 0xAD, 0xF6, 0x5B, 0xAD, 0xFF, 0xFF, 0xFF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 
-0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0xFF, 0x09, 0xC7, 0xC7, 0xA4, 0xAD, 0x00, 0xF6, 0xFF, 0xFF, 0xAD, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0xF6, 0xFF, 0xFF, 0x5B, 0xA4, 0xFF, 0xA4, 0xC7, 
-0xC7, 0xAD, 0xAD, 0x09, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 
-0xAD, 0xFF, 0xFF, 0xAD, 0xF6, 0xFF, 0x5B, 0xC7, 0xC7, 0xAD, 0xF6, 0x09, 0xA4, 0xFF, 0xFF, 0xFF, 
-0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0xFF, 0x52, 0xC7, 
-0xC7, 0xA4, 0xFF, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 
-0xFF, 0xFF, 0xFF, 0xA4, 0x52, 0xFF, 0xAD, 0xC7, 0xC7, 0x5B, 0xFF, 0x09, 0xA4, 0xFF, 0x00, 0x52, 
-0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF6, 0x00, 0xFF, 0xA4, 0x52, 0xFF, 0xA4, 0xC7, 
-0xC7, 0xA4, 0xFF, 0x09, 0x52, 0xAD, 0x00, 0x00, 0x5B, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xA4, 
-0x00, 0x00, 0xF6, 0x09, 0x5B, 0xFF, 0x5B, 0xC7, 0xC7, 0xAD, 0xFF, 0xF6, 0x00, 0xF6, 0xFF, 0xFF, 
-0xFF, 0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 
-0xC7, 0xC7, 0x5B, 0xF6, 0x52, 0x5B, 0xFF, 0xFF, 0xFF, 0x52, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x52, 0xFF, 
-0xFF, 0xFF, 0x52, 0x09, 0xFF, 0x5B, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xFF, 0xA4, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAD, 0xFF, 0x5B, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xA4, 0xF6, 0x52, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x09, 0xA4, 0xFF, 0xFF, 
-0xFF, 0xAD, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x5B, 0xF6, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xFF, 0xAD, 0x00, 0xA4, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x52, 0x00, 0xFF, 0xFF, 0x00, 0xAD, 0xFF, 
-0xF6, 0x52, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0xAD, 0xFF, 0xA4, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x5B, 0xFF, 0xA4, 0x00, 0xF6, 0xFF, 0xFF, 0x00, 0x52, 0xA4, 0x00, 0x00, 
-0x09, 0x52, 0x00, 0x00, 0x00, 0x00, 0x52, 0x52, 0x00, 0x00, 0x5B, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 
-0x00, 0xAD, 0xFF, 0x5B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xF6, 0xFF, 0x52, 
-0x00, 0xAD, 0xFF, 0x09, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA4, 0xFF, 0xFF, 0x00, 0x09, 0xFF, 0xAD, 0x00, 0x5B, 0xFF, 0xAD, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xFF, 0xFF, 0x5B, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x5B, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x5B, 
-0xFF, 0xF6, 0xF6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xFF, 
-0xFF, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAD, 0xFF, 0xF6, 0xAD, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xAD, 0xFF, 0xF6, 0x5B, 0x00, 0x5B, 0xAD, 0xAD, 
-0xFF, 0xFF, 0xFF, 0xA4, 0xA4, 0xFF, 0xFF, 0xFF, 0xAD, 0xAD, 0x09, 0x00, 0x52, 0xAD, 0xFF, 0xAD, 
-0xAD, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xFF, 0x5B, 0xFF, 0xF6, 0xA4, 0x09, 0x00, 0x00, 0x5B, 0x5B, 0xF6, 0xA4, 0xA4, 0xF6, 0x5B, 0x5B, 
-0x09, 0x00, 0x09, 0xAD, 0xFF, 0xFF, 0x5B, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0xA4, 0xFF, 0xF6, 0xFF, 0x5B, 
-0x5B, 0x09, 0x09, 0x00, 0x00, 0x5B, 0x09, 0x52, 0x5B, 0xFF, 0xFF, 0xFF, 0xA4, 0xA4, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xA4, 0x5B, 0xF6, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 
-0xFF, 0xF6, 0xA4, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 
-0xA4, 0x5B, 0xF6, 0x52, 0x52, 0xAD, 0x52, 0xA4, 0xA4, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+// MPG: 40x40, raw 1600 bytes, RLE 1119 bytes
+static const uint16_t MPG_lines[] = {
+0, 2, 19, 35, 59, 88, 119, 144, 169, 201, 238, 268, 296, 323, 351, 379, 
+405, 431, 457, 483, 508, 533, 559, 585, 611, 638, 665, 693, 725, 761, 798, 834, 
+866, 891, 916, 947, 976, 1001, 1022, 1037
+};
 
-const uint8_t RotaryTable_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF6, 0xF6,
-0xF6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xFF, 0xAD, 0x5B, 0x5B, 0x52, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x5B, 0xA4, 0xA4, 0xF6,
-0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xA4, 0x5B, 0xAD, 0xF6, 0xFF, 0xFF, 0xF6, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xF6, 0xFF, 0xFF, 0xF6, 0xA4, 0x5B, 0xA4, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x00, 0xF6,
-0xFF, 0xF6, 0xAD, 0xAD, 0xAD, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xA4, 0x5B, 0xA4, 0xF6,
-0xAD, 0x09, 0xAD, 0xAD, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xF6, 0x52, 0x09, 0x09, 0xA4, 0x5B, 0xAD, 0xFF, 0xF6, 0xA4, 0xA4, 0xA4, 0xA4,
-0xA4, 0xA4, 0xA4, 0xA4, 0xAD, 0xF6, 0xAD, 0x52, 0x5B, 0x00, 0xA4, 0xA4, 0x5B, 0xFF, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x5B, 0xFF, 0xAD, 0x09, 0x09,
-0x52, 0xA4, 0x5B, 0xA4, 0xF6, 0xFF, 0xFF, 0xF6, 0xF6, 0xFF, 0xFF, 0xFF, 0xAD, 0x09, 0x5B, 0x5B,
-0xA4, 0xA4, 0xA4, 0xFF, 0xF6, 0x5B, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xFF, 0x52, 0xFF, 0xFF, 0xA4, 0xFF, 0xAD, 0x52, 0x09, 0x52, 0xA4, 0x5B, 0x5B, 0x00, 0x52,
-0xA4, 0x5B, 0x09, 0x52, 0xA4, 0x5B, 0x5B, 0x5B, 0xF6, 0xFF, 0xAD, 0xA4, 0xFF, 0xAD, 0xA4, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0x5B, 0xF6, 0xFF, 0xAD, 0xFF, 0xFF, 0x5B,
-0xAD, 0xAD, 0x52, 0x09, 0x52, 0x5B, 0xF6, 0x52, 0x09, 0xF6, 0x09, 0x5B, 0x5B, 0x09, 0xFF, 0xFF,
-0xA4, 0xF6, 0xFF, 0x5B, 0xF6, 0xFF, 0x52, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xFF, 0x52, 0xFF, 0xFF, 0xAD, 0xFF, 0xF6, 0xA4, 0xFF, 0xA4, 0xF6, 0xA4, 0x09, 0x00, 0xA4, 0xAD,
-0xA4, 0x00, 0x00, 0x09, 0xF6, 0xF6, 0xA4, 0xFF, 0xFF, 0x5B, 0xFF, 0xF6, 0xA4, 0xFF, 0xAD, 0xAD,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x52, 0xFF, 0xF6, 0xFF, 0xFF, 0xA4, 0xF6,
-0xFF, 0xA4, 0xFF, 0xFF, 0x5B, 0x5B, 0x00, 0x09, 0x09, 0x00, 0x00, 0xAD, 0xAD, 0xFF, 0x5B, 0xFF,
-0xFF, 0x5B, 0xFF, 0xFF, 0xA4, 0xFF, 0xF6, 0x5B, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xF6, 0x52, 0xFF, 0xF6, 0xF6, 0xFF, 0xA4, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0x52, 0xF6, 0x09, 0x00,
-0x00, 0x00, 0xA4, 0x5B, 0xF6, 0xFF, 0x5B, 0xFF, 0xFF, 0x5B, 0xFF, 0xF6, 0xA4, 0xFF, 0xAD, 0x5B,
-0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x09, 0xFF, 0xFF, 0xAD, 0xFF, 0xF6, 0xF6,
-0xFF, 0xA4, 0xAD, 0xA4, 0x52, 0x52, 0xAD, 0xF6, 0xAD, 0xA4, 0x09, 0x52, 0xA4, 0x5B, 0xF6, 0xFF,
-0xA4, 0xF6, 0xFF, 0xA4, 0xF6, 0xFF, 0xA4, 0x52, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xF6, 0x52, 0xAD, 0xFF, 0xF6, 0xF6, 0xFF, 0xA4, 0xAD, 0xA4, 0x5B, 0x52, 0x5B, 0xF6, 0xF6, 0xAD,
-0xAD, 0xF6, 0xAD, 0x09, 0x52, 0x52, 0xAD, 0xA4, 0xA4, 0xFF, 0xAD, 0xA4, 0xFF, 0xF6, 0x5B, 0x52,
-0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x5B, 0xA4, 0xF6, 0xFF, 0xF6, 0xAD, 0xAD,
-0x5B, 0x5B, 0x5B, 0xAD, 0xAD, 0xAD, 0xAD, 0xA4, 0xA4, 0xA4, 0xA4, 0xAD, 0xAD, 0x5B, 0x52, 0x5B,
-0xAD, 0xAD, 0x5B, 0xFF, 0xFF, 0x52, 0xF6, 0x00, 0x5B, 0xF6, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xF6, 0x52, 0xFF, 0x5B, 0xAD, 0xF6, 0xA4, 0x5B, 0x09, 0xA4, 0xA4, 0xAD, 0xAD, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF6, 0xA4, 0x5B, 0xA4, 0xAD, 0x5B, 0x52, 0x52, 0xAD, 0xF6, 0x52, 0xF6, 0xF6, 0xAD,
-0xFF, 0x5B, 0x5B, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x00, 0xFF, 0xFF, 0x09, 0x52, 0x09, 0x5B,
-0xAD, 0xAD, 0xF6, 0xFF, 0xF6, 0xAD, 0xAD, 0xA4, 0xA4, 0xA4, 0xAD, 0xF6, 0xFF, 0xF6, 0xAD, 0xA4,
-0xA4, 0x52, 0x52, 0x09, 0xA4, 0xFF, 0x5B, 0xFF, 0xFF, 0xFF, 0xF6, 0x5B, 0xA4, 0xFF, 0xC7, 0xC7,
-0xF6, 0x5B, 0x5B, 0xFF, 0x00, 0xAD, 0x00, 0xA4, 0xFF, 0xFF, 0xF6, 0xAD, 0xF6, 0xAD, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xF6, 0xFF, 0xFF, 0xAD, 0x00, 0xA4, 0x5B, 0xA4, 0xAD, 0xA4, 0xFF,
-0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0xFF, 0xC7, 0xC7, 0xF6, 0xA4, 0xAD, 0xA4, 0xF6, 0xAD, 0xA4, 0xAD,
-0xA4, 0xA4, 0xA4, 0xF6, 0xFF, 0xFF, 0xFF, 0x52, 0x00, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0x5B, 0x52,
-0xA4, 0x5B, 0xA4, 0xA4, 0xAD, 0x52, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xF6, 0x5B, 0xFF, 0xC7, 0xC7,
-0xF6, 0xA4, 0xFF, 0xAD, 0xA4, 0xF6, 0xAD, 0xF6, 0xFF, 0xFF, 0xF6, 0xAD, 0xA4, 0xA4, 0xA4, 0x5B,
-0xA4, 0xA4, 0xAD, 0xA4, 0xAD, 0xF6, 0xFF, 0xFF, 0xFF, 0xA4, 0xAD, 0xAD, 0x52, 0xFF, 0xFF, 0xFF,
-0xAD, 0xAD, 0xAD, 0xFF, 0x5B, 0xFF, 0xC7, 0xC7, 0xF6, 0x5B, 0xFF, 0xFF, 0xF6, 0x52, 0xAD, 0xF6,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xAD, 0x52, 0xA4, 0xFF, 0xFF, 0xAD, 0xAD, 0xFF, 0xA4, 0xA4, 0xFF, 0xA4, 0xFF, 0xC7, 0xC7,
-0xF6, 0x09, 0xFF, 0xFF, 0xFF, 0x52, 0x5B, 0x5B, 0x5B, 0xF6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0x5B, 0x5B, 0xF6, 0xFF, 0xF6, 0xAD, 0xF6, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0xFF, 0xC7, 0xC7, 0xF6, 0x00, 0xF6, 0xFF, 0xA4, 0x52, 0x09, 0xFF,
-0xF6, 0xAD, 0xA4, 0x5B, 0xA4, 0xF6, 0xAD, 0xF6, 0xF6, 0xAD, 0xF6, 0xAD, 0xA4, 0xA4, 0xA4, 0xAD,
-0xFF, 0xFF, 0xFF, 0xAD, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0xFF, 0xC7, 0xC7,
-0xF6, 0x5B, 0x52, 0xF6, 0xF6, 0x5B, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xA4, 0x00,
-0x5B, 0xA4, 0xAD, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF6, 0x52, 0xFF, 0x52, 0xF6, 0xC7, 0xC7, 0xF6, 0x52, 0xAD, 0x5B, 0xF6, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x52, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6,
-0xA4, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xA4, 0xAD, 0xA4, 0x52, 0xF6, 0xC7,
-0xFF, 0x52, 0xF6, 0xA4, 0x09, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xF6, 0x52, 0xA4, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xF6, 0xA4, 0x5B, 0xF6, 0xF6, 0xA4, 0x5B, 0xFF, 0xC7, 0xF6, 0x52, 0xFF, 0x52, 0x00, 0x09, 0xAD,
-0xF6, 0x52, 0x00, 0x00, 0x00, 0x09, 0x52, 0x52, 0xAD, 0xFF, 0xFF, 0xFF, 0xAD, 0xAD, 0xFF, 0x52,
-0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xAD, 0xF6, 0x5B, 0xA4, 0xF6, 0xFF, 0x5B, 0xFF,
-0xC7, 0xC7, 0xAD, 0x5B, 0xF6, 0xA4, 0xAD, 0xA4, 0x00, 0xF6, 0xAD, 0x5B, 0x5B, 0xA4, 0xA4, 0xA4,
-0x09, 0x5B, 0xAD, 0x5B, 0xF6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xFF,
-0xFF, 0xAD, 0xAD, 0xFF, 0xFF, 0xAD, 0x5B, 0xFF, 0xC7, 0xC7, 0xFF, 0xAD, 0x52, 0xF6, 0xFF, 0xF6,
-0xA4, 0xA4, 0xA4, 0xFF, 0xAD, 0x5B, 0x52, 0x00, 0xAD, 0x09, 0xF6, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xF6, 0xFF, 0xF6, 0xAD, 0xF6, 0xFF, 0xF6, 0x52, 0xA4, 0xFF, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x52, 0x5B, 0xAD, 0xAD, 0xA4, 0xF6, 0xA4, 0x5B, 0xA4, 0x09, 0x00,
-0x52, 0xAD, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xAD, 0xFF, 0xAD, 0xAD, 0xFF, 0xFF, 0xAD, 0xF6,
-0xFF, 0xFF, 0x5B, 0x52, 0xF6, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xF6, 0x52,
-0xA4, 0xA4, 0xAD, 0x5B, 0x52, 0x09, 0x00, 0x09, 0x00, 0xAD, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B,
-0xAD, 0x5B, 0xF6, 0xFF, 0xF6, 0xAD, 0xFF, 0xFF, 0xAD, 0x09, 0xAD, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0x5B, 0xAD, 0xA4, 0x00, 0x52, 0x09, 0x52, 0x52,
-0x00, 0xA4, 0x52, 0xFF, 0xFF, 0xFF, 0xF6, 0xAD, 0xF6, 0x5B, 0x5B, 0xAD, 0xF6, 0xFF, 0xF6, 0x5B,
-0xA4, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF,
-0xA4, 0xAD, 0x5B, 0x5B, 0x00, 0x52, 0x5B, 0xAD, 0x00, 0x52, 0x09, 0xF6, 0xFF, 0xAD, 0x5B, 0xF6,
-0xFF, 0xAD, 0xF6, 0xFF, 0xFF, 0xA4, 0x5B, 0xF6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x5B, 0xAD, 0xA4, 0xAD, 0xA4, 0xF6, 0xA4,
-0x09, 0x00, 0xA4, 0x52, 0x52, 0xF6, 0xFF, 0xAD, 0x5B, 0xFF, 0xFF, 0xAD, 0x52, 0xAD, 0xFF, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xA4, 0xA4, 0xAD, 0x5B, 0xAD, 0x5B, 0xA4, 0x00, 0x09, 0xF6, 0xF6, 0xAD, 0x5B, 0xAD, 0xFF,
-0xAD, 0xF6, 0x52, 0xA4, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0x5B, 0xA4, 0xA4, 0x09, 0x52, 0xAD,
-0x00, 0xAD, 0xC7, 0xC7, 0xC7, 0xFF, 0xAD, 0x5B, 0x09, 0x52, 0xF6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xFF, 0xAD, 0x52, 0x52, 0xAD, 0xFF, 0xF6, 0x00, 0xA4, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF,
-0xF6, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xF6, 0x00, 0x00, 0xAD, 0xFF, 0xF6, 0x52, 0xF6,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xFF, 0x00, 0x00, 0x09, 0xA4, 0x5B, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xA4, 0x00, 0x00, 0xAD, 0xFF, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+static const uint8_t MPG_rle[] = {
+0xA7, 0xC7, 0x8D, 0xC7, 0x00, 0xFF, 0x82, 0xA4, 0x07, 0xAD, 0xAD, 0x5B, 0xAD, 0xA4, 0xA4, 0x5B, 
+0xFF, 0x8D, 0xC7, 0x8B, 0xC7, 0x01, 0x5B, 0xA4, 0x85, 0xFF, 0x00, 0xAD, 0x84, 0xFF, 0x01, 0x5B, 
+0xA4, 0x8B, 0xC7, 0x89, 0xC7, 0x07, 0xA4, 0xAD, 0xFF, 0xFF, 0xF6, 0x5B, 0x52, 0x52, 0x83, 0x00, 
+0x02, 0x52, 0x52, 0x5B, 0x82, 0xFF, 0x01, 0xA4, 0xA4, 0x89, 0xC7, 0x87, 0xC7, 0x0C, 0xFF, 0xA4, 
+0xFF, 0xF6, 0xAD, 0x00, 0x00, 0x09, 0x5B, 0xA4, 0xA4, 0x5B, 0x5B, 0x82, 0xA4, 0x07, 0x09, 0x00, 
+0x52, 0xAD, 0xF6, 0xFF, 0xA4, 0xFF, 0x87, 0xC7, 0x86, 0xC7, 0x08, 0xAD, 0xAD, 0xFF, 0xF6, 0x09, 
+0x00, 0x5B, 0xAD, 0xAD, 0x82, 0xFF, 0x01, 0xA4, 0xAD, 0x82, 0xFF, 0x08, 0xA4, 0xAD, 0x52, 0x00, 
+0x52, 0xF6, 0xFF, 0xAD, 0xAD, 0x86, 0xC7, 0x85, 0xC7, 0x05, 0xA4, 0xFF, 0xFF, 0x5B, 0x00, 0x52, 
+0x86, 0xFF, 0x01, 0x09, 0xA4, 0x86, 0xFF, 0x05, 0x09, 0x00, 0xA4, 0xFF, 0xFF, 0xA4, 0x85, 0xC7, 
+0x84, 0xC7, 0x05, 0xA4, 0xFF, 0xFF, 0x5B, 0x00, 0xA4, 0x87, 0xFF, 0x01, 0xAD, 0xA4, 0x87, 0xFF, 
+0x05, 0x5B, 0x00, 0x5B, 0xFF, 0xFF, 0xAD, 0x84, 0xC7, 0x83, 0xC7, 0x0B, 0xF6, 0xAD, 0xFF, 0x5B, 
+0x00, 0xF6, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x5B, 0x87, 0x00, 0x0B, 0x5B, 0xFF, 0xFF, 0x00, 0x00, 
+0xFF, 0xF6, 0x00, 0xA4, 0xFF, 0xAD, 0xFF, 0x83, 0xC7, 0x83, 0xC7, 0x03, 0x5B, 0xFF, 0x5B, 0x00, 
+0x82, 0xFF, 0x18, 0x00, 0x09, 0x52, 0x00, 0x00, 0x52, 0x5B, 0xAD, 0xFF, 0xFF, 0xAD, 0x52, 0x52, 
+0x00, 0x00, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0x00, 0xA4, 0xFF, 0xA4, 0x83, 0xC7, 0x82, 0xC7, 
+0x04, 0x5B, 0xFF, 0xF6, 0x00, 0x5B, 0x83, 0xFF, 0x02, 0x00, 0x00, 0x52, 0x89, 0xFF, 0x02, 0x09, 
+0x00, 0x00, 0x83, 0xFF, 0x04, 0x5B, 0x00, 0xF6, 0xFF, 0x5B, 0x82, 0xC7, 0x82, 0xC7, 0x03, 0xAD, 
+0xF6, 0x52, 0x52, 0x83, 0xFF, 0x02, 0x00, 0x00, 0xAD, 0x8B, 0xFF, 0x02, 0xA4, 0x00, 0x00, 0x83, 
+0xFF, 0x03, 0x52, 0x52, 0xFF, 0xA4, 0x82, 0xC7, 0x81, 0xC7, 0x03, 0x5B, 0xFF, 0x5B, 0x00, 0x83, 
+0xFF, 0x01, 0x00, 0x00, 0x8E, 0xFF, 0x02, 0xF6, 0x09, 0x00, 0x83, 0xFF, 0x03, 0x00, 0xAD, 0xFF, 
+0x52, 0x81, 0xC7, 0x81, 0xC7, 0x03, 0xA4, 0xFF, 0x00, 0x52, 0x82, 0xFF, 0x02, 0x5B, 0x00, 0xAD, 
+0x8F, 0xFF, 0x02, 0xA4, 0x00, 0xA4, 0x82, 0xFF, 0x03, 0x5B, 0x09, 0xFF, 0x5B, 0x81, 0xC7, 0x80, 
+0xC7, 0x09, 0xA4, 0xFF, 0xF6, 0x00, 0xFF, 0xF6, 0xFF, 0xFF, 0x00, 0x09, 0x91, 0xFF, 0x01, 0x09, 
+0x00, 0x82, 0xFF, 0x04, 0xAD, 0x00, 0xFF, 0xFF, 0xF6, 0x80, 0xC7, 0x80, 0xC7, 0x08, 0xA4, 0xFF, 
+0x09, 0x09, 0xAD, 0x00, 0x00, 0x52, 0x00, 0x93, 0xFF, 0x08, 0x00, 0x52, 0x00, 0x00, 0xF6, 0x09, 
+0x5B, 0xFF, 0x5B, 0x80, 0xC7, 0x80, 0xC7, 0x08, 0x5B, 0xFF, 0x52, 0x5B, 0xFF, 0x52, 0x00, 0x00, 
+0x52, 0x93, 0xFF, 0x08, 0x09, 0x00, 0x52, 0x09, 0xFF, 0xA4, 0x52, 0xFF, 0xA4, 0x80, 0xC7, 0x80, 
+0xC7, 0x03, 0xA4, 0xFF, 0x00, 0xAD, 0x82, 0xFF, 0x01, 0x00, 0x5B, 0x93, 0xFF, 0x01, 0x5B, 0x00, 
+0x82, 0xFF, 0x03, 0xA4, 0x5B, 0xF6, 0xAD, 0x80, 0xC7, 0x80, 0xC7, 0x03, 0xAD, 0xF6, 0x5B, 0xAD, 
+0x82, 0xFF, 0x01, 0x00, 0xF6, 0x93, 0xFF, 0x01, 0xAD, 0x00, 0x82, 0xFF, 0x03, 0xA4, 0x00, 0xFF, 
+0x09, 0x80, 0xC7, 0x80, 0xC7, 0x07, 0xA4, 0xAD, 0x00, 0xF6, 0xFF, 0xFF, 0xAD, 0x00, 0x94, 0xFF, 
+0x08, 0xAD, 0x00, 0xF6, 0xFF, 0xFF, 0x5B, 0xA4, 0xFF, 0xA4, 0x80, 0xC7, 0x80, 0xC7, 0x02, 0xAD, 
+0xAD, 0x09, 0x82, 0xFF, 0x01, 0xA4, 0x00, 0x94, 0xFF, 0x08, 0xAD, 0x00, 0xAD, 0xFF, 0xFF, 0xAD, 
+0xF6, 0xFF, 0x5B, 0x80, 0xC7, 0x80, 0xC7, 0x03, 0xAD, 0xF6, 0x09, 0xA4, 0x82, 0xFF, 0x01, 0x00, 
+0xAD, 0x93, 0xFF, 0x01, 0xAD, 0x00, 0x82, 0xFF, 0x03, 0xA4, 0x00, 0xFF, 0x52, 0x80, 0xC7, 0x80, 
+0xC7, 0x03, 0xA4, 0xFF, 0x00, 0xAD, 0x82, 0xFF, 0x01, 0x00, 0x5B, 0x93, 0xFF, 0x01, 0x5B, 0x00, 
+0x82, 0xFF, 0x03, 0xA4, 0x52, 0xFF, 0xAD, 0x80, 0xC7, 0x80, 0xC7, 0x08, 0x5B, 0xFF, 0x09, 0xA4, 
+0xFF, 0x00, 0x52, 0x00, 0x52, 0x93, 0xFF, 0x08, 0x09, 0x00, 0xF6, 0x00, 0xFF, 0xA4, 0x52, 0xFF, 
+0xA4, 0x80, 0xC7, 0x80, 0xC7, 0x08, 0xA4, 0xFF, 0x09, 0x52, 0xAD, 0x00, 0x00, 0x5B, 0x00, 0x92, 
+0xFF, 0x09, 0xF6, 0x00, 0xA4, 0x00, 0x00, 0xF6, 0x09, 0x5B, 0xFF, 0x5B, 0x80, 0xC7, 0x80, 0xC7, 
+0x04, 0xAD, 0xFF, 0xF6, 0x00, 0xF6, 0x82, 0xFF, 0x01, 0x00, 0x52, 0x91, 0xFF, 0x01, 0x09, 0x00, 
+0x82, 0xFF, 0x01, 0xF6, 0x00, 0x82, 0xFF, 0x80, 0xC7, 0x81, 0xC7, 0x03, 0x5B, 0xF6, 0x52, 0x5B, 
+0x82, 0xFF, 0x02, 0x52, 0x00, 0xAD, 0x8F, 0xFF, 0x02, 0xA4, 0x00, 0x52, 0x82, 0xFF, 0x03, 0x52, 
+0x09, 0xFF, 0x5B, 0x81, 0xC7, 0x81, 0xC7, 0x03, 0xA4, 0xFF, 0xA4, 0x00, 0x83, 0xFF, 0x02, 0x00, 
+0x00, 0xF6, 0x84, 0xFF, 0x83, 0x00, 0x84, 0xFF, 0x02, 0xAD, 0x00, 0x00, 0x83, 0xFF, 0x03, 0x00, 
+0xAD, 0xFF, 0x5B, 0x81, 0xC7, 0x82, 0xC7, 0x03, 0xA4, 0xF6, 0x52, 0x5B, 0x83, 0xFF, 0x02, 0x00, 
+0x09, 0xA4, 0x82, 0xFF, 0x04, 0xAD, 0x00, 0xFF, 0xFF, 0x00, 0x83, 0xFF, 0x02, 0xA4, 0x00, 0x00, 
+0x83, 0xFF, 0x03, 0x00, 0x5B, 0xF6, 0xA4, 0x82, 0xC7, 0x82, 0xC7, 0x04, 0xA4, 0xFF, 0xAD, 0x00, 
+0xA4, 0x83, 0xFF, 0x0F, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x52, 0x00, 0xFF, 0xFF, 0x00, 0xAD, 0xFF, 
+0xF6, 0x52, 0x00, 0x00, 0x83, 0xFF, 0x04, 0x5B, 0x00, 0xAD, 0xFF, 0xA4, 0x82, 0xC7, 0x83, 0xC7, 
+0x0D, 0x5B, 0xFF, 0xA4, 0x00, 0xF6, 0xFF, 0xFF, 0x00, 0x52, 0xA4, 0x00, 0x00, 0x09, 0x52, 0x83, 
+0x00, 0x0D, 0x52, 0x52, 0x00, 0x00, 0x5B, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0x00, 0xAD, 0xFF, 0x5B, 
+0x83, 0xC7, 0x83, 0xC7, 0x0B, 0xFF, 0xF6, 0xFF, 0x52, 0x00, 0xAD, 0xFF, 0x09, 0x00, 0xFF, 0xFF, 
+0xA4, 0x87, 0x00, 0x0B, 0xA4, 0xFF, 0xFF, 0x00, 0x09, 0xFF, 0xAD, 0x00, 0x5B, 0xFF, 0xAD, 0xFF, 
+0x83, 0xC7, 0x84, 0xC7, 0x05, 0xAD, 0xFF, 0xFF, 0x5B, 0x00, 0x5B, 0x87, 0xFF, 0x01, 0x5B, 0x5B, 
+0x87, 0xFF, 0x05, 0xA4, 0x00, 0x5B, 0xFF, 0xF6, 0xF6, 0x84, 0xC7, 0x85, 0xC7, 0x05, 0xA4, 0xFF, 
+0xFF, 0xA4, 0x00, 0x00, 0x86, 0xFF, 0x01, 0x00, 0x00, 0x86, 0xFF, 0x05, 0x00, 0x00, 0xAD, 0xFF, 
+0xF6, 0xAD, 0x85, 0xC7, 0x86, 0xC7, 0x08, 0xAD, 0xAD, 0xFF, 0xF6, 0x5B, 0x00, 0x5B, 0xAD, 0xAD, 
+0x82, 0xFF, 0x01, 0xA4, 0xA4, 0x82, 0xFF, 0x08, 0xAD, 0xAD, 0x09, 0x00, 0x52, 0xAD, 0xFF, 0xAD, 
+0xAD, 0x86, 0xC7, 0x87, 0xC7, 0x17, 0xFF, 0x5B, 0xFF, 0xF6, 0xA4, 0x09, 0x00, 0x00, 0x5B, 0x5B, 
+0xF6, 0xA4, 0xA4, 0xF6, 0x5B, 0x5B, 0x09, 0x00, 0x09, 0xAD, 0xFF, 0xFF, 0x5B, 0xFF, 0x87, 0xC7, 
+0x89, 0xC7, 0x0E, 0xA4, 0xA4, 0xFF, 0xF6, 0xFF, 0x5B, 0x5B, 0x09, 0x09, 0x00, 0x00, 0x5B, 0x09, 
+0x52, 0x5B, 0x82, 0xFF, 0x01, 0xA4, 0xA4, 0x89, 0xC7, 0x8B, 0xC7, 0x02, 0xA4, 0x5B, 0xF6, 0x82, 
+0xFF, 0x03, 0xF6, 0xFF, 0xFF, 0xF6, 0x82, 0xFF, 0x02, 0xF6, 0xA4, 0xA4, 0x8B, 0xC7, 0x8E, 0xC7, 
+0x09, 0xAD, 0xA4, 0x5B, 0xF6, 0x52, 0x52, 0xAD, 0x52, 0xA4, 0xA4, 0x8E, 0xC7, 0xA7, 0xC7
+};
+
+const RleImageDesc MPG = {40, 40, MPG_lines, MPG_rle, PALETTE_884, 0xC7};
+
+// RotaryTable: 40x39, raw 1560 bytes, RLE 1269 bytes
+static const uint16_t RotaryTable_lines[] = {
+0, 10, 28, 52, 80, 107, 141, 176, 211, 246, 282, 318, 354, 390, 424, 461, 
+502, 537, 578, 618, 645, 676, 713, 747, 776, 807, 846, 885, 923, 961, 996, 1028, 
+1058, 1086, 1111, 1134, 1155, 1168, 1180
+};
+
+static const uint8_t RotaryTable_rle[] = {
+0x8A, 0xC7, 0x82, 0xFF, 0x83, 0xF6, 0x83, 0xFF, 0x91, 0xC7, 0x87, 0xC7, 0x04, 0xFF, 0xAD, 0x5B, 
+0x5B, 0x52, 0x86, 0xA4, 0x04, 0x5B, 0xA4, 0xA4, 0xF6, 0xFF, 0x8E, 0xC7, 0x85, 0xC7, 0x07, 0xFF, 
+0xA4, 0x5B, 0xAD, 0xF6, 0xFF, 0xFF, 0xF6, 0x84, 0xAD, 0x07, 0xF6, 0xFF, 0xFF, 0xF6, 0xA4, 0x5B, 
+0xA4, 0xFF, 0x8C, 0xC7, 0x84, 0xC7, 0x04, 0xF6, 0x00, 0xF6, 0xFF, 0xF6, 0x82, 0xAD, 0x00, 0xF6, 
+0x83, 0xFF, 0x0A, 0xF6, 0xAD, 0xA4, 0x5B, 0xA4, 0xF6, 0xAD, 0x09, 0xAD, 0xAD, 0xFF, 0x8A, 0xC7, 
+0x82, 0xC7, 0x08, 0xF6, 0x52, 0x09, 0x09, 0xA4, 0x5B, 0xAD, 0xFF, 0xF6, 0x87, 0xA4, 0x09, 0xAD, 
+0xF6, 0xAD, 0x52, 0x5B, 0x00, 0xA4, 0xA4, 0x5B, 0xFF, 0x89, 0xC7, 0x81, 0xC7, 0x0E, 0xF6, 0x5B, 
+0xFF, 0xAD, 0x09, 0x09, 0x52, 0xA4, 0x5B, 0xA4, 0xF6, 0xFF, 0xFF, 0xF6, 0xF6, 0x82, 0xFF, 0x03, 
+0xAD, 0x09, 0x5B, 0x5B, 0x82, 0xA4, 0x03, 0xFF, 0xF6, 0x5B, 0xFF, 0x88, 0xC7, 0x80, 0xC7, 0x13, 
+0xFF, 0x52, 0xFF, 0xFF, 0xA4, 0xFF, 0xAD, 0x52, 0x09, 0x52, 0xA4, 0x5B, 0x5B, 0x00, 0x52, 0xA4, 
+0x5B, 0x09, 0x52, 0xA4, 0x82, 0x5B, 0x06, 0xF6, 0xFF, 0xAD, 0xA4, 0xFF, 0xAD, 0xA4, 0x88, 0xC7, 
+0x1F, 0xFF, 0x5B, 0xF6, 0xFF, 0xAD, 0xFF, 0xFF, 0x5B, 0xAD, 0xAD, 0x52, 0x09, 0x52, 0x5B, 0xF6, 
+0x52, 0x09, 0xF6, 0x09, 0x5B, 0x5B, 0x09, 0xFF, 0xFF, 0xA4, 0xF6, 0xFF, 0x5B, 0xF6, 0xFF, 0x52, 
+0xFF, 0x87, 0xC7, 0x1F, 0xFF, 0x52, 0xFF, 0xFF, 0xAD, 0xFF, 0xF6, 0xA4, 0xFF, 0xA4, 0xF6, 0xA4, 
+0x09, 0x00, 0xA4, 0xAD, 0xA4, 0x00, 0x00, 0x09, 0xF6, 0xF6, 0xA4, 0xFF, 0xFF, 0x5B, 0xFF, 0xF6, 
+0xA4, 0xFF, 0xAD, 0xAD, 0x87, 0xC7, 0x20, 0xF6, 0x52, 0xFF, 0xF6, 0xFF, 0xFF, 0xA4, 0xF6, 0xFF, 
+0xA4, 0xFF, 0xFF, 0x5B, 0x5B, 0x00, 0x09, 0x09, 0x00, 0x00, 0xAD, 0xAD, 0xFF, 0x5B, 0xFF, 0xFF, 
+0x5B, 0xFF, 0xFF, 0xA4, 0xFF, 0xF6, 0x5B, 0xFF, 0x86, 0xC7, 0x0E, 0xF6, 0x52, 0xFF, 0xF6, 0xF6, 
+0xFF, 0xA4, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0x52, 0xF6, 0x09, 0x82, 0x00, 0x0E, 0xA4, 0x5B, 0xF6, 
+0xFF, 0x5B, 0xFF, 0xFF, 0x5B, 0xFF, 0xF6, 0xA4, 0xFF, 0xAD, 0x5B, 0xFF, 0x86, 0xC7, 0x20, 0xF6, 
+0x09, 0xFF, 0xFF, 0xAD, 0xFF, 0xF6, 0xF6, 0xFF, 0xA4, 0xAD, 0xA4, 0x52, 0x52, 0xAD, 0xF6, 0xAD, 
+0xA4, 0x09, 0x52, 0xA4, 0x5B, 0xF6, 0xFF, 0xA4, 0xF6, 0xFF, 0xA4, 0xF6, 0xFF, 0xA4, 0x52, 0xFF, 
+0x86, 0xC7, 0x20, 0xF6, 0x52, 0xAD, 0xFF, 0xF6, 0xF6, 0xFF, 0xA4, 0xAD, 0xA4, 0x5B, 0x52, 0x5B, 
+0xF6, 0xF6, 0xAD, 0xAD, 0xF6, 0xAD, 0x09, 0x52, 0x52, 0xAD, 0xA4, 0xA4, 0xFF, 0xAD, 0xA4, 0xFF, 
+0xF6, 0x5B, 0x52, 0xFF, 0x86, 0xC7, 0x07, 0xF6, 0x5B, 0xA4, 0xF6, 0xFF, 0xF6, 0xAD, 0xAD, 0x82, 
+0x5B, 0x83, 0xAD, 0x83, 0xA4, 0x0F, 0xAD, 0xAD, 0x5B, 0x52, 0x5B, 0xAD, 0xAD, 0x5B, 0xFF, 0xFF, 
+0x52, 0xF6, 0x00, 0x5B, 0xF6, 0xFF, 0x84, 0xC7, 0x0C, 0xF6, 0x52, 0xFF, 0x5B, 0xAD, 0xF6, 0xA4, 
+0x5B, 0x09, 0xA4, 0xA4, 0xAD, 0xAD, 0x84, 0xFF, 0x11, 0xF6, 0xA4, 0x5B, 0xA4, 0xAD, 0x5B, 0x52, 
+0x52, 0xAD, 0xF6, 0x52, 0xF6, 0xF6, 0xAD, 0xFF, 0x5B, 0x5B, 0xFF, 0x83, 0xC7, 0x0E, 0xF6, 0x00, 
+0xFF, 0xFF, 0x09, 0x52, 0x09, 0x5B, 0xAD, 0xAD, 0xF6, 0xFF, 0xF6, 0xAD, 0xAD, 0x82, 0xA4, 0x0C, 
+0xAD, 0xF6, 0xFF, 0xF6, 0xAD, 0xA4, 0xA4, 0x52, 0x52, 0x09, 0xA4, 0xFF, 0x5B, 0x82, 0xFF, 0x03, 
+0xF6, 0x5B, 0xA4, 0xFF, 0x81, 0xC7, 0x0C, 0xF6, 0x5B, 0x5B, 0xFF, 0x00, 0xAD, 0x00, 0xA4, 0xFF, 
+0xFF, 0xF6, 0xAD, 0xF6, 0x87, 0xAD, 0x09, 0xF6, 0xFF, 0xFF, 0xAD, 0x00, 0xA4, 0x5B, 0xA4, 0xAD, 
+0xA4, 0x83, 0xFF, 0x02, 0xAD, 0x00, 0xFF, 0x81, 0xC7, 0x07, 0xF6, 0xA4, 0xAD, 0xA4, 0xF6, 0xAD, 
+0xA4, 0xAD, 0x82, 0xA4, 0x00, 0xF6, 0x82, 0xFF, 0x01, 0x52, 0x00, 0x82, 0xFF, 0x09, 0xF6, 0xAD, 
+0x5B, 0x52, 0xA4, 0x5B, 0xA4, 0xA4, 0xAD, 0x52, 0x82, 0xFF, 0x04, 0xF6, 0xAD, 0xF6, 0x5B, 0xFF, 
+0x81, 0xC7, 0x0B, 0xF6, 0xA4, 0xFF, 0xAD, 0xA4, 0xF6, 0xAD, 0xF6, 0xFF, 0xFF, 0xF6, 0xAD, 0x82, 
+0xA4, 0x06, 0x5B, 0xA4, 0xA4, 0xAD, 0xA4, 0xAD, 0xF6, 0x82, 0xFF, 0x03, 0xA4, 0xAD, 0xAD, 0x52, 
+0x82, 0xFF, 0x82, 0xAD, 0x02, 0xFF, 0x5B, 0xFF, 0x81, 0xC7, 0x07, 0xF6, 0x5B, 0xFF, 0xFF, 0xF6, 
+0x52, 0xAD, 0xF6, 0x90, 0xFF, 0x0C, 0xAD, 0x52, 0xA4, 0xFF, 0xFF, 0xAD, 0xAD, 0xFF, 0xA4, 0xA4, 
+0xFF, 0xA4, 0xFF, 0x81, 0xC7, 0x01, 0xF6, 0x09, 0x82, 0xFF, 0x00, 0x52, 0x82, 0x5B, 0x01, 0xF6, 
+0xF6, 0x8A, 0xFF, 0x08, 0xF6, 0xAD, 0x5B, 0x5B, 0xF6, 0xFF, 0xF6, 0xAD, 0xF6, 0x84, 0xFF, 0x01, 
+0xA4, 0xFF, 0x81, 0xC7, 0x13, 0xF6, 0x00, 0xF6, 0xFF, 0xA4, 0x52, 0x09, 0xFF, 0xF6, 0xAD, 0xA4, 
+0x5B, 0xA4, 0xF6, 0xAD, 0xF6, 0xF6, 0xAD, 0xF6, 0xAD, 0x82, 0xA4, 0x00, 0xAD, 0x82, 0xFF, 0x01, 
+0xAD, 0xF6, 0x86, 0xFF, 0x01, 0xA4, 0xFF, 0x81, 0xC7, 0x06, 0xF6, 0x5B, 0x52, 0xF6, 0xF6, 0x5B, 
+0xA4, 0x84, 0xFF, 0x07, 0xF6, 0xAD, 0xA4, 0x00, 0x5B, 0xA4, 0xAD, 0xF6, 0x84, 0xFF, 0x01, 0xAD, 
+0xAD, 0x85, 0xFF, 0x04, 0xF6, 0x52, 0xFF, 0x52, 0xF6, 0x81, 0xC7, 0x04, 0xF6, 0x52, 0xAD, 0x5B, 
+0xF6, 0x87, 0xFF, 0x02, 0xF6, 0x52, 0xF6, 0x86, 0xFF, 0x02, 0xF6, 0xA4, 0xF6, 0x86, 0xFF, 0x05, 
+0xF6, 0xA4, 0xAD, 0xA4, 0x52, 0xF6, 0x80, 0xC7, 0x05, 0xFF, 0x52, 0xF6, 0xA4, 0x09, 0x5B, 0x83, 
+0xFF, 0x04, 0xF6, 0xAD, 0xF6, 0x52, 0xA4, 0x86, 0xFF, 0x01, 0xAD, 0xAD, 0x87, 0xFF, 0x07, 0xF6, 
+0xA4, 0x5B, 0xF6, 0xF6, 0xA4, 0x5B, 0xFF, 0x80, 0xC7, 0x08, 0xF6, 0x52, 0xFF, 0x52, 0x00, 0x09, 
+0xAD, 0xF6, 0x52, 0x82, 0x00, 0x03, 0x09, 0x52, 0x52, 0xAD, 0x82, 0xFF, 0x04, 0xAD, 0xAD, 0xFF, 
+0x52, 0xAD, 0x85, 0xFF, 0x08, 0xAD, 0xAD, 0xF6, 0x5B, 0xA4, 0xF6, 0xFF, 0x5B, 0xFF, 0x81, 0xC7, 
+0x0A, 0xAD, 0x5B, 0xF6, 0xA4, 0xAD, 0xA4, 0x00, 0xF6, 0xAD, 0x5B, 0x5B, 0x82, 0xA4, 0x07, 0x09, 
+0x5B, 0xAD, 0x5B, 0xF6, 0xFF, 0xFF, 0xF6, 0x84, 0xFF, 0x0A, 0xF6, 0xAD, 0xFF, 0xFF, 0xAD, 0xAD, 
+0xFF, 0xFF, 0xAD, 0x5B, 0xFF, 0x81, 0xC7, 0x05, 0xFF, 0xAD, 0x52, 0xF6, 0xFF, 0xF6, 0x82, 0xA4, 
+0x08, 0xFF, 0xAD, 0x5B, 0x52, 0x00, 0xAD, 0x09, 0xF6, 0xAD, 0x86, 0xFF, 0x0B, 0xF6, 0xAD, 0xF6, 
+0xFF, 0xF6, 0xAD, 0xF6, 0xFF, 0xF6, 0x52, 0xA4, 0xFF, 0x80, 0xC7, 0x83, 0xC7, 0x0E, 0xF6, 0x52, 
+0x5B, 0xAD, 0xAD, 0xA4, 0xF6, 0xA4, 0x5B, 0xA4, 0x09, 0x00, 0x52, 0xAD, 0x52, 0x83, 0xFF, 0x0E, 
+0xAD, 0xAD, 0xFF, 0xAD, 0xAD, 0xFF, 0xFF, 0xAD, 0xF6, 0xFF, 0xFF, 0x5B, 0x52, 0xF6, 0xFF, 0x81, 
+0xC7, 0x84, 0xC7, 0x0D, 0xFF, 0xF6, 0x52, 0xA4, 0xA4, 0xAD, 0x5B, 0x52, 0x09, 0x00, 0x09, 0x00, 
+0xAD, 0x52, 0x83, 0xFF, 0x0C, 0x5B, 0xAD, 0x5B, 0xF6, 0xFF, 0xF6, 0xAD, 0xFF, 0xFF, 0xAD, 0x09, 
+0xAD, 0xFF, 0x83, 0xC7, 0x86, 0xC7, 0x0B, 0xFF, 0x5B, 0xAD, 0xA4, 0x00, 0x52, 0x09, 0x52, 0x52, 
+0x00, 0xA4, 0x52, 0x82, 0xFF, 0x0B, 0xF6, 0xAD, 0xF6, 0x5B, 0x5B, 0xAD, 0xF6, 0xFF, 0xF6, 0x5B, 
+0xA4, 0xFF, 0x85, 0xC7, 0x86, 0xC7, 0x18, 0xFF, 0xA4, 0xAD, 0x5B, 0x5B, 0x00, 0x52, 0x5B, 0xAD, 
+0x00, 0x52, 0x09, 0xF6, 0xFF, 0xAD, 0x5B, 0xF6, 0xFF, 0xAD, 0xF6, 0xFF, 0xFF, 0xA4, 0x5B, 0xF6, 
+0x87, 0xC7, 0x87, 0xC7, 0x16, 0xF6, 0x5B, 0xAD, 0xA4, 0xAD, 0xA4, 0xF6, 0xA4, 0x09, 0x00, 0xA4, 
+0x52, 0x52, 0xF6, 0xFF, 0xAD, 0x5B, 0xFF, 0xFF, 0xAD, 0x52, 0xAD, 0xFF, 0x88, 0xC7, 0x88, 0xC7, 
+0x13, 0xA4, 0xA4, 0xAD, 0x5B, 0xAD, 0x5B, 0xA4, 0x00, 0x09, 0xF6, 0xF6, 0xAD, 0x5B, 0xAD, 0xFF, 
+0xAD, 0xF6, 0x52, 0xA4, 0xFF, 0x8A, 0xC7, 0x88, 0xC7, 0x08, 0xFF, 0x5B, 0xA4, 0xA4, 0x09, 0x52, 
+0xAD, 0x00, 0xAD, 0x82, 0xC7, 0x05, 0xFF, 0xAD, 0x5B, 0x09, 0x52, 0xF6, 0x8C, 0xC7, 0x87, 0xC7, 
+0x09, 0xFF, 0xAD, 0x52, 0x52, 0xAD, 0xFF, 0xF6, 0x00, 0xA4, 0xFF, 0x84, 0xC7, 0x02, 0xFF, 0xF6, 
+0xFF, 0x8D, 0xC7, 0x87, 0xC7, 0x07, 0xF6, 0x00, 0x00, 0xAD, 0xFF, 0xF6, 0x52, 0xF6, 0x97, 0xC7, 
+0x87, 0xC7, 0x06, 0xFF, 0x00, 0x00, 0x09, 0xA4, 0x5B, 0xFF, 0x98, 0xC7, 0x87, 0xC7, 0x05, 0xFF, 
+0xA4, 0x00, 0x00, 0xAD, 0xFF, 0x99, 0xC7
+};
+
+const RleImageDesc RotaryTable = {40, 39, RotaryTable_lines, RotaryTable_rle, PALETTE_884, 0xC7};
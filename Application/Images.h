@@ -19,12 +19,10 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "RleImage.h"
 
 // *****************************************************************************
 // ***   Data   ****************************************************************
 // *****************************************************************************
-extern const ImageDesc MPG;
-extern const ImageDesc RotaryTable;
-
-extern const uint8_t MPG_data[];
-extern const uint8_t RotaryTable_data[];
+extern const RleImageDesc MPG;
+extern const RleImageDesc RotaryTable;
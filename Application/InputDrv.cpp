@@ -19,8 +19,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "InputDrv.h"
-
-#include <cstdlib>
+#include "JogTrace.h"
 
 // *****************************************************************************
 // ***   Button callback data   ************************************************
@@ -64,11 +63,49 @@ Result InputDrv::InitTask(TIM_HandleTypeDef& htm, uint32_t ch)
 // *****************************************************************************
 Result InputDrv::Setup()
 {
+  // Semaphore to wake up task from interrupts
+  semaphore = xSemaphoreCreateBinary();
+
   // Start timer to process encoder
   if(htim != nullptr)
   {
     HAL_TIM_Encoder_Start(htim, channel);
+    // Channels 3 & 4 aren't used by encoder, so they used as output compare
+    // without outputs to get interrupt on the next click in both directions.
+    // Counter is 32 bit, so CCR wraps the same way as counter.
+    last_enc_value = htim->Instance->CNT;
+    htim->Instance->CCR3 = last_enc_value + 2;
+    htim->Instance->CCR4 = last_enc_value - 2;
+    __HAL_TIM_CLEAR_IT(htim, TIM_IT_CC3 | TIM_IT_CC4);
+    __HAL_TIM_ENABLE_IT(htim, TIM_IT_CC3 | TIM_IT_CC4);
+    // Priority must allow FreeRTOS API calls from interrupt
+    HAL_NVIC_SetPriority(TIM2_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
   }
+
+  // Edge interrupts for buttons. All of them have the same priority as
+  // encoder interrupt, so they can't interrupt each other and events queue
+  // have single producer.
+  for(uint32_t i = 0U; i < BTN_MAX; i++)
+  {
+    if(buttons[i].use_exti)
+    {
+      GPIO_InitTypeDef GPIO_InitStruct = {0};
+      GPIO_InitStruct.Pin = buttons[i].button_pin;
+      GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
+      GPIO_InitStruct.Pull = GPIO_PULLUP;
+      HAL_GPIO_Init(buttons[i].button_port, &GPIO_InitStruct);
+    }
+  }
+  HAL_NVIC_SetPriority(EXTI0_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+  HAL_NVIC_SetPriority(EXTI1_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(EXTI1_IRQn);
+  HAL_NVIC_SetPriority(EXTI2_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(EXTI2_IRQn);
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
   // Init ticks variable
   last_wake_ticks = RtosTick::GetTickCount();
   // Always Ok
@@ -80,104 +117,173 @@ Result InputDrv::Setup()
 // *****************************************************************************
 Result InputDrv::Loop()
 {
+  // Clear debounce flag, it will be set again if any button isn't stable yet
+  is_debounce = false;
+
   // Process all buttons
   for(uint32_t i = 0U; i < BTN_MAX; i++)
   {
+    // Pin state differs from button state - debounce in progress
+    if((HAL_GPIO_ReadPin(buttons[i].button_port, buttons[i].button_pin) == buttons[i].pin_state) != buttons[i].btn_state)
+    {
+      is_debounce = true;
+    }
+
     if(ProcessButtonInput(buttons[i]))
     {
-      // Lock mutex before walking the callback list
-      mutex.Lock();
-      // Pointer to callback list element
-      CallbackListEntry* btn_cbl = btn_callback_list;
-      // Send notification
-      while(btn_cbl != nullptr)
+      // Send notification to top handler for this button
+      CallbackListEntry handler;
+      if(FindHandler(btn_handlers, 1u << i, handler) != nullptr)
       {
-        if(btn_cbl->mask & (1u << i))
-        {
-          // Copy callback list entry before releasing the mutex
-          CallbackListEntry btn_cbl_data = *btn_cbl;
-          // Release mutex before call callback: entry data is copied and
-          // callback itself may add/remove handlers
-          mutex.Release();
-
-          // If there no AppTask pointer
-          if(btn_cbl_data.callback_task == nullptr)
-          {
-            // Call callback directly in InputDrv task(semaphores in other task may be needed!)
-            btn_cbl_data.callback(btn_cbl_data.obj_ptr, &btn_callback_data[i][buttons[i].btn_state]);
-          }
-          else
-          {
-            // Otherwise call it via AppTask to execute callback in target task
-            btn_cbl_data.callback_task->Callback(btn_cbl_data.callback, btn_cbl_data.obj_ptr, &btn_callback_data[i][buttons[i].btn_state]);
-          }
-          // Lock mutex again before break the cycle
-          mutex.Lock();
-          // Only first handler gets notification
-          break;
-        }
-        btn_cbl = btn_cbl->next;
+        CallHandler(handler, &btn_callback_data[i][buttons[i].btn_state]);
       }
-      // Release mutex after callback list is processed
-      mutex.Release();
     }
   }
 
-  // Process encoder
-  int32_t enc_val = GetEncoderState(last_enc_value);
-  // If it isn't 0
-  if(enc_val)
+  // Process events from interrupts
+  int32_t enc_val = 0;
+  InputEvent evt;
+  while(events.Pop(evt))
   {
-    uint32_t ms_per_click = (RtosTick::GetTimeMs() - last_enc_ms) / abs(enc_val);
-    // Save timestamp
-    last_enc_ms = RtosTick::GetTimeMs();
-    // We limited 1 click per ms (or 10 revolution per second for 100 clicks encoder)
-    if(ms_per_click == 0u)
+    // Button events only wake up the task: pins are read with debounce above
+    if(evt.type == EVT_BUTTON)
     {
-      ms_per_click = 1u;
+      btn_event_queued = false;
     }
-    // Calculate speed(clicks per second)
-    enc_speed = 1000u / ms_per_click;
-
-    // Lock mutex before walking the callback list
-    mutex.Lock();
-    // Pointer to callback list element
-    CallbackListEntry* enc_cbl = enc_callback_list;
-    // Send notification
-    while(enc_cbl != nullptr)
+    else if(evt.type == EVT_ENCODER)
     {
-      // Copy callback list entry before releasing the mutex
-      CallbackListEntry enc_cbl_data = *enc_cbl;
-      // Release mutex before call callback: entry data is copied and
-      // callback itself may add/remove handlers
-      mutex.Release();
-
-      // If there no AppTask pointer
-      if(enc_cbl_data.callback_task == nullptr)
-      {
-        // Call callback directly in InputDrv task(semaphores in other task may be needed!)
-        enc_cbl_data.callback(enc_cbl_data.obj_ptr, (void*)enc_val);
-      }
-      else
-      {
-        // Otherwise call it via AppTask to execute callback in target task
-        enc_cbl_data.callback_task->Callback(enc_cbl_data.callback, enc_cbl_data.obj_ptr, (void*)enc_val);
-      }
-      // Lock mutex again before break the cycle
-      mutex.Lock();
-      // Only first handler gets notification
-      break;
+      // Lock mutex before change speed estimator
+      speed_mutex.Lock();
+      // Save clicks timestamp from interrupt for speed estimation
+      enc_speed.AddClicks(evt.time_ms, evt.value);
+      // Release mutex
+      speed_mutex.Release();
+      // Jog latency trace: task took clicks
+      JOG_TRACE(INPUT);
+      // Clicks from all events sent by one callback
+      enc_val += evt.value;
+    }
+    else
+    {
+      ; // Do nothing - MISRA rule
     }
-    // Release mutex after callback list is processed
-    mutex.Release();
+  }
+  // If interrupt couldn't queue clicks, generate compare event to call it
+  // again now, when queue is empty
+  if(enc_event_deferred)
+  {
+    enc_event_deferred = false;
+    htim->Instance->EGR = TIM_EGR_CC3G;
+  }
+  // Compare match is missed if counter passed armed value before CCR was
+  // written in interrupt. Check counter on every pass and call interrupt
+  // if there are clicks, so clicks are still queued by interrupt only.
+  else if(htim != nullptr)
+  {
+    int32_t last_enc_val = last_enc_value;
+    if(GetEncoderState(last_enc_val) != 0)
+    {
+      htim->Instance->EGR = TIM_EGR_CC3G;
+    }
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
   }
 
-  // Pause until next tick
-  RtosTick::DelayUntilMs(last_wake_ticks, 1U);
+  // Send clicks to top handler. If handler task queue was full, accumulated
+  // clicks are sent again on every pass until notification is queued.
+  CallbackListEntry handler;
+  CallbackListEntry* cble = FindHandler(enc_handlers, BTNM_ALL, handler);
+  if((cble != nullptr) && ((enc_val != 0) || ((cble->pending_clicks != 0) && !cble->notify_pending)))
+  {
+    SendEncoderClicks(*cble, handler, enc_val);
+  }
+
+  // Debounce counts polls, so poll every 1 ms regardless of interrupts
+  if(is_debounce)
+  {
+    // Pause until next tick
+    RtosTick::DelayUntilMs(last_wake_ticks, 1U);
+  }
+  else
+  {
+    // Sleep until interrupt or time to poll buttons without EXTI
+    xSemaphoreTake(semaphore, pdMS_TO_TICKS(INPUT_IDLE_POLL_MS));
+    // Debounce ticks start from wake up time
+    last_wake_ticks = RtosTick::GetTickCount();
+  }
   // Always run
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Buttons IRQ handler   *************************************************
+// *****************************************************************************
+void InputDrv::ButtonsIrqHandler(uint16_t pins)
+{
+  BaseType_t task_woken = pdFALSE;
+  // Event with timestamp of the first edge. If queue is full, task is awake
+  // anyway and will read pins.
+  if(!btn_event_queued)
+  {
+    InputEvent evt = {xTaskGetTickCountFromISR() * portTICK_PERIOD_MS, EVT_BUTTON, pins};
+    btn_event_queued = events.Push(evt);
+  }
+  // Wake up task
+  if(semaphore != nullptr) xSemaphoreGiveFromISR(semaphore, &task_woken);
+  portYIELD_FROM_ISR(task_woken);
+}
+
+// *****************************************************************************
+// ***   Encoder IRQ handler   *************************************************
+// *****************************************************************************
+void InputDrv::EncoderIrqHandler()
+{
+  BaseType_t task_woken = pdFALSE;
+  // Clear flags
+  __HAL_TIM_CLEAR_IT(htim, TIM_IT_CC3 | TIM_IT_CC4);
+  // Clicks since last event. Saved value isn't updated if queue is full, so
+  // clicks will be sent with next event.
+  int32_t last_enc_val = last_enc_value;
+  int32_t clicks = GetEncoderState(last_enc_val);
+  if(clicks != 0)
+  {
+    // Jog latency trace: encoder click
+    JOG_TRACE(CLICK);
+    InputEvent evt = {xTaskGetTickCountFromISR() * portTICK_PERIOD_MS, EVT_ENCODER, clicks};
+    if(events.Push(evt))
+    {
+      last_enc_value = last_enc_val;
+    }
+    else
+    {
+      enc_event_deferred = true;
+    }
+  }
+  // Arm compare for the next click in both directions from current click
+  htim->Instance->CCR3 = last_enc_val + 2;
+  htim->Instance->CCR4 = last_enc_val - 2;
+  // Wake up task
+  if(semaphore != nullptr) xSemaphoreGiveFromISR(semaphore, &task_woken);
+  portYIELD_FROM_ISR(task_woken);
+}
+
+// *****************************************************************************
+// ***   Get Encoder speed   ***************************************************
+// *****************************************************************************
+uint32_t InputDrv::GetEncoderSpeed()
+{
+  // Lock mutex since clicks are added from InputDrv task
+  speed_mutex.Lock();
+  // Get speed at current time
+  uint32_t speed = enc_speed.GetSpeed(RtosTick::GetTimeMs());
+  // Release mutex
+  speed_mutex.Release();
+  // Return result
+  return speed;
+}
+
 // *****************************************************************************
 // ***   Process Button Input function   ***************************************
 // *****************************************************************************
@@ -217,194 +323,260 @@ bool InputDrv::ProcessButtonInput(ButtonProfile& button)
 // *****************************************************************************
 // ***   Public: Add Buttons Callback handler   ********************************
 // *****************************************************************************
-void InputDrv::AddButtonsCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, uint8_t mask, CallbackListEntry& cble)
+Result InputDrv::AddButtonsCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, uint8_t mask, CallbackListEntry& cble, HandlerPriority priority)
 {
   // Set data in callback entry
   cble.callback_task = callback_task;
   cble.callback = callback;
   cble.obj_ptr = obj_ptr;
   cble.mask = mask;
+  cble.priority = priority;
+  // Publish new version with this handler
+  return UpdateHandlers(btn_handlers, btn_tables, cble, true);
+}
 
-  // Lock mutex
+// *****************************************************************************
+// ***   Public: Delete Buttons Callback handler   *****************************
+// *****************************************************************************
+void InputDrv::DeleteButtonsCallbackHandler(CallbackListEntry& cble)
+{
+  // Publish new version without this handler
+  (void)UpdateHandlers(btn_handlers, btn_tables, cble, false);
+}
+
+// *****************************************************************************
+// ***   Public: Add Encoder Callback handler   ********************************
+// *****************************************************************************
+Result InputDrv::AddEncoderCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, CallbackListEntry& cble, HandlerPriority priority)
+{
+  // Set data in callback entry
+  cble.callback_task = callback_task;
+  cble.callback = callback;
+  cble.obj_ptr = obj_ptr;
+  cble.mask = BTNM_ALL; // Encoder handler match any event
+  cble.priority = priority;
+  // Publish new version with this handler
+  return UpdateHandlers(enc_handlers, enc_tables, cble, true);
+}
+
+// *****************************************************************************
+// ***   Public: Delete Encoder Callback handler   *****************************
+// *****************************************************************************
+void InputDrv::DeleteEncoderCallbackHandler(CallbackListEntry& cble)
+{
+  // Publish new version without this handler. Clicks that wasn't delivered
+  // are dropped there.
+  (void)UpdateHandlers(enc_handlers, enc_tables, cble, false);
+}
+
+// *****************************************************************************
+// ***   Private: Update handlers table   **************************************
+// *****************************************************************************
+Result InputDrv::UpdateHandlers(HandlerTable* volatile& handlers, HandlerTable (&tables)[2u], CallbackListEntry& cble, bool add)
+{
+  Result result = Result::RESULT_OK;
+
+  // Lock mutex: only one writer at a time
   mutex.Lock();
 
-  // If callback list is empty
-  if(btn_callback_list == nullptr)
+  // Current version and version to prepare
+  HandlerTable* cur = handlers;
+  HandlerTable* next = (cur == &tables[0u]) ? &tables[1u] : &tables[0u];
+
+  // InputDrv task may still read previous version. Its priority is lower
+  // than priority of application task, so wait instead of spin.
+  while(reading == next)
   {
-    // Clear pointers just in case
-    cble.next = nullptr;
-    cble.prev = nullptr;
-    // Set as first element
-    btn_callback_list = &cble;
+    RtosTick::DelayMs(1u);
+  }
+
+  // Copy current version without this handler
+  next->cnt = 0u;
+  for(uint32_t i = 0u; i < cur->cnt; i++)
+  {
+    if(cur->entries[i].cble != &cble)
+    {
+      next->entries[next->cnt++] = cur->entries[i];
+    }
   }
-  else // Otherwise
+
+  if(add)
   {
-    // Try to find element in list
-    CallbackListEntry* btn_cbl = btn_callback_list;
-    // Try to find this handler in the list
-    while(btn_cbl != nullptr)
+    if(next->cnt < INPUT_HANDLERS_MAX)
     {
-      if(btn_cbl == &cble) break;   // Handler found - break cycle
-      else btn_cbl = btn_cbl->next; // Handler not found - set next element pointer
+      // New handler goes before all handlers with the same or lower priority
+      uint32_t pos = next->cnt;
+      while((pos > 0u) && (next->entries[pos - 1u].data.priority <= cble.priority))
+      {
+        next->entries[pos] = next->entries[pos - 1u];
+        pos--;
+      }
+      next->entries[pos].cble = &cble;
+      next->entries[pos].data = cble;
+      next->cnt++;
     }
-    // Check if this handler already in the list and if not
-    if(btn_cbl != &cble)
+    else
     {
-      // Set as previous into existing head element
-      btn_callback_list->prev = &cble;
-      // Set next element pointer
-      cble.next = btn_callback_list;
-      // Clear previous pointers just in case
-      cble.prev = nullptr;
-      // Set as head
-      btn_callback_list = &cble;
+      result = Result::ERR_CANNOT_EXECUTE;
     }
   }
 
+  // InputDrv task can take handler from the previous version and add clicks
+  // after it is deleted, so clicks are accepted only by registered handler.
+  // Notification may be still in the queue, but it will not call handler
+  // without clicks.
+  taskENTER_CRITICAL();
+  if(add && result.IsGood())
+  {
+    // Clicks of previous registration are dropped
+    if(!cble.registered) cble.pending_clicks = 0;
+    cble.registered = true;
+  }
+  else
+  {
+    cble.registered = false;
+    cble.pending_clicks = 0;
+  }
+  taskEXIT_CRITICAL();
+
+  // New version have to be written before InputDrv task can see it
+  __DMB();
+  handlers = next;
+
   // Release mutex
   mutex.Release();
+
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
-// ***   Public: Delete Buttons Callback handler   *****************************
+// ***   Private: Find handler   ***********************************************
 // *****************************************************************************
-void InputDrv::DeleteButtonsCallbackHandler(CallbackListEntry& cble)
+InputDrv::CallbackListEntry* InputDrv::FindHandler(HandlerTable* volatile& handlers, uint8_t mask, CallbackListEntry& handler)
 {
-  // Lock mutex
-  mutex.Lock();
+  CallbackListEntry* result = nullptr;
 
-  // If requested first element in list
-  if(btn_callback_list == &cble)
+  // Mark published version as used. If writer published new version before
+  // mark was set, it could already start to reuse marked one - try again.
+  HandlerTable* table = nullptr;
+  do
   {
-    btn_callback_list = cble.next;
-    // List may become empty - check pointer before dereference
-    if(btn_callback_list != nullptr) btn_callback_list->prev = nullptr;
+    table = handlers;
+    reading = table;
+    __DMB();
   }
-  else // Otherwise
+  while(table != handlers);
+
+  // Handlers are sorted, so the first match is the top handler
+  for(uint32_t i = 0u; i < table->cnt; i++)
   {
-    // Try to find element in list
-    CallbackListEntry* btn_cbl = btn_callback_list;
-    // Try to find this handler in the list
-    while(btn_cbl != nullptr)
+    if(table->entries[i].data.mask & mask)
     {
-      if(btn_cbl == &cble) break;   // Handler found - break cycle
-      else btn_cbl = btn_cbl->next; // Handler not found - set next element pointer
-    }
-    // Check if this handler in the list
-    if(btn_cbl == &cble)
-    {
-      // Set next pointer for previous element
-      cble.prev->next = cble.next;
-      // Id next element exist
-      if(cble.next != nullptr)
-      {
-        // Set it as next element for previous one
-        cble.next->prev = cble.prev;
-      }
+      // Copy data, since writer can reuse version after mark is cleared
+      handler = table->entries[i].data;
+      result = table->entries[i].cble;
+      break;
     }
   }
-  // Clear pointers in removed entry to prevent stale links on reuse
-  cble.next = nullptr;
-  cble.prev = nullptr;
 
-  // Release mutex
-  mutex.Release();
+  // Handler data have to be read before writer can reuse version
+  __DMB();
+  reading = nullptr;
+
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
-// ***   Public: Add Encoder Callback handler   ********************************
+// ***   Private: Call handler   ***********************************************
 // *****************************************************************************
-void InputDrv::AddEncoderCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, CallbackListEntry& cble)
+void InputDrv::CallHandler(const CallbackListEntry& handler, void* ptr)
 {
-  // Set data in callback entry
-  cble.callback_task = callback_task;
-  cble.callback = callback;
-  cble.obj_ptr = obj_ptr;
-
-  // Lock mutex
-  mutex.Lock();
+  // If there no AppTask pointer
+  if(handler.callback_task == nullptr)
+  {
+    // Call callback directly in InputDrv task(semaphores in other task may be needed!)
+    handler.callback(handler.obj_ptr, ptr);
+  }
+  else
+  {
+    // Otherwise call it via AppTask to execute callback in target task
+    handler.callback_task->Callback(handler.callback, handler.obj_ptr, ptr);
+  }
+}
 
-  // If callback list is empty
-  if(enc_callback_list == nullptr)
+// *****************************************************************************
+// ***   Private: Send encoder clicks   ****************************************
+// *****************************************************************************
+void InputDrv::SendEncoderClicks(CallbackListEntry& cble, const CallbackListEntry& handler, int32_t clicks)
+{
+  // If there no AppTask pointer
+  if(handler.callback_task == nullptr)
   {
-    // Clear pointers just in case
-    cble.next = nullptr;
-    cble.prev = nullptr;
-    // Set as first element
-    enc_callback_list = &cble;
+    // Handler called directly, nothing to accumulate
+    CallHandler(handler, (void*)clicks);
   }
-  else // Otherwise
+  else
   {
-    // Try to find element in list
-    CallbackListEntry* btn_cbl = enc_callback_list;
-    // Try to find this handler in the list
-    while(btn_cbl != nullptr)
+    // Add clicks and check if handler task should be notified. Handler task
+    // priority can be higher, so it can take clicks in the middle of update.
+    // Deleted handler doesn't take clicks.
+    taskENTER_CRITICAL();
+    bool notify = false;
+    if(cble.registered)
     {
-      if(btn_cbl == &cble) break;   // Handler found - break cycle
-      else btn_cbl = btn_cbl->next; // Handler not found - set next element pointer
+      cble.pending_clicks += clicks;
+      notify = !cble.notify_pending;
+      cble.notify_pending = true;
     }
-    // Check if this handler already in the list and if not
-    if(btn_cbl != &cble)
+    taskEXIT_CRITICAL();
+
+    // Only one notification in the queue regardless of encoder speed
+    if(notify)
     {
-      // Set as previous into existing head element
-      enc_callback_list->prev = &cble;
-      // Set next element pointer
-      cble.next = enc_callback_list;
-      // Clear previous pointers just in case
-      cble.prev = nullptr;
-      // Set as head
-      enc_callback_list = &cble;
+      if(handler.callback_task->Callback(reinterpret_cast<CallbackPtr>(EncoderClicksCallback), &cble, nullptr) != Result::RESULT_OK)
+      {
+        // Queue is full: clicks stay accumulated, next Loop() pass will try
+        // again even if there are no new clicks
+        cble.notify_pending = false;
+      }
     }
   }
-
-  // Release mutex
-  mutex.Release();
 }
 
 // *****************************************************************************
-// ***   Public: Delete Encoder Callback handler   *****************************
+// ***   Private: Encoder clicks callback   ************************************
 // *****************************************************************************
-void InputDrv::DeleteEncoderCallbackHandler(CallbackListEntry& cble)
+Result InputDrv::EncoderClicksCallback(void* obj_ptr, void* ptr)
 {
-  // Lock mutex
-  mutex.Lock();
+  Result result = Result::ERR_NULL_PTR;
 
-  // If requested first element in list
-  if(enc_callback_list == &cble)
-  {
-    enc_callback_list = cble.next;
-    // List may become empty - check pointer before dereference
-    if(enc_callback_list) enc_callback_list->prev = nullptr;
-  }
-  else // Otherwise
+  if(obj_ptr != nullptr)
   {
-    // Try to find element in list
-    CallbackListEntry* btn_cbl = enc_callback_list;
-    // Try to find this handler in the list
-    while(btn_cbl != nullptr)
+    CallbackListEntry& cble = *(static_cast<CallbackListEntry*>(obj_ptr));
+    // Take all accumulated clicks. Next clicks will send new notification.
+    taskENTER_CRITICAL();
+    int32_t clicks = cble.registered ? cble.pending_clicks : 0;
+    cble.pending_clicks = 0;
+    cble.notify_pending = false;
+    taskEXIT_CRITICAL();
+
+    // Clicks are dropped if handler was deleted
+    if(clicks != 0)
     {
-      if(btn_cbl == &cble) break;   // Handler found - break cycle
-      else btn_cbl = btn_cbl->next; // Handler not found - set next element pointer
+      // Jog latency trace: clicks delivered to handler task
+      JOG_TRACE(HANDLER);
+      result = cble.callback(cble.obj_ptr, (void*)clicks);
     }
-    // Check if this handler in the list
-    if(btn_cbl == &cble)
+    else
     {
-      // Set next pointer for previous element
-      cble.prev->next = cble.next;
-      // Id next element exist
-      if(cble.next != nullptr)
-      {
-        // Set it as next element for previous one
-        cble.next->prev = cble.prev;
-      }
+      result = Result::RESULT_OK;
     }
   }
-  // Clear pointers in removed entry to prevent stale links on reuse
-  cble.next = nullptr;
-  cble.prev = nullptr;
 
-  // Release mutex
-  mutex.Release();
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -460,3 +632,41 @@ int32_t InputDrv::GetEncoderState(int32_t& last_enc_val)
   return retval;
 }
 
+
+// *****************************************************************************
+// ***   Interrupt handlers   **************************************************
+// *****************************************************************************
+extern "C" void EXTI0_IRQHandler(void)
+{
+  // BTN_USR
+  __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_0);
+  InputDrv::GetInstance().ButtonsIrqHandler(GPIO_PIN_0);
+}
+
+extern "C" void EXTI1_IRQHandler(void)
+{
+  // BTN_LEFT
+  __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_1);
+  InputDrv::GetInstance().ButtonsIrqHandler(GPIO_PIN_1);
+}
+
+extern "C" void EXTI2_IRQHandler(void)
+{
+  // BTN_RIGHT
+  __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_2);
+  InputDrv::GetInstance().ButtonsIrqHandler(GPIO_PIN_2);
+}
+
+extern "C" void EXTI15_10_IRQHandler(void)
+{
+  // BTN_LU, BTN_RU & BTN_RD
+  uint16_t pins = __HAL_GPIO_EXTI_GET_IT(GPIO_PIN_10 | GPIO_PIN_11 | GPIO_PIN_12 | GPIO_PIN_13 | GPIO_PIN_14 | GPIO_PIN_15);
+  __HAL_GPIO_EXTI_CLEAR_IT(pins);
+  InputDrv::GetInstance().ButtonsIrqHandler(pins);
+}
+
+extern "C" void TIM2_IRQHandler(void)
+{
+  // Encoder
+  InputDrv::GetInstance().EncoderIrqHandler();
+}
@@ -53,6 +53,10 @@
 // *****************************************************************************
 #include "DevCore.h"
 
+#include "EncoderSpeed.h"
+#include "SpscQueue.h"
+#include "semphr.h"
+
 // *****************************************************************************
 // * Input Driver Class. This class implement work with user input elements like 
 // * buttons and encoders.
@@ -89,6 +93,18 @@ class InputDrv : public AppTask
     // All buttons mask
     static constexpr uint8_t BTNM_ALL = (BTNM_LEFT | BTNM_RIGHT | BTNM_LEFT_UP | BTNM_LEFT_DOWN | BTNM_RIGHT_UP | BTNM_RIGHT_DOWN | BTNM_USR);
 
+    // *************************************************************************
+    // ***   Enum with handler priorities   ************************************
+    // *************************************************************************
+    // Event goes to the matching handler with the highest priority. Between
+    // handlers with the same priority the last added one gets the event.
+    typedef enum : uint8_t
+    {
+      PRIORITY_BACKGROUND = 0u, // Application wide handlers: header, menu tabs
+      PRIORITY_SCREEN,          // Screens and widgets on them
+      PRIORITY_MODAL            // Modal windows: message & change value boxes
+    } HandlerPriority;
+
     // *************************************************************************
     // ***   Structure to describe callback   **********************************
     // *************************************************************************
@@ -99,9 +115,14 @@ class InputDrv : public AppTask
         CallbackPtr callback = nullptr;
         void* obj_ptr = nullptr;
         uint8_t mask = 0u; // Mask for button callback list to handle particular button
-        struct CallbackListEntryStruct* next = nullptr;
-        struct CallbackListEntryStruct* prev = nullptr;
-        // InputDrv is friend of structure for access to pointers
+        HandlerPriority priority = PRIORITY_SCREEN;
+        // Encoder clicks not delivered to the handler yet
+        volatile int32_t pending_clicks = 0;
+        // Notification is in handler task queue: new clicks only accumulated
+        volatile bool notify_pending = false;
+        // Handler is in the table: only registered handler takes clicks
+        volatile bool registered = false;
+        // InputDrv is friend of structure for access to data
         friend class InputDrv;
     } CallbackListEntry;
 
@@ -134,28 +155,50 @@ class InputDrv : public AppTask
     // *************************************************************************
     // ***   Input Driver Loop   ***********************************************
     // *************************************************************************
-    // * If FreeRTOS task used, this function just call ProcessInput() with 1 ms
-    // * period. If FreeRTOS tick is 1 ms - this task must have highest priority 
+    // * Task sleeps until button or encoder interrupt. While button debounce
+    // * in progress buttons are polled with 1 ms period. Buttons that can't
+    // * use EXTI are polled with INPUT_IDLE_POLL_MS period.
     virtual Result Loop();
 
+    // *************************************************************************
+    // ***   Buttons IRQ handler   *********************************************
+    // *************************************************************************
+    // * Should be called from EXTI interrupt with pins that triggered it
+    void ButtonsIrqHandler(uint16_t pins);
+
+    // *************************************************************************
+    // ***   Encoder IRQ handler   *********************************************
+    // *************************************************************************
+    // * Should be called from encoder timer interrupt
+    void EncoderIrqHandler();
+
     // *************************************************************************
     // ***   Public: Add Buttons Callback handler   ****************************
     // *************************************************************************
-    void AddButtonsCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, uint8_t mask, CallbackListEntry& cble);
+    // * Return ERR_CANNOT_EXECUTE if there already INPUT_HANDLERS_MAX handlers.
+    // * Adding handler that already added updates its data and moves it to the
+    // * top of handlers with the same priority.
+    Result AddButtonsCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, uint8_t mask, CallbackListEntry& cble, HandlerPriority priority = PRIORITY_SCREEN);
 
     // *************************************************************************
     // ***   Public: Delete Buttons Callback handler   *************************
     // *************************************************************************
+    // * After return InputDrv task doesn't use handler data anymore, but
+    // * callback already sent via AppTask may still be in its queue.
     void DeleteButtonsCallbackHandler(CallbackListEntry& cble);
 
     // *************************************************************************
     // ***   Public: Add Encoder Callback handler   ****************************
     // *************************************************************************
-    void AddEncoderCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, CallbackListEntry& cble);
+    // * If handler called via AppTask, clicks are accumulated in the handle and
+    // * task has at most one notification in its queue. Handler gets all
+    // * clicks accumulated before it was called.
+    Result AddEncoderCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, CallbackListEntry& cble, HandlerPriority priority = PRIORITY_SCREEN);
 
     // *************************************************************************
     // ***   Public: Delete Encoder Callback handler   *************************
     // *************************************************************************
+    // * Clicks accumulated but not delivered yet are dropped.
     void DeleteEncoderCallbackHandler(CallbackListEntry& cble);
 
     // *************************************************************************
@@ -187,26 +230,84 @@ class InputDrv : public AppTask
     // *************************************************************************
     // ***   Get Encoder speed   ***********************************************
     // *************************************************************************
-    uint32_t GetEncoderSpeed() {return enc_speed;}
+    // Return speed in clicks per second averaged over ENCODER_SPEED_WINDOW_MS.
+    // It goes down to zero when handwheel stops.
+    uint32_t GetEncoderSpeed();
 
   private:
     // How many cycles button must change state before state will be changed in
     // result returned by GetButtonState() function. For reduce debouncing
     const static uint32_t BUTTON_READ_DELAY = 8u;
+    // Poll period for buttons without EXTI when there no debounce in progress
+    const static uint32_t INPUT_IDLE_POLL_MS = 10u;
+    // Size of events queue from interrupts, must be power of two
+    const static uint32_t INPUT_EVENTS_QUEUE_SIZE = 32u;
+    // Maximum number of handlers for buttons and for encoder
+    const static uint32_t INPUT_HANDLERS_MAX = 8u;
+
+    // Event from interrupt
+    typedef enum : uint8_t
+    {
+      EVT_BUTTON,  // Button pins edge, value is EXTI pins mask
+      EVT_ENCODER  // Encoder clicks, value is number of clicks
+    } InputEventType;
+
+    // Event with timestamp from interrupt to task
+    typedef struct
+    {
+      uint32_t time_ms;
+      InputEventType type;
+      int32_t value;
+    } InputEvent;
+
+    // Events from interrupts: written by interrupts with the same priority,
+    // read by InputDrv task
+    SpscQueue<InputEvent, INPUT_EVENTS_QUEUE_SIZE> events;
+    // Semaphore to wake up task from interrupt
+    SemaphoreHandle_t semaphore = nullptr;
+    // Button event is in queue: contact bounce shouldn't flood the queue
+    volatile bool btn_event_queued = false;
+    // Encoder event can't be queued, clicks kept by interrupt for next event
+    volatile bool enc_event_deferred = false;
+    // Flag that buttons debounce is in progress and buttons should be polled
+    // every ms
+    bool is_debounce = false;
 
     // Handle to timer used for process encoders input
     TIM_HandleTypeDef* htim = nullptr;
     // Channel that used
     uint32_t channel = 0u;
 
-    // Button handlers
-    CallbackListEntry* btn_callback_list = nullptr;
-    // Encoder handlers
-    CallbackListEntry* enc_callback_list = nullptr;
+    // Handler in table. Data copied from handle, so it can't be changed while
+    // InputDrv task dispatches an event.
+    typedef struct
+    {
+      CallbackListEntry* cble; // Handle to find handler on delete
+      CallbackListEntry data;  // Handler data
+    } HandlerEntry;
 
-    // Mutex for synchronization of callback lists add/remove(same approach
-    // as in DevCore ButtonDrv)
+    // Handlers sorted by priority, top handler first
+    typedef struct
+    {
+      HandlerEntry entries[INPUT_HANDLERS_MAX];
+      uint32_t cnt;
+    } HandlerTable;
+
+    // Every handlers table has two versions: published one used by InputDrv
+    // task without lock and one for writer to prepare the next version
+    HandlerTable btn_tables[2u] = {};
+    HandlerTable enc_tables[2u] = {};
+    // Published versions
+    HandlerTable* volatile btn_handlers = &btn_tables[0u];
+    HandlerTable* volatile enc_handlers = &enc_tables[0u];
+    // Version used by InputDrv task right now, nullptr if none. Writer can't
+    // reuse version while the task reads it.
+    HandlerTable* volatile reading = nullptr;
+
+    // Mutex for synchronization of handlers tables writers
     RtosMutex mutex;
+    // Mutex for synchronization of speed estimator
+    RtosMutex speed_mutex;
 
     // Ticks variable
     uint32_t last_wake_ticks = 0u;
@@ -214,10 +315,11 @@ class InputDrv : public AppTask
     // Last button states for GetButtonState() function. Can be called only from one place!
     bool buttons_last_state[BTN_MAX] = {0};
 
-    // Last value for reduce overhead in user task
-    int32_t last_enc_value = 0;
-    uint32_t last_enc_ms = 0u;
-    uint32_t enc_speed = 0u;
+    // Last encoder counter value aligned to click, changed by interrupt only
+    // and read by task to detect missed compare match
+    volatile int32_t last_enc_value = 0;
+    // Handwheel speed estimator
+    EncoderSpeed enc_speed;
 
     // *************************************************************************
     // ***   Structure to describe button   ************************************
@@ -230,18 +332,19 @@ class InputDrv : public AppTask
       uint8_t btn_state_cnt;    // Counter for reduce debouncing
       bool btn_state;           // Button state returned by GetButtonState() function
       bool btn_state_tmp;       // Temporary button state for reduce debouncing
+      bool use_exti;            // Edge interrupt enabled for the pin
     } ButtonProfile;
 
     // ***   Structures array for describe buttons inputs  *********************
     ButtonProfile buttons[BTN_MAX] =
     {
-      {BTN_LEFT_GPIO_Port,  BTN_LEFT_Pin,  GPIO_PIN_RESET, 0, false, false},
-      {BTN_RIGHT_GPIO_Port, BTN_RIGHT_Pin, GPIO_PIN_RESET, 0, false, false},
-      {BTN_LU_GPIO_Port,    BTN_LU_Pin,    GPIO_PIN_RESET, 0, false, false},
-      {BTN_LD_GPIO_Port,    BTN_LD_Pin,    GPIO_PIN_RESET, 0, false, false},
-      {BTN_RU_GPIO_Port,    BTN_RU_Pin,    GPIO_PIN_RESET, 0, false, false},
-      {BTN_RD_GPIO_Port,    BTN_RD_Pin,    GPIO_PIN_RESET, 0, false, false},
-      {BTN_USR_GPIO_Port,   BTN_USR_Pin,   GPIO_PIN_RESET, 0, false, false}
+      {BTN_LEFT_GPIO_Port,  BTN_LEFT_Pin,  GPIO_PIN_RESET, 0, false, false, true},
+      {BTN_RIGHT_GPIO_Port, BTN_RIGHT_Pin, GPIO_PIN_RESET, 0, false, false, true},
+      {BTN_LU_GPIO_Port,    BTN_LU_Pin,    GPIO_PIN_RESET, 0, false, false, true},
+      {BTN_LD_GPIO_Port,    BTN_LD_Pin,    GPIO_PIN_RESET, 0, false, false, false}, // EXTI1 used by BTN_LEFT
+      {BTN_RU_GPIO_Port,    BTN_RU_Pin,    GPIO_PIN_RESET, 0, false, false, true},
+      {BTN_RD_GPIO_Port,    BTN_RD_Pin,    GPIO_PIN_RESET, 0, false, false, true},
+      {BTN_USR_GPIO_Port,   BTN_USR_Pin,   GPIO_PIN_RESET, 0, false, false, true}
     };
 
     // *************************************************************************
@@ -254,6 +357,40 @@ class InputDrv : public AppTask
     // *************************************************************************
     bool ProcessButtonInput(ButtonProfile& button);
 
+    // *************************************************************************
+    // ***   Private: Update handlers table   **********************************
+    // *************************************************************************
+    // * Publish new version of handlers table without cble and, if add is
+    // * true, with cble inserted according to its priority
+    Result UpdateHandlers(HandlerTable* volatile& handlers, HandlerTable (&tables)[2u], CallbackListEntry& cble, bool add);
+
+    // *************************************************************************
+    // ***   Private: Find handler   *******************************************
+    // *************************************************************************
+    // * Copy top handler that match mask from published version and return its
+    // * handle or nullptr if there no handler. Lock free, can be called by
+    // * InputDrv task only.
+    CallbackListEntry* FindHandler(HandlerTable* volatile& handlers, uint8_t mask, CallbackListEntry& handler);
+
+    // *************************************************************************
+    // ***   Private: Call handler   *******************************************
+    // *************************************************************************
+    void CallHandler(const CallbackListEntry& handler, void* ptr);
+
+    // *************************************************************************
+    // ***   Private: Send encoder clicks   ************************************
+    // *************************************************************************
+    // * Accumulate clicks in handle and notify handler task if it has no
+    // * notification in the queue yet. Called with zero clicks to retry
+    // * notification that didn't fit into full queue.
+    void SendEncoderClicks(CallbackListEntry& cble, const CallbackListEntry& handler, int32_t clicks);
+
+    // *************************************************************************
+    // ***   Private: Encoder clicks callback   ********************************
+    // *************************************************************************
+    // * Executed in handler task: take all accumulated clicks and call handler
+    static Result EncoderClicksCallback(void* obj_ptr, void* ptr);
+
     // *************************************************************************
     // ** Private constructor. Only GetInstance() allow to access this class. **
     // *************************************************************************
@@ -0,0 +1,144 @@
+//******************************************************************************
+//  @file JogTrace.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details JogTrace: latency trace from encoder click to machine motion,
+//           implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "JogTrace.h"
+
+#include <cstdio>  // For snprintf()
+
+// *****************************************************************************
+// ***   Stage names: first column is total latency   **************************
+// *****************************************************************************
+const char* const JogTrace::stage_str[STAGE_CNT] = {"total", "input", "handler", "jog", "uart tx", "ack", "motion"};
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+JogTrace& JogTrace::GetInstance()
+{
+  static JogTrace jog_trace;
+  return jog_trace;
+}
+
+// *****************************************************************************
+// ***   Public: Setup   *******************************************************
+// *****************************************************************************
+void JogTrace::Setup(uint32_t ticks)
+{
+  ticks_per_us = (ticks != 0u) ? ticks : 1u;
+  timeout_ticks = JOG_TRACE_TIMEOUT_MS * 1000u * ticks_per_us;
+  last_stage = STAGE_CNT;
+  cnt = 0u;
+}
+
+// *****************************************************************************
+// ***   Public: Mark   ********************************************************
+// *****************************************************************************
+void JogTrace::Mark(Stage stage, uint32_t ticks)
+{
+  if(stage == CLICK)
+  {
+    // Start new trace if there no trace in progress or it is stale
+    if((last_stage == STAGE_CNT) || (ticks - trace[CLICK] > timeout_ticks))
+    {
+      trace[CLICK] = ticks;
+      // Timestamp have to be written before next stage can see it
+      last_stage = CLICK;
+    }
+  }
+  // Stage is marked only right after previous one
+  else if((stage < STAGE_CNT) && (last_stage == stage - 1u))
+  {
+    // Stale trace is dropped: stage belongs to other activity(i.e. motion
+    // started by program, not by clicks of this trace)
+    if(ticks - trace[CLICK] > timeout_ticks)
+    {
+      last_stage = STAGE_CNT;
+    }
+    else if(stage == MOTION)
+    {
+      trace[stage] = ticks;
+      // Save latencies of the finished trace
+      volatile uint32_t* rec = records[cnt & (JOG_TRACE_RECORDS - 1u)];
+      rec[CLICK] = ticks - trace[CLICK];
+      for(uint32_t i = INPUT; i < STAGE_CNT; i++)
+      {
+        rec[i] = trace[i] - trace[i - 1u];
+      }
+      cnt = cnt + 1u;
+      // Next click starts new trace
+      last_stage = STAGE_CNT;
+    }
+    else
+    {
+      trace[stage] = ticks;
+      last_stage = stage;
+    }
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Report   ******************************************************
+// *****************************************************************************
+uint32_t JogTrace::Report(char* buf, uint32_t size)
+{
+  uint32_t len = 0u;
+  uint32_t n = (cnt < JOG_TRACE_RECORDS) ? cnt : JOG_TRACE_RECORDS;
+
+  len += snprintf(buf + len, size - len, "Jog latency, us: %lu of %lu traces\r\n", (unsigned long)n, (unsigned long)cnt);
+  len += snprintf(buf + len, size - len, "%-8s %7s %7s %7s %7s\r\n", "stage", "p50", "p90", "p99", "max");
+
+  // Total latency printed last, after stages
+  for(uint32_t s = INPUT; (s <= STAGE_CNT) && (n > 0u) && (len < size); s++)
+  {
+    uint32_t col = (s == STAGE_CNT) ? (uint32_t)CLICK : s;
+    // Copy stage latencies and sort them
+    uint32_t val[JOG_TRACE_RECORDS];
+    for(uint32_t i = 0u; i < n; i++)
+    {
+      uint32_t v = records[i][col] / ticks_per_us;
+      // Insertion sort: no more than JOG_TRACE_RECORDS values
+      uint32_t j = i;
+      for(; (j > 0u) && (val[j - 1u] > v); j--) val[j] = val[j - 1u];
+      val[j] = v;
+    }
+    len += snprintf(buf + len, size - len, "%-8s %7lu %7lu %7lu %7lu\r\n", stage_str[col],
+                    (unsigned long)Percentile(val, n, 50u), (unsigned long)Percentile(val, n, 90u),
+                    (unsigned long)Percentile(val, n, 99u), (unsigned long)val[n - 1u]);
+  }
+
+  // snprintf() returns length it wants to write
+  return (len < size) ? len : size - 1u;
+}
+
+// *****************************************************************************
+// ***   Private: Percentile   *************************************************
+// *****************************************************************************
+uint32_t JogTrace::Percentile(const uint32_t* val, uint32_t n, uint32_t pct)
+{
+  // Rank is rounded up, so p99 of less than 100 values is maximum
+  uint32_t rank = (n * pct + 99u) / 100u;
+  if(rank == 0u) rank = 1u;
+  return val[rank - 1u];
+}
@@ -0,0 +1,141 @@
+//******************************************************************************
+//  @file JogTrace.h
+//  @author Nicolai Shlapunov
+//
+//  @details JogTrace: latency trace from encoder click to machine motion, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef JogTrace_h
+#define JogTrace_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   Debug defines   *******************************************************
+// *****************************************************************************
+
+// Jog latency trace: timestamps of every stage from encoder click to first
+// status report with motion. Report with latency percentiles for every stage
+// is sent over USB CDC every JOG_TRACE_REPORT_MS. Uses the same USB CDC as
+// SEND_DATA_TO_USB, so they can't be enabled together.
+//#define JOG_TRACE_ENABLED
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Number of stored traces, must be power of two
+#define JOG_TRACE_RECORDS 64u
+
+// Trace not finished in this time is dropped(i.e. clicks on screen without
+// jog or jog rejected by controller). Checked by every stage, so stale trace
+// can't be finished by unrelated activity.
+#define JOG_TRACE_TIMEOUT_MS 1000u
+
+// Report period
+#define JOG_TRACE_REPORT_MS 5000u
+
+// Trace point. Timestamp is DWT cycle counter, so it can be called from
+// interrupts and tasks of any priority.
+#if defined(JOG_TRACE_ENABLED)
+  #define JOG_TRACE(stage) JogTrace::GetInstance().Mark(JogTrace::stage, DWT->CYCCNT)
+#else
+  #define JOG_TRACE(stage)
+#endif
+
+// *****************************************************************************
+// ***   JogTrace Class   ******************************************************
+// *****************************************************************************
+// Every stage is marked by one task(or interrupt) only and only if previous
+// stage is already marked, so trace is passed from task to task without lock.
+// Click that comes while trace is in progress doesn't start new trace. Pure C++
+// without HAL or RTOS calls, so the same report can be made by host simulation.
+class JogTrace
+{
+  public:
+    // Stages in order of execution
+    enum Stage : uint8_t
+    {
+      CLICK,   // Encoder interrupt
+      INPUT,   // InputDrv task took clicks from interrupt
+      HANDLER, // Application task called screen encoder handler
+      JOG,     // Screen sent jog command to GrblComm queue
+      UART_TX, // GrblComm started jog command transmission
+      ACK,     // Controller accepted jog command
+      MOTION,  // First status report with motion
+      STAGE_CNT
+    };
+
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static JogTrace& GetInstance();
+
+    // *************************************************************************
+    // ***   Public: Setup   ***************************************************
+    // *************************************************************************
+    // Timestamp resolution: timer ticks in one microsecond
+    void Setup(uint32_t ticks);
+
+    // *************************************************************************
+    // ***   Public: Mark   ****************************************************
+    // *************************************************************************
+    void Mark(Stage stage, uint32_t ticks);
+
+    // *************************************************************************
+    // ***   Public: GetCount   ************************************************
+    // *************************************************************************
+    // Number of finished traces since Setup(), can be bigger than number of
+    // stored ones
+    uint32_t GetCount() {return cnt;}
+
+    // *************************************************************************
+    // ***   Public: Report   **************************************************
+    // *************************************************************************
+    // Print latency percentiles of every stage for stored traces. Returns
+    // string length.
+    uint32_t Report(char* buf, uint32_t size);
+
+  private:
+    // Stage names for report
+    static const char* const stage_str[STAGE_CNT];
+
+    // Timestamps of trace in progress
+    volatile uint32_t trace[STAGE_CNT] = {0u};
+    // Last marked stage of trace in progress, STAGE_CNT if there no trace
+    volatile uint8_t last_stage = STAGE_CNT;
+    // Finished traces: stage latencies in ticks
+    volatile uint32_t records[JOG_TRACE_RECORDS][STAGE_CNT] = {0u};
+    // Number of finished traces
+    volatile uint32_t cnt = 0u;
+    // Timestamp resolution
+    uint32_t ticks_per_us = 1u;
+    // Trace timeout in ticks
+    uint32_t timeout_ticks = JOG_TRACE_TIMEOUT_MS * 1000u;
+
+    // *************************************************************************
+    // ***   Private: Percentile   *********************************************
+    // *************************************************************************
+    // Nearest rank percentile of sorted values
+    static uint32_t Percentile(const uint32_t* val, uint32_t n, uint32_t pct);
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    JogTrace() {};
+};
+
+#endif
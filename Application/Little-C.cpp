@@ -3,15 +3,28 @@
 // *****************************************************************************
 
 #include <stdio.h>
+#include <stdint.h>
 #include <math.h>
 #include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(LITTLEC_HOST) // Host build uses stubbed machine bindings
+#include "GrblCommStub.h"
+#else
 #include "GrblComm.h" // For internal functions
+#endif
 
 #include "Little-C.h"
 
+#if defined(LITTLEC_PROFILER)
+#if defined(USE_HAL_DRIVER) // For DWT cycle counter
+#include "stm32f4xx.h"
+#else // For host build
+#include <chrono>
+#endif
+#endif
+
 const LittleC::intern_func_type LittleC::intern_func[] =
 {
   "putch", &LittleC::call_putch,
@@ -43,6 +56,8 @@ void LittleC::SetPgmBuffer(char* p_text, int size)
   func_index = 0;
   // Clear global variable index
   gvar_index = 0;
+  // Clear folded conditions
+  fold_index = 0;
 }
 
 // *****************************************************************************
@@ -54,7 +69,7 @@ bool LittleC::SetOutputBuf(char* p_obuf, int size)
   output_size = size;
   cur_pos = 0;
   // Return true if buffer is exist
-  return ((p_buf != nullptr) && (size != 0));
+  return ((p_obuf != nullptr) && (size != 0));
 }
 
 // *****************************************************************************
@@ -80,6 +95,8 @@ bool LittleC::Prescan()
     func_index = 0;
     // Initialize global variable index
     gvar_index = 0;
+    // Initialize folded conditions index
+    fold_index = 0;
     // Undefined token before prescan
     tok = UNDEFTOK;
 
@@ -172,6 +189,14 @@ bool LittleC::Prescan()
     }
 
     if(result && brace) result = sntx_err(UNBAL_BRACES);
+
+    // Find conditions that can't change during execution. Errors in folding
+    // are ignored: such conditions are evaluated during execution.
+    if(result)
+    {
+      fold_conditions();
+      cur_pos = 0;
+    }
   }
 
   // Clear number of variables
@@ -238,6 +263,8 @@ bool LittleC::SetGlobalVariableValue(int variable_idx, int val)
   if((variable_idx >= 0) && (variable_idx < gvar_index))
   {
     var_stack[variable_idx].data.value = val;
+    // Folded conditions may use this parameter
+    fold_dirty = true;
     result = true;
   }
   // Return result
@@ -254,6 +281,8 @@ bool LittleC::ResetGlobalVariableValue(int variable_idx)
   if((variable_idx >= 0) && (variable_idx < gvar_index))
   {
     result = true;
+    // Folded conditions may use this parameter
+    fold_dirty = true;
 
     // Set prog pointer to global variable
     prog = var_stack[variable_idx].name;
@@ -341,6 +370,25 @@ bool LittleC::Execute()
   // Clear ret value
   ret_data = {0};
 
+  // Save output buffer size to restore it after arena release
+  output_buf_size = output_size;
+  // Arena for arrays ends at the aligned end of the output buffer
+  p_arena = nullptr;
+  if(p_output != nullptr)
+  {
+    p_arena = (int*)((uintptr_t)&p_output[output_size] & ~(uintptr_t)(sizeof(int) - 1u));
+  }
+  // Arena is empty
+  arena_set_top(0);
+
+  // Evaluate folded conditions if parameters changed since previous run
+  if(fold_dirty)
+  {
+    eval_folds();
+    // Clear current position since errors in folding are ignored
+    cur_pos = 0;
+  }
+
   // Setup call to main()
   int idx = find_func("main");  // find program starting point
   if(idx != -1)
@@ -348,7 +396,13 @@ bool LittleC::Execute()
     prog = func_table[idx].loc;
     prog--; // back up to opening '('
     strncpy(token, "main", sizeof(token));
+#if defined(LITTLEC_PROFILER)
+    prof_start();
+#endif
     result = call(data);  // call main() to start interpreting
+#if defined(LITTLEC_PROFILER)
+    if(result) prof_report();
+#endif
     // Check result If we filled whole buffer
     if(cur_pos >= output_size - 1)
     {
@@ -369,6 +423,10 @@ bool LittleC::Execute()
     if(p_output != nullptr) snprintf(p_output, output_size, "main() not found");
   }
 
+  // Release arena and give space back to the output buffer
+  p_arena = nullptr;
+  output_size = output_buf_size;
+
   return result;
 }
 
@@ -386,6 +444,8 @@ bool LittleC::interp_block(void)
 
   // Save local var stack index
   int lvartemp = lvartos;
+  // Save arena index
+  int arenatemp = arena_top;
 
   do
   {
@@ -394,6 +454,11 @@ bool LittleC::interp_block(void)
     // If bad result - break the cycle
     if(result == false) break;
 
+#if defined(LITTLEC_PROFILER)
+    // Count statement using location of its first token
+    if((token_type != BLOCK) && (tok != END)) prof_statement(prog - strlen(token));
+#endif
+
     // See what kind of token is up
     if((token_type == IDENTIFIER) || (*token == INC) || (*token == DEC) || (*token == '(')) // Not a keyword, so process expression.
     {
@@ -435,8 +500,12 @@ bool LittleC::interp_block(void)
           result = exec_if();
           break;
         case ELSE:      // process an else statement
-          result = find_eob(); // find end of else block and continue execution
+        {
+          const fold_type* fold = find_fold(prog);
+          if(fold != nullptr) prog = fold->eob; // else block of folded condition - jump to the end of it
+          else result = find_eob(); // find end of else block and continue execution
           break;
+        }
         case WHILE:     // process a while loop
           result = exec_while();
           break;
@@ -462,6 +531,8 @@ bool LittleC::interp_block(void)
 
   // Reset the local var stack
   lvartos = lvartemp;
+  // Release arrays declared in this scope
+  arena_set_top(arenatemp);
 
   return result;
 }
@@ -515,6 +586,7 @@ bool LittleC::decl_global(void)
 
     var_stack[gvar_index].data.type = vartype;
     var_stack[gvar_index].data.value = 0;  // init to 0
+    var_stack[gvar_index].size = 0;        // globals are never arrays
     get_token(); // Get token to get variable name pointer
     var_stack[gvar_index].name = token_ptr; // Save pointer to variable name
 
@@ -528,7 +600,9 @@ bool LittleC::decl_global(void)
     if(result)
     {
       get_token(); // Another get token to find '=', ',' or ';'
-      if(*token == '=') // is an assignment at declaration
+      // Global variables are script parameters, so they can't be arrays
+      if(*token == '[') result = sntx_err(ARRAY_GLOBAL);
+      if(result && (*token == '=')) // is an assignment at declaration
       {
         data_type data = {0};
         get_token();
@@ -557,19 +631,24 @@ bool LittleC::decl_local(void)
   get_token();
 
   // Variable struct to add into stack
-  var_type var = {nullptr, {tok, 0}};
+  var_type var = {nullptr, {tok, 0}, 0};
 
   // Process comma-separated list
   do
   {
     var.data.value = 0; // init to 0
+    var.size = 0; // not an array by default
     get_token(); // Get token to get variable name pointer
     if(token_type != IDENTIFIER) result = sntx_err(SYNTAX);
     if(result)
     {
       var.name = token_ptr; // Save pointer to variable name
-      get_token(); // Another get token to find '=', ',' or ';'
-      if(*token == '=') // is an assignment at declaration
+      get_token(); // Another get token to find '[', '=', ',' or ';'
+      if(*token == '[') // is an array declaration
+      {
+        result = decl_array(var);
+      }
+      else if(*token == '=') // is an assignment at declaration
       {
         data_type data = { 0 };
         get_token();
@@ -588,6 +667,83 @@ bool LittleC::decl_local(void)
   return result;
 }
 
+// *****************************************************************************
+// ***   Declare a local array. Token should be '[' after array name.   ********
+// *****************************************************************************
+bool LittleC::decl_array(var_type& var)
+{
+  // Array size should be a number
+  bool result = get_token();
+  if(result && ((token_type != NUMBER) || (atoi(token) <= 0) || (atoi(token) > MAX_ARRAY))) result = sntx_err(ARRAY_SIZE);
+  if(result)
+  {
+    var.size = atoi(token);
+    // Get token to pass ']'
+    result = get_token();
+    if(result && (*token != ']')) result = sntx_err(BRACKET_EXPECTED);
+  }
+  // Allocate array from the arena
+  if(result)
+  {
+    // Arena can't take space of the program result and its null-terminator
+    if((p_arena == nullptr) || (var.size * (int)sizeof(int) > output_size - cur_pos - 1))
+    {
+      result = sntx_err(NO_ARRAY_MEM);
+    }
+    else
+    {
+      arena_set_top(arena_top + var.size);
+      // First element is at the arena bottom
+      var.data.value = -arena_top;
+      // Arrays initialized with zeroes by default
+      memset(&p_arena[var.data.value], 0, var.size * sizeof(int));
+    }
+  }
+  // Another get token to find '=', ',' or ';'
+  if(result) result = get_token();
+  // Is an initializer list at declaration
+  if(result && (*token == '='))
+  {
+    result = get_token();
+    if(result && (*token != '{')) result = sntx_err(BRACE_EXPECTED);
+    // Process comma-separated list of values
+    for(int i = 0; result && (*token != '}'); i++)
+    {
+      if(i >= var.size)
+      {
+        result = sntx_err(ARRAY_INDEX);
+      }
+      else
+      {
+        data_type data = {0};
+        result = eval_exp(data);
+        // Apply the declared type to the value (char values are truncated)
+        if(var.data.type == CHAR) p_arena[var.data.value + i] = (char)data.value;
+        else p_arena[var.data.value + i] = data.value;
+        if(result) result = get_token();
+        if(result && (*token != ',') && (*token != '}')) result = sntx_err(SYNTAX);
+      }
+    }
+    // Get token to find ',' or ';'
+    if(result) result = get_token();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Set number of used arena elements and limit output to the space   *****
+// ***   below the arena                                                   *****
+// *****************************************************************************
+void LittleC::arena_set_top(int top)
+{
+  arena_top = top;
+  if(p_arena != nullptr)
+  {
+    output_size = (int)((char*)(p_arena - arena_top) - p_output);
+  }
+}
+
 // *****************************************************************************
 // ***   Call a function   *****************************************************
 // *****************************************************************************
@@ -602,6 +758,9 @@ bool LittleC::call(data_type& data)
   }
   else
   {
+#if defined(LITTLEC_PROFILER)
+    uint32_t prof_call_ts = prof_ticks();
+#endif
     int arg_count = 0;
     int lvartemp = lvartos;  // save local var stack index
     result = get_args(arg_count);  // get function arguments
@@ -620,6 +779,10 @@ bool LittleC::call(data_type& data)
       prog = temp; // reset the program pointer
       result = func_pop(lvartos); // reset the local var stack
     }
+#if defined(LITTLEC_PROFILER)
+    prof_func_count[idx]++;
+    prof_func_ticks[idx] += prof_ticks() - prof_call_ts;
+#endif
   }
 
   return result;
@@ -872,6 +1035,320 @@ bool LittleC::is_var(char *var_name)
   return (get_var_index(var_name) != -1);
 }
 
+// *****************************************************************************
+// ***   Determine if an identifier is an array.   *****************************
+// *****************************************************************************
+bool LittleC::is_array(char *var_name)
+{
+  int var_index = get_var_index(var_name);
+  return ((var_index != -1) && (var_stack[var_index].size != 0));
+}
+
+// *****************************************************************************
+// ***   Get index of array element in the arena. Token should be array   *****
+// ***   name, after return token is closing bracket.                     *****
+// *****************************************************************************
+bool LittleC::get_array_elem(int var_index, int& elem)
+{
+  data_type idx = {0};
+
+  bool result = get_token();
+  if(result && (*token != '[')) result = sntx_err(BRACKET_EXPECTED);
+  if(result) result = eval_exp(idx);
+  if(result) result = get_token();
+  if(result && (*token != ']')) result = sntx_err(BRACKET_EXPECTED);
+  // Bounds check
+  if(result && ((idx.value < 0) || (idx.value >= var_stack[var_index].size))) result = sntx_err(ARRAY_INDEX);
+  if(result) elem = var_stack[var_index].data.value + idx.value;
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Assign a value to an array element   **********************************
+// *****************************************************************************
+void LittleC::assign_elem(int var_index, int elem, const data_type& data)
+{
+  if(var_stack[var_index].data.type == CHAR) p_arena[elem] = (char)data.value;
+  else p_arena[elem] = data.value;
+}
+
+// *****************************************************************************
+// ***   Determine if an array element is assigned. Token should be array   ***
+// ***   name, it is restored before return.                                ***
+// *****************************************************************************
+bool LittleC::is_array_assign(void)
+{
+  bool result = false;
+
+  // Save pointer to array name
+  const char* name = token_ptr;
+
+  // Find closing bracket without evaluation
+  get_token();
+  int bracket = (*token == '[') ? 1 : 0;
+  while(bracket && (tok != END) && (*token != ';'))
+  {
+    get_token();
+    if(*token == '[') bracket++;
+    if(*token == ']') bracket--;
+  }
+
+  // Get operation after the closing bracket
+  if((*token == ']') && (bracket == 0))
+  {
+    get_token();
+    result = is_assign_op(*token);
+  }
+
+  // Restore array name token
+  prog = name;
+  get_token();
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Find conditions of if statements which use only constants and    ******
+// ***   global variables never assigned by the program and locations of  ******
+// ***   their blocks, so exec_if() doesn't evaluate condition and scan   ******
+// ***   for the block end. Called once by Prescan().                     ******
+// *****************************************************************************
+bool LittleC::fold_conditions(void)
+{
+  bool result = true;
+
+  // Global variable constant flags
+  bool is_const[NUM_VARS];
+  for(int i = 0; i < gvar_index; i++) is_const[i] = true;
+
+  // Clear folded conditions table and counters
+  fold_index = 0;
+  folded_cnt = 0;
+  eliminated_cnt = 0;
+
+  // First pass: find global variables that assigned or shadowed by local variables or parameters
+  prog = p_buf;
+  tok = UNDEFTOK;
+  bool decl = false;  // Inside declaration
+  char prev = '\0';   // First character of previous token
+  bool prev_type = false; // Previous token is a type
+  while(result && (tok != END))
+  {
+    result = get_token();
+    if(!result || (tok == END)) break;
+
+    if((tok == INT) || (tok == CHAR)) decl = true;
+    if((*token == ';') || (*token == '{')) decl = false;
+
+    if(token_type == IDENTIFIER)
+    {
+      int idx = find_global(token_ptr);
+      // Skip declaration of global variable itself
+      if((idx != -1) && (var_stack[idx].name != token_ptr))
+      {
+        // Declared as local variable or parameter, or incremented/decremented by prefix operator
+        if((decl && (prev_type || (prev == ','))) || (prev == INC) || (prev == DEC)) is_const[idx] = false;
+        // Look ahead to find assignment or postfix operator
+        const char* tp = prog;
+        result = get_token();
+        if(result && (is_assign_op(*token) || (*token == INC) || (*token == DEC))) is_const[idx] = false;
+        prog = tp;
+        tok = UNDEFTOK;
+        *token = '\0';
+      }
+    }
+
+    prev = *token;
+    prev_type = ((tok == INT) || (tok == CHAR));
+  }
+
+  // Second pass: find foldable conditions and ends of their blocks
+  prog = p_buf;
+  tok = UNDEFTOK;
+  while(result && (tok != END))
+  {
+    result = get_token();
+    if(!result || (tok == END)) break;
+
+    if((tok == IF) && (fold_index + 2 <= NUM_FOLDS))
+    {
+      // Location after if keyword
+      const char* loc = prog;
+      fold_type fold = {loc, nullptr, nullptr, false, false, 0};
+      bool fold_result = is_foldable(is_const);
+      // Find end of if block
+      if(fold_result)
+      {
+        fold.end = prog;
+        tok = UNDEFTOK;
+        fold_result = find_eob();
+        fold.eob = prog;
+      }
+      // Find end of else block
+      if(fold_result)
+      {
+        fold_result = get_token();
+        if(fold_result && (tok == ELSE))
+        {
+          fold_type fold_else = {prog, nullptr, nullptr, false, true, 0};
+          fold_result = find_eob();
+          fold_else.eob = prog;
+          if(fold_result)
+          {
+            add_fold(fold_else);
+            fold.has_else = true;
+          }
+        }
+      }
+      if(fold_result)
+      {
+        add_fold(fold);
+        folded_cnt++;
+      }
+      // Continue from the condition to process nested statements
+      prog = loc;
+      tok = UNDEFTOK;
+    }
+  }
+
+  // Conditions have to be evaluated before the first run
+  fold_dirty = true;
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Evaluate folded conditions and count branches that never execute   ***
+// *****************************************************************************
+void LittleC::eval_folds(void)
+{
+  eliminated_cnt = 0;
+
+  for(int i = 0; i < fold_index; i++)
+  {
+    // Only if conditions are evaluated, else blocks don't have them
+    if(fold_table[i].end != nullptr)
+    {
+      data_type cond = {0};
+      prog = fold_table[i].loc;
+      tok = UNDEFTOK;
+      // Condition that can't be evaluated(i.e. division by zero) is evaluated
+      // during execution to report an error in place
+      fold_table[i].known = eval_exp(cond, true);
+      fold_table[i].value = cond.value;
+      // False condition eliminates if block, true one eliminates else block
+      if(fold_table[i].known && (!cond.value || fold_table[i].has_else)) eliminated_cnt++;
+    }
+  }
+
+  fold_dirty = false;
+}
+
+// *****************************************************************************
+// ***   Check if condition uses only constants and constant global   **********
+// ***   variables. Program pointer should be after if keyword.       **********
+// *****************************************************************************
+bool LittleC::is_foldable(const bool* is_const)
+{
+  bool result = get_token();
+
+  if(result && (*token != '(')) result = false;
+
+  int parenthesis = 1;
+  while(result && parenthesis)
+  {
+    result = get_token();
+    if(!result) break;
+    if(*token == '(')      parenthesis++;
+    else if(*token == ')') parenthesis--;
+    else ; // Do nothing - MISRA rule
+
+    if(token_type == IDENTIFIER)
+    {
+      int idx = find_global(token_ptr);
+      // Only constant global variables allowed, function calls are not
+      if((idx == -1) || !is_const[idx] || (find_func(token) != -1) || (internal_func(token) != -1)) result = false;
+    }
+    else if(token_type == DELIMITER)
+    {
+      // Assignments, increments, decrements and character constants aren't allowed
+      if(is_assign_op(*token) || (*token == INC) || (*token == DEC) || (*token == '\'') || (tok == END)) result = false;
+    }
+    else if(token_type != NUMBER)
+    {
+      result = false;
+    }
+    else ; // Do nothing - MISRA rule
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Find the index of a global variable   *********************************
+// *****************************************************************************
+int LittleC::find_global(const char* name)
+{
+  int result = -1;
+
+  for(int i = 0; i < gvar_index; i++)
+  {
+    if(!strcomp(var_stack[i].name, name))
+    {
+      result = i;
+      break;
+    }
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Add folded condition to the table sorted by location   ****************
+// *****************************************************************************
+bool LittleC::add_fold(const fold_type& fold)
+{
+  bool result = false;
+
+  if(fold_index < NUM_FOLDS)
+  {
+    // Shift entries with greater location
+    int i = fold_index;
+    for(; (i > 0) && (fold_table[i - 1].loc > fold.loc); i--) fold_table[i] = fold_table[i - 1];
+    fold_table[i] = fold;
+    fold_index++;
+    result = true;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Find folded condition by location. Return nullptr if not found.   *****
+// *****************************************************************************
+const LittleC::fold_type* LittleC::find_fold(const char* loc)
+{
+  const fold_type* result = nullptr;
+
+  // Binary search
+  int lo = 0;
+  int hi = fold_index - 1;
+  while(lo <= hi)
+  {
+    int mid = (lo + hi) / 2;
+    if(fold_table[mid].loc == loc)
+    {
+      result = &fold_table[mid];
+      break;
+    }
+    else if(fold_table[mid].loc < loc) lo = mid + 1;
+    else hi = mid - 1;
+  }
+
+  return result;
+}
+
 // *****************************************************************************
 // ***   Execute an if statement   *********************************************
 // *****************************************************************************
@@ -881,8 +1358,19 @@ bool LittleC::exec_if(void)
 
   // Data type to evaluate condition
   data_type cond;
-  // Evaluate condition(including comma operator)
-  result = eval_exp(cond, true);
+  // Find folded condition
+  const fold_type* fold = find_fold(prog);
+  if((fold != nullptr) && fold->known)
+  {
+    // Condition can't change - use value evaluated before execution
+    cond.value = fold->value;
+    prog = fold->end;
+  }
+  else
+  {
+    // Evaluate condition(including comma operator)
+    result = eval_exp(cond, true);
+  }
 
   if(result)
   {
@@ -893,11 +1381,19 @@ bool LittleC::exec_if(void)
     }
     else // otherwise skip around IF block and process the ELSE, if present
     {
-      // Clear tok: the condition lookahead may have left a stale keyword
-      // (e.g. RETURN if the skipped statement is 'return x;') which would
-      // falsely trigger find_eob()'s RETURN preservation.
-      tok = UNDEFTOK;
-      result = find_eob(); // find start of next line
+      if(fold != nullptr)
+      {
+        // Block end is known - jump to it
+        prog = fold->eob;
+      }
+      else
+      {
+        // Clear tok: the condition lookahead may have left a stale keyword
+        // (e.g. RETURN if the skipped statement is 'return x;') which would
+        // falsely trigger find_eob()'s RETURN preservation.
+        tok = UNDEFTOK;
+        result = find_eob(); // find start of next line
+      }
       if(result) result = get_token();
 
       if(result)
@@ -1052,6 +1548,8 @@ bool LittleC::exec_for(void)
 
   // Save local var stack index
   int lvartemp = lvartos;
+  // Save arena index
+  int arenatemp = arena_top;
 
   // To pass opening '('
   result = get_token();
@@ -1157,6 +1655,8 @@ bool LittleC::exec_for(void)
 
   // Reset the local var stack
   lvartos = lvartemp;
+  // Release arrays declared in this scope
+  arena_set_top(arenatemp);
 
   return result;
 }
@@ -1179,6 +1679,8 @@ bool LittleC::exec_switch(void)
 
   // Save local var stack index
   int lvartemp = lvartos;
+  // Save arena index
+  int arenatemp = arena_top;
 
   // Set brace counter
   int brace = 1;
@@ -1244,6 +1746,8 @@ bool LittleC::exec_switch(void)
 
   // Reset the local var stack
   lvartos = lvartemp;
+  // Release arrays declared in this scope
+  arena_set_top(arenatemp);
 
   return result;
 }
@@ -1307,6 +1811,197 @@ bool LittleC::find_eob(void)
   return result;
 }
 
+#if defined(LITTLEC_PROFILER)
+// *****************************************************************************
+// *****************************************************************************
+// ***   PROFILER   ************************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Get profiler timestamp   **********************************************
+// *****************************************************************************
+uint32_t LittleC::prof_ticks(void)
+{
+#if defined(USE_HAL_DRIVER)
+  return DWT->CYCCNT;
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// *****************************************************************************
+// ***   Get number of profiler ticks in microsecond   *************************
+// *****************************************************************************
+uint32_t LittleC::prof_ticks_per_us(void)
+{
+#if defined(USE_HAL_DRIVER)
+  return SystemCoreClock / 1000000u;
+#else
+  return 1000u;
+#endif
+}
+
+// *****************************************************************************
+// ***   Clear profiler counters and start timestamp   *************************
+// *****************************************************************************
+void LittleC::prof_start(void)
+{
+#if defined(USE_HAL_DRIVER)
+  // Enable DWT cycle counter
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+  memset(prof_table, 0, sizeof(prof_table));
+  memset(prof_func_count, 0, sizeof(prof_func_count));
+  memset(prof_func_ticks, 0, sizeof(prof_func_ticks));
+  prof_cur = nullptr;
+  prof_count = 0u;
+  prof_lost = 0u;
+  prof_start_ts = prof_ticks();
+  prof_ts = prof_start_ts;
+}
+
+// *****************************************************************************
+// ***   Count statement and charge time to the previous one   *****************
+// *****************************************************************************
+void LittleC::prof_statement(const char* loc)
+{
+  uint32_t ts = prof_ticks();
+
+  // Time since previous statement start goes to previous statement
+  if(prof_cur != nullptr) prof_cur->ticks += ts - prof_ts;
+  prof_cur = nullptr;
+  prof_count++;
+
+  // Find statement in the hash table using linear probing
+  uint32_t hash = ((uint32_t)(uintptr_t)loc * 2654435761u) >> 16u;
+  for(uint32_t i = 0u; i < NUM_PROF; i++)
+  {
+    prof_type& entry = prof_table[(hash + i) & (NUM_PROF - 1u)];
+    if((entry.loc == loc) || (entry.loc == nullptr))
+    {
+      entry.loc = loc;
+      entry.count++;
+      prof_cur = &entry;
+      break;
+    }
+  }
+  // Table is full - statement isn't counted
+  if(prof_cur == nullptr) prof_lost++;
+
+  // Don't count time spent in the profiler itself
+  prof_ts = prof_ticks();
+}
+
+// *****************************************************************************
+// ***   Add profiler report to the output buffer   ****************************
+// *****************************************************************************
+void LittleC::prof_report(void)
+{
+  char str[64];
+  uint32_t ts = prof_ticks();
+
+  // Charge time to the last statement
+  if(prof_cur != nullptr) prof_cur->ticks += ts - prof_ts;
+
+  // Move used entries to the beginning of the table
+  int n = 0;
+  for(int i = 0; i < NUM_PROF; i++)
+  {
+    if(prof_table[i].loc != nullptr) prof_table[n++] = prof_table[i];
+  }
+  // Sort entries by location
+  for(int i = 1; i < n; i++)
+  {
+    prof_type entry = prof_table[i];
+    int j = i;
+    for(; (j > 0) && (prof_table[j - 1].loc > entry.loc); j--) prof_table[j] = prof_table[j - 1];
+    prof_table[j] = entry;
+  }
+  // Find line numbers in one pass and merge statements in the same line
+  int line = 1;
+  const char* p = p_buf;
+  int m = 0;
+  for(int i = 0; i < n; i++)
+  {
+    while(p < prof_table[i].loc)
+    {
+      // Windows, Unix or Mac newline
+      if((*p == '\n') || ((*p == '\r') && (*(p + 1) != '\n'))) line++;
+      p++;
+    }
+    if((m > 0) && (prof_table[m - 1].line == line))
+    {
+      prof_table[m - 1].count += prof_table[i].count;
+      prof_table[m - 1].ticks += prof_table[i].ticks;
+    }
+    else
+    {
+      prof_table[m] = prof_table[i];
+      prof_table[m].line = line;
+      m++;
+    }
+  }
+  // Sort lines by time, the slowest first
+  for(int i = 1; i < m; i++)
+  {
+    prof_type entry = prof_table[i];
+    int j = i;
+    for(; (j > 0) && (prof_table[j - 1].ticks < entry.ticks); j--) prof_table[j] = prof_table[j - 1];
+    prof_table[j] = entry;
+  }
+
+  // Print totals
+  snprintf(str, sizeof(str), "; Profile: %lu statements, %lu us\n", (unsigned long)prof_count, (unsigned long)((ts - prof_start_ts) / prof_ticks_per_us()));
+  prof_print(str);
+  if(prof_lost != 0u)
+  {
+    snprintf(str, sizeof(str), "; Not profiled: %lu statements\n", (unsigned long)prof_lost);
+    prof_print(str);
+  }
+  // Print hot lines
+  prof_print("; Line, count, time(us)\n");
+  for(int i = 0; (i < m) && (i < NUM_PROF_REPORT); i++)
+  {
+    snprintf(str, sizeof(str), "; %d, %lu, %lu\n", prof_table[i].line, (unsigned long)prof_table[i].count, (unsigned long)(prof_table[i].ticks / prof_ticks_per_us()));
+    prof_print(str);
+  }
+  // Print functions, the slowest first. Time includes called functions.
+  prof_print("; Function, calls, time(us)\n");
+  bool printed[NUM_FUNC] = {false};
+  for(;;)
+  {
+    int idx = -1;
+    for(int i = 0; i < func_index; i++)
+    {
+      if(!printed[i] && prof_func_count[i] && ((idx == -1) || (prof_func_ticks[i] > prof_func_ticks[idx]))) idx = i;
+    }
+    if(idx == -1) break;
+    printed[idx] = true;
+    // Find function name length
+    int len = 0;
+    while(!isdelim(func_table[idx].func_name[len])) len++;
+    snprintf(str, sizeof(str), "; %.*s, %lu, %lu\n", len, func_table[idx].func_name, (unsigned long)prof_func_count[idx], (unsigned long)(prof_func_ticks[idx] / prof_ticks_per_us()));
+    prof_print(str);
+  }
+}
+
+// *****************************************************************************
+// ***   Add profiler report string to the output buffer if it fits   **********
+// *****************************************************************************
+void LittleC::prof_print(const char* str)
+{
+  int len = strlen(str);
+  // Keep space for null-terminator, report shouldn't cause output overflow
+  if((p_output != nullptr) && (cur_pos + len < output_size - 1))
+  {
+    memcpy(&p_output[cur_pos], str, len + 1);
+    cur_pos += len;
+  }
+}
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // ***   PARSER.cpp   **********************************************************
@@ -1365,7 +2060,35 @@ bool LittleC::eval_exp0(data_type& data)
 
   if(token_type == IDENTIFIER)
   {
-    if(is_var(token)) // if a var, see if assignment
+    // Get variable index
+    int var_index = get_var_index(token);
+
+    if((var_index != -1) && (var_stack[var_index].size != 0)) // if an array, see if assignment to element
+    {
+      // Look ahead to find operation after the closing bracket
+      if(is_array_assign())
+      {
+        int elem = 0;
+        result = get_array_elem(var_index, elem);
+        // Get token with assignment operation
+        if(result) result = get_token();
+        if(result)
+        {
+          register char op = *token;
+          data_type val = {0};
+          // Get element value
+          data.type = var_stack[var_index].data.type;
+          data.value = p_arena[elem];
+          get_token();
+          result = eval_exp0(val);  // get value to process
+          if(result) result = assign_op(op, data, val);
+          if(result) assign_elem(var_index, elem, data); // assign the value
+        }
+        // Set flag to not to call eval_exp1()
+        ret = true;
+      }
+    }
+    else if(var_index != -1) // if a var, see if assignment
     {
       // Holds name of var receiving the assignment
       char temp[sizeof(token)];
@@ -1374,7 +2097,7 @@ bool LittleC::eval_exp0(data_type& data)
       // Get token to figure out if it is an assignment operation
       get_token();
       register char op = *token;
-      if((op == '=') || (op == ADD) || (op == SUB) || (op == MUL) || (op == DIV) || (op == MOD))
+      if(is_assign_op(op))
       {
         result = find_var(temp, data); // get var's value
         if(result)
@@ -1382,28 +2105,7 @@ bool LittleC::eval_exp0(data_type& data)
           data_type val = {0};
           get_token();
           result = eval_exp0(val);  // get value to process
-          switch(op)
-          {
-            case ADD:
-              data.value += val.value;
-              break;
-            case SUB:
-              data.value -= val.value;
-              break;
-            case MUL:
-              data.value *= val.value;
-              break;
-            case DIV:
-              if(val.value == 0) result = sntx_err(DIV_BY_ZERO);
-              else data.value /= val.value;
-              break;
-            case MOD:
-              if(val.value == 0) result = sntx_err(DIV_BY_ZERO);
-              else data.value %= val.value;
-              break;
-            default:
-              data.value = val.value; // assignment
-          }
+          if(result) result = assign_op(op, data, val);
           if(result) result = assign_var(temp, data);  // assign the value
         }
         // Set flag to not to call eval_exp1()
@@ -1519,6 +2221,47 @@ bool LittleC::eval_exp0(data_type& data)
   return result;
 }
 
+// *****************************************************************************
+// ***   Return true if op is an assignment operation   ************************
+// *****************************************************************************
+bool LittleC::is_assign_op(char op)
+{
+  return ((op == '=') || (op == ADD) || (op == SUB) || (op == MUL) || (op == DIV) || (op == MOD));
+}
+
+// *****************************************************************************
+// ***   Apply an assignment operation   ***************************************
+// *****************************************************************************
+bool LittleC::assign_op(char op, data_type& data, const data_type& val)
+{
+  bool result = true;
+
+  switch(op)
+  {
+    case ADD:
+      data.value += val.value;
+      break;
+    case SUB:
+      data.value -= val.value;
+      break;
+    case MUL:
+      data.value *= val.value;
+      break;
+    case DIV:
+      if(val.value == 0) result = sntx_err(DIV_BY_ZERO);
+      else data.value /= val.value;
+      break;
+    case MOD:
+      if(val.value == 0) result = sntx_err(DIV_BY_ZERO);
+      else data.value %= val.value;
+      break;
+    default:
+      data.value = val.value; // assignment
+  }
+
+  return result;
+}
+
 // *****************************************************************************
 // ***   Process relational operators   ****************************************
 // *****************************************************************************
@@ -1656,24 +2399,47 @@ bool LittleC::eval_exp4(data_type& data)
   bool result = true;
   register char op = '\0';
 
+  // Flag to skip eval_exp5() if array element already processed
+  bool processed = false;
+
   if((*token == '+') || (*token == '-') || (*token == '!') || (*token == INC) || (*token == DEC))
   {
     op = *token;
     get_token();
     if((op == INC) || (op == DEC))
     {
-      data_type val = {0};
-      result = find_var(token, val);
-      if(result)
+      int var_index = get_var_index(token);
+      // Array element have to be processed here: evaluation of the index
+      // second time in the atom() can cause side effects
+      if((var_index != -1) && (var_stack[var_index].size != 0))
+      {
+        int elem = 0;
+        result = get_array_elem(var_index, elem);
+        if(result)
+        {
+          data.type = var_stack[var_index].data.type;
+          data.value = p_arena[elem] + ((op == INC) ? 1 : -1);
+          assign_elem(var_index, elem, data);
+          data.value = p_arena[elem];
+          result = get_token();
+        }
+        processed = true;
+      }
+      else
       {
-        if(op == INC) val.value++;
-        else          val.value--;
-        result = assign_var(token, val);
+        data_type val = {0};
+        result = find_var(token, val);
+        if(result)
+        {
+          if(op == INC) val.value++;
+          else          val.value--;
+          result = assign_var(token, val);
+        }
       }
     }
   }
 
-  if(result) result = eval_exp5(data);
+  if(result && !processed) result = eval_exp5(data);
 
   if(op == '-') data.value = -(data.value);
   if(op == '!') data.value = !(data.value);
@@ -1724,6 +2490,26 @@ bool LittleC::atom(data_type& data)
       {
         result = call(data);
       }
+      else if(is_array(token)) // array element
+      {
+        int var_index = get_var_index(token);
+        int elem = 0;
+        result = get_array_elem(var_index, elem);
+        if(result)
+        {
+          data.type = var_stack[var_index].data.type;
+          data.value = p_arena[elem];
+          result = get_token();
+        }
+        if(result && ((*token == INC) || (*token == DEC)))
+        {
+          data_type val = data;
+          if(*token == INC) val.value++;
+          else              val.value--;
+          assign_elem(var_index, elem, val);
+        }
+        else putback();
+      }
       else
       {
         result = find_var(token, data); // get var's value
@@ -1786,6 +2572,9 @@ bool LittleC::atom(data_type& data)
 // *****************************************************************************
 bool LittleC::sntx_err(int error)
 {
+  // Error stops the program, so message can take space of the arrays too
+  if(p_arena != nullptr) output_size = output_buf_size;
+
   if((p_output != nullptr) && (output_size != 0))
   {
     int linecount = 0;
@@ -2002,7 +2791,7 @@ bool LittleC::get_token(void)
     if(token_type == UNDEFTT)
     {
       // Check for other delimiters
-      if(strchr("!+-*^/%=;:(),'?", *prog))
+      if(strchr("!+-*^/%=;:(),'?[]", *prog))
       {
         *temp = *prog;
         prog++; // advance to next position
@@ -2167,7 +2956,7 @@ int LittleC::internal_func(char *s)
 // *****************************************************************************
 int LittleC::isdelim(char c)
 {
-  if(strchr(" !:;,+-<>'/*%^=()?", c) || (c == 9) || (c == '\r') || (c == '\n') || (c == 0)) return 1;
+  if(strchr(" !:;,+-<>'/*%^=()?[]{}", c) || (c == 9) || (c == '\r') || (c == '\n') || (c == 0)) return 1;
   return 0;
 }
 
@@ -2,8 +2,21 @@
 // ***   A Little C interpreter   **********************************************
 // *****************************************************************************
 
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   Debug defines   *******************************************************
+// *****************************************************************************
+// Profiler: count executed statements and time per source line and function.
+// Report added to the end of the program output as G-code comments.
+//#define LITTLEC_PROFILER
+
 #define NUM_FUNC    100
 #define NUM_VARS    200
+#define MAX_ARRAY   4096 // Maximum number of elements in one array
+#define NUM_FOLDS   32   // Maximum number of folded conditions
+#define NUM_PROF    64   // Maximum number of profiled statements, should be power of 2
+#define NUM_PROF_REPORT 10 // Number of lines in profiler report
 
 class LittleC
 {
@@ -29,6 +42,18 @@ class LittleC
     // *************************************************************************
     bool Execute();
 
+    // *************************************************************************
+    // ***   Public: GetFoldedConditionsCnt   **********************************
+    // *************************************************************************
+    // Number of if conditions found by Prescan() that can't change during execution
+    int GetFoldedConditionsCnt() {return folded_cnt;}
+
+    // *************************************************************************
+    // ***   Public: GetEliminatedBranchesCnt   ********************************
+    // *************************************************************************
+    // Number of branches that never execute with current parameters, valid after Execute()
+    int GetEliminatedBranchesCnt() {return eliminated_cnt;}
+
     // *************************************************************************
     // ***   Public: GetGlobalVariablesCnt   ***********************************
     // *************************************************************************
@@ -77,7 +102,8 @@ class LittleC
       SYNTAX, UNBAL_PARENS, NO_EXP, NOT_VAR, NOT_STRING, PARAM_ERR, SEMI_EXPECTED, UNBAL_BRACES, FUNC_UNDEF, TYPE_EXPECTED,
       NEST_FUNC, RET_NOCALL, PAREN_EXPECTED, WHILE_EXPECTED, QUOTE_EXPECTED, TOO_MANY_LVARS, DIV_BY_ZERO,
       DUP_VAR, DUP_FUNC, TOO_LONG_TOKEN, BRACE_EXPECTED, COLON_EXPECTED, UNDEFINED_TOKEN,
-      TOO_MANY_FUNCS, TOO_MANY_GVARS, END_ERR
+      TOO_MANY_FUNCS, TOO_MANY_GVARS, BRACKET_EXPECTED, ARRAY_SIZE, ARRAY_INDEX, ARRAY_GLOBAL, NO_ARRAY_MEM,
+      END_ERR
     };
 
     const char* prog;  // current location in source code
@@ -99,6 +125,14 @@ class LittleC
     int gvar_index = 0; // index into global variable table
     int lvartos = 0;    // index into local variable stack
 
+    // Arena for local arrays. It grows from the tail of the output buffer
+    // toward the program result while Execute() runs, so every call frame gets
+    // its own arrays and recursion is limited by free space only. Arrays are
+    // addressed by negative index from the arena end.
+    int* p_arena = nullptr;
+    int arena_top = 0;       // Number of elements used in the arena
+    int output_buf_size = 0; // Whole output buffer size, output_size excludes the arena
+
     // Data type structure
     struct data_type
     {
@@ -114,7 +148,8 @@ class LittleC
     struct var_type
     {
       const char* name; // pointer to variable name in the program, should point to the first character
-      data_type data;   // variable type and data
+      data_type data;   // variable type and data. For arrays value is index of first element in the arena.
+      int size;         // number of elements for arrays, 0 for regular variables
     };
     // Variables stack
     var_type var_stack[NUM_VARS];
@@ -132,6 +167,50 @@ class LittleC
     // This is the value used to to find start of all local variables pushed in the function
     int call_stack[NUM_FUNC];
 
+    // Folded condition structure. Conditions of if statements which use only
+    // constants and global variables never assigned by the program are found
+    // once by Prescan() and evaluated only when parameters change.
+    struct fold_type
+    {
+      const char* loc; // location after if or else keyword
+      const char* end; // location after condition, nullptr for else
+      const char* eob; // location after if or else block
+      bool has_else;   // if block is followed by else
+      bool known;      // condition evaluated successfully
+      int value;       // value of the condition
+    };
+    // Folded conditions table sorted by location
+    fold_type fold_table[NUM_FOLDS];
+    int fold_index = 0;      // index into folded conditions table
+    int folded_cnt = 0;      // number of folded conditions
+    int eliminated_cnt = 0;  // number of eliminated branches
+    bool fold_dirty = false; // parameters changed, conditions have to be evaluated again
+
+#if defined(LITTLEC_PROFILER)
+    // Profiler statement structure
+    struct prof_type
+    {
+      const char* loc; // location of the statement, nullptr for unused entry
+      int line;        // line of the statement, found by prof_report()
+      uint32_t count;  // number of statement executions
+      uint64_t ticks;  // time spent in the statement excluding nested statements
+    };
+    // Profiler statements hash table
+    prof_type prof_table[NUM_PROF];
+    // Profiler functions counters, time includes called functions
+    uint32_t prof_func_count[NUM_FUNC];
+    uint64_t prof_func_ticks[NUM_FUNC];
+    // Statement that executes now
+    prof_type* prof_cur = nullptr;
+    // Timestamp of the current statement start
+    uint32_t prof_ts = 0u;
+    // Total number of executed statements and number of statements didn't fit into the table
+    uint32_t prof_count = 0u;
+    uint32_t prof_lost = 0u;
+    // Execution start timestamp
+    uint32_t prof_start_ts = 0u;
+#endif
+
     // Keyword lookup table structure
     struct commands
     {
@@ -168,7 +247,7 @@ class LittleC
     };
 
     // Error messages
-    const err_msg errors[26] =
+    const err_msg errors[31] =
     {
       {SYNTAX,          "Syntax error"},
       {NO_EXP,          "No expression present"},
@@ -195,6 +274,11 @@ class LittleC
       {UNDEFINED_TOKEN, "Undefined token"},
       {TOO_MANY_FUNCS,  "Too many functions"},
       {TOO_MANY_GVARS,  "Too many global variables"},
+      {BRACKET_EXPECTED,"Brackets expected"},
+      {ARRAY_SIZE,      "Array size must be a positive constant"},
+      {ARRAY_INDEX,     "Array index out of range"},
+      {ARRAY_GLOBAL,    "Arrays must be declared inside function"},
+      {NO_ARRAY_MEM,    "Not enough memory for arrays"},
       {END_ERR,         "Error Not Found"}
     };
 
@@ -213,6 +297,18 @@ class LittleC
     bool assign_var(char* var_name, data_type data);
     bool find_var(char* s, data_type& data);
     bool is_var(char* s);
+    bool is_array(char* s);
+    void arena_set_top(int top);
+    bool decl_array(var_type& var);
+    bool get_array_elem(int var_index, int& elem);
+    void assign_elem(int var_index, int elem, const data_type& data);
+    bool is_array_assign(void);
+    bool fold_conditions(void);
+    void eval_folds(void);
+    bool is_foldable(const bool* is_const);
+    int  find_global(const char* name);
+    bool add_fold(const fold_type& fold);
+    const fold_type* find_fold(const char* loc);
     bool exec_if(void);
     bool exec_while(void);
     bool exec_do(void);
@@ -222,12 +318,22 @@ class LittleC
     bool eval_exp(data_type& data, bool evaluate_comma = false);
     bool eval_exp00(data_type& data, bool evaluate_comma = true);
     bool eval_exp0(data_type& data);
+    bool is_assign_op(char op);
+    bool assign_op(char op, data_type& data, const data_type& val);
     bool eval_exp1(data_type& data);
     bool eval_exp2(data_type& data);
     bool eval_exp3(data_type& data);
     bool eval_exp4(data_type& data);
     bool eval_exp5(data_type& data);
     bool atom(data_type& data);
+#if defined(LITTLEC_PROFILER)
+    static uint32_t prof_ticks(void);
+    static uint32_t prof_ticks_per_us(void);
+    void prof_start(void);
+    void prof_statement(const char* loc);
+    void prof_report(void);
+    void prof_print(const char* str);
+#endif
     bool sntx_err(int error);
     bool get_token(void);
     bool get_string_token(int idx);
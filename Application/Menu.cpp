@@ -44,6 +44,9 @@ Result Menu::Setup(int32_t x, int32_t y, int32_t w, int32_t h)
 
   // Set list params
   list.SetParams(x, y, w, h);
+  // Receive touches to select items
+  list.menu = this;
+  list.SetActive(true);
 
   // Check pointer
   if(ptr != nullptr)
@@ -198,12 +201,9 @@ Result Menu::Show(uint32_t z)
     right_btn.Show(z);
 
     // Set encoder callback handler
-    InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+    result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
     // Set callback handler for left and right buttons
-    InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT | InputDrv::BTNM_RIGHT, btn_cble);
-
-    // All good
-    result = Result::RESULT_OK;
+    result |= InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT | InputDrv::BTNM_RIGHT, btn_cble, InputDrv::PRIORITY_SCREEN);
   }
 
   // Return result
@@ -248,6 +248,103 @@ Result Menu::Hide()
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: ProcessGestures   *********************************************
+// *****************************************************************************
+void Menu::ProcessGestures()
+{
+  GestureEngine::Sample sample;
+  // Samples received since previous call
+  while(touch_samples.Pop(sample))
+  {
+    gesture.Process(sample);
+  }
+  // Move selection by inertia
+  gesture.Update(RtosTick::GetTimeMs());
+
+  // Item height
+  int32_t item_h = Font_10x18::GetInstance().GetCharH();
+
+  // Tap selects item under the finger
+  int32_t tx = 0;
+  int32_t ty = 0;
+  if(gesture.TakeTap(tx, ty))
+  {
+    int32_t item = (ty - list.GetStartY()) / item_h;
+    if((item >= 0) && (item < cnt)) SetPosition(item);
+  }
+
+  int32_t dx = 0;
+  int32_t dy = 0;
+  gesture.TakeDelta(dx, dy);
+  // Selection follows the finger by whole items
+  move_px += dy;
+  int32_t items = move_px / item_h;
+  if(items != 0)
+  {
+    move_px -= items * item_h;
+    int32_t prev_pos = cur_pos;
+    SetPosition(cur_pos + items);
+    // Can't move more - stop fling
+    if(cur_pos == prev_pos)
+    {
+      gesture.Stop();
+      move_px = 0;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: SetPosition function   ***************************************
+// *****************************************************************************
+void Menu::SetPosition(int32_t pos)
+{
+  // Change position
+  cur_pos = pos;
+  // Check new value
+  if(cur_pos < 0) cur_pos = 0;
+  if(cur_pos >= cnt) cur_pos = cnt - 1;
+  // Set selection box parameters
+  if(cur_pos >= 0) box.SetParams(ptr[cur_pos].str.GetStartX(), ptr[cur_pos].str.GetStartY(), list.GetWidth(), ptr[cur_pos].str.GetHeight(), COLOR_BLUE, true);
+}
+
+// *****************************************************************************
+// ***   Private: Action function   ********************************************
+// *****************************************************************************
+void Menu::Action(VisObject::ActionType action, int32_t tx, int32_t ty)
+{
+  // Called from touch handler: sample is only queued and processed by task
+  // that owns Menu
+  GestureEngine::Sample sample = {RtosTick::GetTimeMs(), GestureEngine::MOVE, tx, ty};
+
+  // Switch for process action
+  switch(action)
+  {
+    // Touch action
+    case VisObject::ACT_TOUCH:
+      sample.event = GestureEngine::TOUCH;
+      (void)touch_samples.Push(sample);
+      break;
+
+    // Finger moves
+    case VisObject::ACT_MOVEIN: // Intentional fall-trough
+    case VisObject::ACT_HOLD:
+      (void)touch_samples.Push(sample);
+      break;
+
+    // Untouch action or finger out of the list
+    case VisObject::ACT_UNTOUCH: // Intentional fall-trough
+    case VisObject::ACT_MOVEOUT:
+      sample.event = GestureEngine::RELEASE;
+      (void)touch_samples.Push(sample);
+      break;
+
+    case VisObject::ACT_MAX:
+    default:
+      break;
+  }
+}
+
 // *****************************************************************************
 // ***   Private: ProcessEncoderCallback function   ****************************
 // *****************************************************************************
@@ -265,12 +362,7 @@ Result Menu::ProcessEncoderCallback(Menu* obj_ptr, void* ptr)
     int32_t enc_val = (int32_t)ptr;
 
     // Change position
-    ths.cur_pos += enc_val;
-    // Check new value
-    if(ths.cur_pos < 0) ths.cur_pos = 0;
-    if(ths.cur_pos >= ths.cnt) ths.cur_pos = ths.cnt - 1;
-    // Set selection box parameters
-    if(ths.cur_pos >= 0) ths.box.SetParams(ths.ptr[ths.cur_pos].str.GetStartX(), ths.ptr[ths.cur_pos].str.GetStartY(), ths.list.GetWidth(), ths.ptr[ths.cur_pos].str.GetHeight(), COLOR_BLUE, true);
+    ths.SetPosition(ths.cur_pos + enc_val);
 
     // Set ok result
     result = Result::RESULT_OK;
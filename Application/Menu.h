@@ -22,8 +22,11 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "DirtyRegions.h"
 
 #include "InputDrv.h"
+#include "GestureEngine.h"
+#include "SpscQueue.h"
 
 // *****************************************************************************
 // ***   Menu Class   **********************************************************
@@ -38,7 +41,7 @@ class Menu //: public VisObject
     {
         char* text = nullptr;       // Pointer to string itself
         uint32_t n = 0u;            // Size of string
-        String str;                 // String visual object
+        Dirty<String> str;          // String visual object
     } MenuItem;
 
     // *************************************************************************
@@ -96,9 +99,28 @@ class Menu //: public VisObject
     // *************************************************************************
     Result Hide();
 
+    // *************************************************************************
+    // ***   Public: ProcessGestures   *****************************************
+    // *************************************************************************
+    // Tap selects item, drag and fling move selection. Should be called
+    // periodically from task that owns Menu.
+    void ProcessGestures();
+
   private:
     static const uint8_t BORDER_W = 4u;
 
+    // *************************************************************************
+    // ***   List that passes touches to the menu   ****************************
+    // *************************************************************************
+    class MenuList : public Dirty<VisList>
+    {
+      public:
+        // Menu that owns the list
+        Menu* menu = nullptr;
+        // Action
+        virtual void Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy) {if(menu != nullptr) menu->Action(action, tx, ty);}
+    };
+
     // Callback data
     AppTask* task = nullptr; // Pointer to AppTask for all callbacks
     void* param = nullptr;   // Callback parameter
@@ -106,20 +128,27 @@ class Menu //: public VisObject
     CallbackPtr func_esc = nullptr; // Pointer callback function after press back
 
     // List that contains all menu elements
-    VisList list;
+    MenuList list;
 
     MenuItem* ptr = nullptr;
     // Count of menu items
     int32_t cnt = 0;
 
     // Selection box
-    Box box;
+    Dirty<Box> box;
     // Current menu position
     int32_t cur_pos = 0;
 
+    // Touch samples: written by touch handler, read by task that owns Menu
+    SpscQueue<GestureEngine::Sample, 16u> touch_samples;
+    // Gesture recognizer
+    GestureEngine gesture;
+    // Selection movement in pixels not applied yet, less than one item
+    int32_t move_px = 0;
+
     // Soft Buttons
-    UiButton left_btn;
-    UiButton right_btn;
+    Dirty<UiButton> left_btn;
+    Dirty<UiButton> right_btn;
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
@@ -129,6 +158,16 @@ class Menu //: public VisObject
     // Button callback entry
     InputDrv::CallbackListEntry btn_cble;
 
+    // *************************************************************************
+    // ***   Private: SetPosition function   ***********************************
+    // *************************************************************************
+    void SetPosition(int32_t pos);
+
+    // *************************************************************************
+    // ***   Private: Action function   ****************************************
+    // *************************************************************************
+    void Action(VisObject::ActionType action, int32_t tx, int32_t ty);
+
     // *************************************************************************
     // ***   Private: ProcessEncoderCallback function   ************************
     // *************************************************************************
@@ -22,6 +22,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "DirtyRegions.h"
 
 #include "InputDrv.h"
 
@@ -83,20 +84,20 @@ class MsgBox
     Result selection = Result::ERR_CANCEL;
 
     // List that contains all menu elements
-    VisList list;
+    Dirty<VisList> list;
 
     // Box around
-    Box box;
+    Dirty<Box> box;
     // Box around
-    ShadowBox shadowbox;
+    Dirty<ShadowBox> shadowbox;
 
     // Strings for caption and text
-    String msg_box_caption;
-    MultiLineString msg_box_text;
+    Dirty<String> msg_box_caption;
+    Dirty<MultiLineString> msg_box_text;
 
     // Soft Buttons
-    UiButton left_btn;
-    UiButton right_btn;
+    Dirty<UiButton> left_btn;
+    Dirty<UiButton> right_btn;
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
@@ -48,6 +48,13 @@ class NVM
       SCREEN_INVERT,
       AUTO_MPG_ON_START,
       SAVE_SCRIPT_RESULT,
+      MPG_VELOCITY_JOG,
+      MPG_ACCEL_CURVE,
+      MPG_VECTOR_PLANE,
+      MPG_VECTOR_ANGLE,
+      DRO_PREDICTION,
+      ROTARY_WRAP,
+      ROTARY_DIVISIONS,
       // MPG
       MPG_METRIC_FEED_1,
       MPG_METRIC_FEED_2,
@@ -127,6 +134,13 @@ class NVM
         0,    // SCREEN_INVERT
         0,    // AUTO_MPG_ON_START
         0,    // SAVE_SCRIPT_RESULT
+        0,    // MPG_VELOCITY_JOG
+        0,    // MPG_ACCEL_CURVE: EncoderSpeed::CURVE_LINEAR
+        0,    // MPG_VECTOR_PLANE: DirectControlScr::VECTOR_OFF
+        45,   // MPG_VECTOR_ANGLE: 45 deg from first axis of the plane
+        0,    // DRO_PREDICTION
+        1,    // ROTARY_WRAP: rotary axes shown in 0-360 deg range
+        0,    // ROTARY_DIVISIONS: 0 - indexing is off
         // MPG
         1,    // MPG_METRIC_FEED_1: 0.001 mm
         5,    // MPG_METRIC_FEED_2: 0.005 mm
@@ -130,11 +130,14 @@ Result OverrideCtrlScr::Show()
   // Stop button
   right_btn.Show(102);
 
+  // Update everything on first tick
+  grbl_comm.ForceChanges(grbl_changes);
+
   // Set encoder callback handler
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -186,13 +189,22 @@ Result OverrideCtrlScr::TimerExpired(uint32_t interval)
   Application::GetInstance().UpdateLeftButtonText();
   Application::GetInstance().UpdateRightButtonText();
 
+  // Data changed since previous tick
+  uint32_t changes = grbl_comm.GetChanges(grbl_changes);
+
   // Update numbers with current overrides
-  feed_dw.SetNumber(grbl_comm.GetFeedOverride());
-  speed_dw.SetNumber(grbl_comm.GetSpeedOverride());
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_OVERRIDES))
+  {
+    feed_dw.SetNumber(grbl_comm.GetFeedOverride());
+    speed_dw.SetNumber(grbl_comm.GetSpeedOverride());
+  }
 
   // Set coolant state
-  flood_btn.SetColor(grbl_comm.GetCoolantFlood() ? COLOR_GREEN : COLOR_WHITE);
-  mist_btn.SetColor(grbl_comm.GetCoolantMist() ? COLOR_GREEN : COLOR_WHITE);
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_ACCESSORIES))
+  {
+    flood_btn.SetColor(grbl_comm.GetCoolantFlood() ? COLOR_GREEN : COLOR_WHITE);
+    mist_btn.SetColor(grbl_comm.GetCoolantMist() ? COLOR_GREEN : COLOR_WHITE);
+  }
 
   // Update feed if necessary. One step at a timer tick.
   if(feed_val > 0)
@@ -0,0 +1,245 @@
+//******************************************************************************
+//  @file PerfHud.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details PerfHud: User PerfHud Class, implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "PerfHud.h"
+#include "DirtyRegions.h"
+#include "InputDrv.h"
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+PerfHud& PerfHud::GetInstance()
+{
+  static PerfHud perf_hud;
+  return perf_hud;
+}
+
+// *****************************************************************************
+// ***   Public: Setup   *******************************************************
+// *****************************************************************************
+Result PerfHud::Setup(int32_t x, int32_t y)
+{
+#if defined(PERF_HUD_ENABLED)
+  // Background
+  box.SetParams(x, y, Font_6x8::GetInstance().GetCharW() * (NumberOf(str_buf[0u]) - 1u) + 4, Font_6x8::GetInstance().GetCharH() * NumberOf(str) + 4, COLOR_BLACK, true);
+  // Strings
+  for(uint32_t i = 0u; i < NumberOf(str); i++)
+  {
+    str[i].SetParams(str_buf[i], x + 2, y + 2 + Font_6x8::GetInstance().GetCharH() * i, (i < 2u) ? COLOR_WHITE : COLOR_YELLOW, Font_6x8::GetInstance());
+  }
+#endif
+
+  // All good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Show   ********************************************************
+// *****************************************************************************
+void PerfHud::Show()
+{
+#if defined(PERF_HUD_ENABLED)
+  // Start new period
+  for(uint32_t i = 0u; i < NumberOf(entries); i++)
+  {
+    entries[i].prev_cycles = entries[i].cycles;
+    entries[i].prev_calls = entries[i].calls;
+  }
+  period_ms = 0u;
+  period_frames = 0u;
+  period_pixels = 0u;
+  period_time_us = 0u;
+  period_max_time_us = 0u;
+
+  // Show objects on top of everything
+  box.Show(31000u);
+  for(uint32_t i = 0u; i < NumberOf(str); i++)
+  {
+    str[i].Show(31001u);
+  }
+  is_show = true;
+#endif
+}
+
+// *****************************************************************************
+// ***   Public: Hide   ********************************************************
+// *****************************************************************************
+void PerfHud::Hide()
+{
+#if defined(PERF_HUD_ENABLED)
+  is_show = false;
+  box.Hide();
+  for(uint32_t i = 0u; i < NumberOf(str); i++)
+  {
+    str[i].Hide();
+  }
+#endif
+}
+
+// *****************************************************************************
+// ***   Public: Process   *****************************************************
+// *****************************************************************************
+void PerfHud::Process(uint32_t interval_ms)
+{
+#if defined(PERF_HUD_ENABLED)
+  InputDrv& input_drv = InputDrv::GetInstance();
+  DirtyRegions& dirty_regions = DirtyRegions::GetInstance();
+
+  // Both side down buttons pressed together toggle overlay
+  bool chord = input_drv.GetButtonCurrentState(InputDrv::BTN_LEFT_DOWN) && input_drv.GetButtonCurrentState(InputDrv::BTN_RIGHT_DOWN);
+  if(chord && !chord_state)
+  {
+    if(is_show) Hide();
+    else        Show();
+  }
+  chord_state = chord;
+
+  // Collect frame statistic
+  period_ms += interval_ms;
+  period_frames++;
+  period_pixels += dirty_regions.GetFramePixels();
+  period_time_us += dirty_regions.GetAppTimeUs();
+  if(dirty_regions.GetAppTimeUs() > period_max_time_us) period_max_time_us = dirty_regions.GetAppTimeUs();
+
+  // Update overlay once per period
+  if(period_ms >= PERF_HUD_PERIOD_MS)
+  {
+    if(is_show) UpdateStrings();
+    // Start new period
+    for(uint32_t i = 0u; i < NumberOf(entries); i++)
+    {
+      entries[i].prev_cycles = entries[i].cycles;
+      entries[i].prev_calls = entries[i].calls;
+    }
+    period_ms = 0u;
+    period_frames = 0u;
+    period_pixels = 0u;
+    period_time_us = 0u;
+    period_max_time_us = 0u;
+  }
+#endif
+}
+
+// *****************************************************************************
+// ***   Public: AddDrawTime   *************************************************
+// *****************************************************************************
+void PerfHud::AddDrawTime(VisObject* obj, const char* name, uint32_t cycles)
+{
+  // Collect statistic only when overlay is shown
+  if(is_show)
+  {
+    ObjEntry* entry = Find(obj);
+    // If table is full - object isn't profiled
+    if(entry != nullptr)
+    {
+      // New entry: name have to be set before object pointer, since non-null
+      // object pointer marks entry as valid for the application task
+      if(entry->obj == nullptr)
+      {
+        entry->name = name;
+        entry->obj = obj;
+      }
+      // Counters written by display task only, application task only reads
+      // them, so no lock needed
+      entry->cycles += cycles;
+      entry->calls++;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Find   *******************************************************
+// *****************************************************************************
+PerfHud::ObjEntry* PerfHud::Find(VisObject* obj)
+{
+  ObjEntry* result = nullptr;
+
+  // Objects are at least 4 bytes aligned - don't use lower bits
+  uint32_t idx = (uint32_t)((uintptr_t)obj >> 2u);
+  // Look for the object or empty entry starting from hash position
+  for(uint32_t i = 0u; i < NumberOf(entries); i++)
+  {
+    ObjEntry& entry = entries[(idx + i) & (NumberOf(entries) - 1u)];
+    if((entry.obj == obj) || (entry.obj == nullptr))
+    {
+      result = &entry;
+      break;
+    }
+  }
+
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: UpdateStrings   **********************************************
+// *****************************************************************************
+void PerfHud::UpdateStrings()
+{
+#if defined(PERF_HUD_ENABLED)
+  // Pixels per second & SPI utilization
+  uint32_t px_per_sec = (uint32_t)((uint64_t)period_pixels * 1000u / period_ms);
+  uint32_t spi_load = (uint32_t)((uint64_t)px_per_sec * PERF_HUD_BYTES_PER_PIXEL * 8u * 100u / PERF_HUD_SPI_BITRATE);
+
+  snprintf(str_buf[0u], NumberOf(str_buf[0u]), "App: %5luus max: %5luus", period_time_us / period_frames, period_max_time_us);
+  snprintf(str_buf[1u], NumberOf(str_buf[1u]), "Fill: %8lu px/s SPI: %3lu%%", px_per_sec, spi_load);
+
+  // Find objects with the biggest draw time in this period
+  ObjEntry* top[PERF_HUD_TOP_CNT] = {nullptr};
+  uint32_t top_cycles[PERF_HUD_TOP_CNT] = {0u};
+  for(uint32_t i = 0u; i < NumberOf(entries); i++)
+  {
+    uint32_t cycles = entries[i].cycles - entries[i].prev_cycles;
+    if((entries[i].obj != nullptr) && (cycles > top_cycles[PERF_HUD_TOP_CNT - 1u]))
+    {
+      // Insert entry into sorted list
+      uint32_t pos = PERF_HUD_TOP_CNT - 1u;
+      while((pos > 0u) && (cycles > top_cycles[pos - 1u]))
+      {
+        top[pos] = top[pos - 1u];
+        top_cycles[pos] = top_cycles[pos - 1u];
+        pos--;
+      }
+      top[pos] = &entries[i];
+      top_cycles[pos] = cycles;
+    }
+  }
+
+  // Draw time in microseconds per second for each object
+  for(uint32_t i = 0u; i < PERF_HUD_TOP_CNT; i++)
+  {
+    if(top[i] != nullptr)
+    {
+      uint32_t us_per_sec = (uint32_t)((uint64_t)top_cycles[i] * 1000u / (SystemCoreClock / 1000000u) / period_ms);
+      snprintf(str_buf[2u + i], NumberOf(str_buf[2u + i]), "%-10.10s %3ld,%3ld %6luus/s %5lu", top[i]->name, top[i]->obj->GetStartX(), top[i]->obj->GetStartY(), us_per_sec, top[i]->calls - top[i]->prev_calls);
+    }
+    else
+    {
+      str_buf[2u + i][0u] = '\0';
+    }
+  }
+
+  // Update strings
+  for(uint32_t i = 0u; i < NumberOf(str); i++)
+  {
+    str[i].SetString(str_buf[i], true);
+  }
+#endif
+}
@@ -0,0 +1,160 @@
+//******************************************************************************
+//  @file PerfHud.h
+//  @author Nicolai Shlapunov
+//
+//  @details PerfHud: User PerfHud Class, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef PerfHud_h
+#define PerfHud_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+#include "DirtyRegions.h"
+
+// *****************************************************************************
+// ***   Debug defines   *******************************************************
+// *****************************************************************************
+
+// Rendering performance overlay: application time, pixels per second, SPI
+// utilization and top objects by draw time. When enabled, overlay toggled by
+// pressing both side down buttons at the same time.
+//#define PERF_HUD_ENABLED
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Statistic update period
+#define PERF_HUD_PERIOD_MS 1000u
+
+// Maximum number of profiled objects, must be power of two
+#define PERF_HUD_OBJ_MAX 64u
+
+// Number of objects with the biggest draw time to show
+#define PERF_HUD_TOP_CNT 5u
+
+// SPI bitrate used by display: APB2 100 MHz with prescaler 2
+#define PERF_HUD_SPI_BITRATE 50000000u
+
+// Bytes per pixel sent to display: ILI9488 in 18 bit mode
+#define PERF_HUD_BYTES_PER_PIXEL 3u
+
+// Draw time measurement. PERF_HUD_DRAW_START() have to be placed at the start
+// of DrawInBufW() function and PERF_HUD_DRAW_END() at the end of it.
+#if defined(PERF_HUD_ENABLED)
+  #define PERF_HUD_DRAW_START() uint32_t perf_hud_start = DWT->CYCCNT
+  #define PERF_HUD_DRAW_END(name) PerfHud::GetInstance().AddDrawTime(this, name, DWT->CYCCNT - perf_hud_start)
+#else
+  #define PERF_HUD_DRAW_START()
+  #define PERF_HUD_DRAW_END(name)
+#endif
+
+// *****************************************************************************
+// ***   PerfHud Class   *******************************************************
+// *****************************************************************************
+class PerfHud
+{
+  public:
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static PerfHud& GetInstance();
+
+    // *************************************************************************
+    // ***   Public: Setup   ***************************************************
+    // *************************************************************************
+    Result Setup(int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Public: Show   ****************************************************
+    // *************************************************************************
+    void Show();
+
+    // *************************************************************************
+    // ***   Public: Hide   ****************************************************
+    // *************************************************************************
+    void Hide();
+
+    // *************************************************************************
+    // ***   Public: IsShow   **************************************************
+    // *************************************************************************
+    bool IsShow() {return is_show;}
+
+    // *************************************************************************
+    // ***   Public: Process   *************************************************
+    // *************************************************************************
+    // Should be called every frame before DirtyRegions::EndFrame(), it uses
+    // statistic of the previous frame
+    void Process(uint32_t interval_ms);
+
+    // *************************************************************************
+    // ***   Public: AddDrawTime   *********************************************
+    // *************************************************************************
+    // Called from the display task for every DrawInBufW() call
+    void AddDrawTime(VisObject* obj, const char* name, uint32_t cycles);
+
+  private:
+    // Draw cost of one object
+    typedef struct
+    {
+      VisObject* obj;       // Object, nullptr if entry is empty
+      const char* name;     // Object type name
+      uint32_t cycles;      // Cycles spent in DrawInBufW(), written by display task only
+      uint32_t calls;       // Number of DrawInBufW() calls, written by display task only
+      uint32_t prev_cycles; // Cycles at the start of current period
+      uint32_t prev_calls;  // Calls at the start of current period
+    } ObjEntry;
+
+    // Objects draw cost, open addressing hash table by object pointer
+    ObjEntry entries[PERF_HUD_OBJ_MAX] = {0};
+
+    // Statistic for the current period
+    uint32_t period_ms = 0u;
+    uint32_t period_frames = 0u;
+    uint32_t period_pixels = 0u;
+    uint32_t period_time_us = 0u;
+    uint32_t period_max_time_us = 0u;
+
+    // Flag to show overlay
+    bool is_show = false;
+    // Buttons chord state to detect press
+    bool chord_state = false;
+
+#if defined(PERF_HUD_ENABLED)
+    // Background
+    Dirty<Box> box;
+    // Strings: application time, fill rate and top objects
+    Dirty<String> str[2u + PERF_HUD_TOP_CNT];
+    char str_buf[2u + PERF_HUD_TOP_CNT][40u] = {0};
+#endif
+
+    // *************************************************************************
+    // ***   Private: Find   ***************************************************
+    // *************************************************************************
+    ObjEntry* Find(VisObject* obj);
+
+    // *************************************************************************
+    // ***   Private: UpdateStrings   ******************************************
+    // *************************************************************************
+    void UpdateStrings();
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    PerfHud() {};
+};
+
+#endif
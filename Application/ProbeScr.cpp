@@ -78,13 +78,13 @@ Result ProbeScr::Show()
   right_btn.Show(102);
 
   // Set callback handler for left and right buttons
-  InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT_DOWN | InputDrv::BTNM_RIGHT_DOWN, btn_cble);
+  Result result = InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT_DOWN | InputDrv::BTNM_RIGHT_DOWN, btn_cble, InputDrv::PRIORITY_SCREEN);
 
   // Show screen
-  tab[tab_idx]->Show();
+  result |= tab[tab_idx]->Show();
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -359,8 +359,11 @@ Result CenterFinderTab::Show()
   // Request offsets to show it
   grbl_comm.RequestOffsets();
 
+  // Force update of all data windows
+  grbl_comm.ForceChanges(grbl_changes);
+
   // Set encoder callback handler
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
 
   // Enable or disable Find button
   if(dw_real[GrblComm::AXIS_X].IsSelected() || dw_real[GrblComm::AXIS_Y].IsSelected())
@@ -374,8 +377,8 @@ Result CenterFinderTab::Show()
     Application::GetInstance().GetLeftButton().Disable();
   }
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -426,10 +429,16 @@ Result CenterFinderTab::TimerExpired(uint32_t interval)
   // Not for the return, for check probing result
   Result result = Result::RESULT_OK;
 
+  // Data changed since previous tick
+  uint32_t changes = grbl_comm.GetChanges(grbl_changes);
+
   // Update numbers with current position and position difference
-  for(uint32_t i = 0u; i < grbl_comm.GetLimitedNumberOfAxis(NumberOf(dw_real)); i++)
+  if(changes & (GrblComm::ChangeMask(GrblComm::CHG_POS) | GrblComm::ChangeMask(GrblComm::CHG_XMODE)))
   {
-    dw_real[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    for(uint32_t i = 0u; i < grbl_comm.GetLimitedNumberOfAxis(NumberOf(dw_real)); i++)
+    {
+      dw_real[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    }
   }
 
   // Error check - if state isn't IDLE or RUN, we should abort probing sequence
@@ -1177,11 +1186,14 @@ Result EdgeFinderTab::Show()
   // Request offsets to show it
   grbl_comm.RequestOffsets();
 
+  // Force update of all data windows
+  grbl_comm.ForceChanges(grbl_changes);
+
   // Set encoder callback handler
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -1227,10 +1239,16 @@ Result EdgeFinderTab::TimerExpired(uint32_t interval)
   // Not for the return, for check probing result
   Result result = Result::RESULT_OK;
 
+  // Data changed since previous tick
+  uint32_t changes = grbl_comm.GetChanges(grbl_changes);
+
   // Update numbers with current position and position difference
-  for(uint32_t i = 0u; i < grbl_comm.GetLimitedNumberOfAxis(NumberOf(dw_real)); i++)
+  if(changes & (GrblComm::ChangeMask(GrblComm::CHG_POS) | GrblComm::ChangeMask(GrblComm::CHG_XMODE)))
   {
-    dw_real[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    for(uint32_t i = 0u; i < grbl_comm.GetLimitedNumberOfAxis(NumberOf(dw_real)); i++)
+    {
+      dw_real[i].SetNumber(grbl_comm.GetAxisPosition(i));
+    }
   }
 
   // Error check - if state isn't IDLE or RUN
@@ -1653,6 +1671,9 @@ Result ToolOffsetTab::Show()
   // Request offsets to show it
   grbl_comm.RequestOffsets();
 
+  // Force update of all data windows
+  grbl_comm.ForceChanges(grbl_changes);
+
   // Hide Left Soft button since it doesn't used on this screen
   Application::GetInstance().GetLeftButton().Hide();
 
@@ -1702,7 +1723,10 @@ Result ToolOffsetTab::TimerExpired(uint32_t interval)
   Result result = Result::RESULT_OK;
 
   // Set actual tool offset
-  dw_tool.SetNumber(grbl_comm.GetToolLengthOffset());
+  if(grbl_comm.GetChanges(grbl_changes) & GrblComm::ChangeMask(GrblComm::CHG_PROBE))
+  {
+    dw_tool.SetNumber(grbl_comm.GetToolLengthOffset());
+  }
 
   // If we in probing cycle
   if(state != PROBE_CNT)
@@ -230,6 +230,9 @@ class CenterFinderTab : public IScreen
     // Deferred error flag for outside line sequence
     bool line_error = false;
 
+    // GrblComm change counters to update only changed data
+    uint32_t grbl_changes[GrblComm::CHG_CNT] = {0u};
+
     // ID to track send message
     uint32_t cmd_id = 0u;
 
@@ -239,25 +242,25 @@ class CenterFinderTab : public IScreen
     // Data windows to show real position
     DataWindow dw_real[3u];
     // String for caption
-    String dw_real_name[NumberOf(dw_real)];
+    Dirty<String> dw_real_name[NumberOf(dw_real)];
 
     // Data windows for clearance
     DataWindow dw_clearance;
-    String dw_clearance_name;
+    Dirty<String> dw_clearance_name;
     // Data windows for distance
     DataWindow dw_distance;
-    String dw_distance_name;
+    Dirty<String> dw_distance_name;
 
     // String for data
-    String data_str[3u];
+    Dirty<String> data_str[3u];
     char data_str_buf[NumberOf(data_str)][64] = {0};
 
     // Buttons to select type of measurement
-    UiButton inside_btn;
-    UiButton outside_btn;
+    Dirty<UiButton> inside_btn;
+    Dirty<UiButton> outside_btn;
 
     // Button for precise measurement
-    UiButton precise_btn;
+    Dirty<UiButton> precise_btn;
 
     // Message box for pop up request to turn probe 180 degrees
     MsgBox& msg_box;
@@ -382,6 +385,9 @@ class EdgeFinderTab : public IScreen
     // Safe position(from which probing started)
     int32_t safe_pos = 0;
 
+    // GrblComm change counters to update only changed data
+    uint32_t grbl_changes[GrblComm::CHG_CNT] = {0u};
+
     // ID to track send message
     uint32_t cmd_id = 0u;
 
@@ -391,21 +397,21 @@ class EdgeFinderTab : public IScreen
     // Data windows to show real position
     DataWindow dw_real[3u];
     // String for caption
-    String dw_real_name[NumberOf(dw_real)];
+    Dirty<String> dw_real_name[NumberOf(dw_real)];
 
     // Data windows for clearance
     DataWindow dw_clearance;
-    String dw_clearance_name;
+    Dirty<String> dw_clearance_name;
     // Data windows for distance
     DataWindow dw_tip_diameter;
-    String dw_tip_diameter_name;
+    Dirty<String> dw_tip_diameter_name;
 
     // Buttons to select type of measurement
-    UiButton plus_btn;
-    UiButton minus_btn;
+    Dirty<UiButton> plus_btn;
+    Dirty<UiButton> minus_btn;
 
     // Button for precise measurement
-    UiButton precise_btn;
+    Dirty<UiButton> precise_btn;
 
     // Message box for pop up request to turn probe 180 degrees
     MsgBox& msg_box;
@@ -492,6 +498,9 @@ class ToolOffsetTab : public IScreen
     // Current selected axis
     // Scale to move axis
     GrblComm::Axis_t axis = GrblComm::AXIS_CNT;
+    // GrblComm change counters to update only changed data
+    uint32_t grbl_changes[GrblComm::CHG_CNT] = {0u};
+
     // ID to track send message
     uint32_t cmd_id = 0u;
 
@@ -499,21 +508,21 @@ class ToolOffsetTab : public IScreen
     GrblComm::state_t grbl_state = GrblComm::UNKNOWN;
 
     // String for caption
-    String name_tool;
+    Dirty<String> name_tool;
     // Data windows to show tool offset
     DataWindow dw_tool;
 
     // String for caption
-    String name_base;
+    Dirty<String> name_base;
     // Data windows to show tool offset
     DataWindow dw_base;
 
     // Buttons to measure offset
-    UiButton get_offset_btn;
+    Dirty<UiButton> get_offset_btn;
     // Buttons to clear offset
-    UiButton clear_offset_btn;
+    Dirty<UiButton> clear_offset_btn;
     // Buttons to measure base
-    UiButton get_base_btn;
+    Dirty<UiButton> get_base_btn;
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
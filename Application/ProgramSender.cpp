@@ -90,7 +90,7 @@ Result ProgramSender::Setup(int32_t y, int32_t height)
 Result ProgramSender::Show()
 {
   // Set encoder callback handler(before menu show since menu will handle it also)
-  InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble);
+  Result result = InputDrv::GetInstance().AddEncoderCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessEncoderCallback), this, enc_cble, InputDrv::PRIORITY_SCREEN);
 
   // Show free memory info
   Application::GetInstance().ShowMemoryInfo();
@@ -147,8 +147,11 @@ Result ProgramSender::Show()
   flood_btn.Show(100);
   mist_btn.Show(100);
 
-  // All good
-  return Result::RESULT_OK;
+  // Update everything on first tick
+  grbl_comm.ForceChanges(grbl_changes);
+
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -213,12 +216,25 @@ Result ProgramSender::TimerExpired(uint32_t interval)
   Application::GetInstance().UpdateLeftButtonText();
   Application::GetInstance().UpdateRightButtonText();
 
+  // Touch scrolling of file list and program text
+  menu.ProcessGestures();
+  text_box.ProcessGestures();
+
+  // Data changed since previous tick
+  uint32_t changes = grbl_comm.GetChanges(grbl_changes);
+
   // Update numbers with current overrides
-  feed_dw.SetNumber(grbl_comm.GetFeedOverride());
-  speed_dw.SetNumber(grbl_comm.GetSpeedOverride());
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_OVERRIDES))
+  {
+    feed_dw.SetNumber(grbl_comm.GetFeedOverride());
+    speed_dw.SetNumber(grbl_comm.GetSpeedOverride());
+  }
   // Set coolant state
-  flood_btn.SetColor(grbl_comm.GetCoolantFlood() ? COLOR_GREEN : COLOR_WHITE);
-  mist_btn.SetColor(grbl_comm.GetCoolantMist() ? COLOR_GREEN : COLOR_WHITE);
+  if(changes & GrblComm::ChangeMask(GrblComm::CHG_ACCESSORIES))
+  {
+    flood_btn.SetColor(grbl_comm.GetCoolantFlood() ? COLOR_GREEN : COLOR_WHITE);
+    mist_btn.SetColor(grbl_comm.GetCoolantMist() ? COLOR_GREEN : COLOR_WHITE);
+  }
 
   if(run)
   {
@@ -98,6 +98,9 @@ class ProgramSender : public IScreen
   private:
     static const uint8_t BORDER_W = 4u;
 
+    // GrblComm change counters to update only changed data
+    uint32_t grbl_changes[GrblComm::CHG_CNT] = {0u};
+
     // Run flag
     bool run = false;
     bool finished = false;
@@ -129,23 +132,23 @@ class ProgramSender : public IScreen
     // *************************************************************************
 
     // String for caption
-    String feed_name;
+    Dirty<String> feed_name;
     // Data windows to show current value
     DataWindow feed_dw;
     // Feed value
     int32_t feed_val = 0;
 
     // String for caption
-    String speed_name;
+    Dirty<String> speed_name;
     // Data windows to show current value
     DataWindow speed_dw;
     // Feed value
     int32_t speed_val = 0;
 
     // Buttons for control flood coolant
-    UiButton flood_btn;
+    Dirty<UiButton> flood_btn;
     // Buttons for control mist coolant
-    UiButton mist_btn;
+    Dirty<UiButton> mist_btn;
 
     // *************************************************************************
     // *************************************************************************
@@ -0,0 +1,130 @@
+//******************************************************************************
+//  @file RleImage.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details RleImage: User RleImage Class, implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "RleImage.h"
+
+// *****************************************************************************
+// ***   Public: SetImage   ****************************************************
+// *****************************************************************************
+void RleImage::SetImage(const RleImageDesc& img_dsc)
+{
+  // Save image description
+  img_desc = &img_dsc;
+  // Width and Height of object
+  width = img_dsc.width;
+  height = img_dsc.height;
+  // X and Y end coordinates of object
+  x_end = x_start + width - 1;
+  y_end = y_start + height - 1;
+  // Invalidate area
+  InvalidateObjArea();
+}
+
+// *****************************************************************************
+// ***   Public: DrawLine   ****************************************************
+// *****************************************************************************
+void RleImage::DrawLine(const RleImageDesc& img_dsc, color_t* buf, int32_t n, int32_t line, int32_t x)
+{
+  // Draw only if line belongs to image
+  if((line >= 0) && (line < img_dsc.height))
+  {
+    const uint8_t* p = &img_dsc.data[img_dsc.lines[line]];
+    int32_t end = x + img_dsc.width;
+    // Decode runs until end of the line or end of the buffer
+    while((x < end) && (x < n))
+    {
+      int32_t cnt = (p[0u] & 0x7Fu) + 1;
+      // Part of run inside the buffer
+      int32_t i = (x < 0) ? 0 : x;
+      int32_t i_end = (x + cnt > n) ? n : x + cnt;
+      // Run of the same pixels
+      if(p[0u] & 0x80u)
+      {
+        // Skip transparent runs
+        if((int32_t)p[1u] != img_dsc.transparent)
+        {
+          color_t color = img_dsc.palette[p[1u]];
+          for(; i < i_end; i++) buf[i] = color;
+        }
+        p += 2u;
+      }
+      else // Literal pixels
+      {
+        for(; i < i_end; i++) buf[i] = img_dsc.palette[p[1 + i - x]];
+        p += 1 + cnt;
+      }
+      x += cnt;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RleImage::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  PERF_HUD_DRAW_START();
+  // Draw only if needed
+  if((img_desc != nullptr) && (line >= y_start) && (line <= y_end))
+  {
+    DrawLine(*img_desc, buf, n, line - y_start, x_start - start_x);
+  }
+  PERF_HUD_DRAW_END("RleImage");
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RleImage::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Draw only if needed
+  if((img_desc != nullptr) && (row >= x_start) && (row <= x_end))
+  {
+    // Column in the image
+    int32_t column = row - x_start;
+    // Find first and last image line in the buffer
+    int32_t line = (start_y > y_start) ? start_y - y_start : 0;
+    int32_t line_end = (y_end < start_y + n - 1) ? y_end - y_start : start_y + n - 1 - y_start;
+    // For every line find run with pixel of the column
+    for(; line <= line_end; line++)
+    {
+      const uint8_t* p = &img_desc->data[img_desc->lines[line]];
+      int32_t x = 0;
+      // Skip runs before the column
+      while(x + (p[0u] & 0x7Fu) + 1 <= column)
+      {
+        x += (p[0u] & 0x7Fu) + 1;
+        p += (p[0u] & 0x80u) ? 2 : (p[0u] + 2);
+      }
+      // Run of the same pixels
+      if(p[0u] & 0x80u)
+      {
+        if((int32_t)p[1u] != img_desc->transparent)
+        {
+          buf[line + y_start - start_y] = img_desc->palette[p[1u]];
+        }
+      }
+      else // Literal pixels
+      {
+        buf[line + y_start - start_y] = img_desc->palette[p[1 + column - x]];
+      }
+    }
+  }
+}
@@ -0,0 +1,92 @@
+//******************************************************************************
+//  @file RleImage.h
+//  @author Nicolai Shlapunov
+//
+//  @details RleImage: User RleImage Class, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef RleImage_h
+#define RleImage_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+#include "DirtyRegions.h"
+#include "PerfHud.h"
+
+// *****************************************************************************
+// ***   RLE image description   ***********************************************
+// *****************************************************************************
+// Image compressed by Tools/ImageRle. Every line encoded separately, so any
+// line can be decoded directly from flash without decompression into RAM.
+// Control byte with bit 7 set is followed by one palette index repeated
+// (bits 0..6 + 1) times. Otherwise it is followed by (control byte + 1)
+// literal palette indexes. Transparent pixels are always stored as runs.
+typedef struct
+{
+  int32_t width;           // Image width
+  int32_t height;          // Image height
+  const uint16_t* lines;   // Offset of every line in data
+  const uint8_t* data;     // Runs and literals of palette indexes
+  const color_t* palette;  // Palette
+  int32_t transparent;     // Transparent palette index, -1 if there is none
+} RleImageDesc;
+
+// *****************************************************************************
+// ***   RleImage Class   ******************************************************
+// *****************************************************************************
+class RleImage : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    RleImage() {};
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    RleImage(int32_t x, int32_t y, const RleImageDesc& img_dsc) {SetImage(img_dsc); Move(x, y);}
+
+    // *************************************************************************
+    // ***   Public: SetImage   ************************************************
+    // *************************************************************************
+    void SetImage(const RleImageDesc& img_dsc);
+
+    // *************************************************************************
+    // ***   Public: DrawLine   ************************************************
+    // *************************************************************************
+    static void DrawLine(const RleImageDesc& img_dsc, color_t* buf, int32_t n, int32_t line, int32_t x);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0);
+
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false) {DirtyRegions::GetInstance().Invalidate(*this, force);}
+
+  private:
+    // Image description
+    const RleImageDesc* img_desc = nullptr;
+};
+
+#endif
@@ -123,30 +123,30 @@ class RotaryTableScr : public IScreen
     GrblComm::state_t grbl_state = GrblComm::UNKNOWN;
 
     // String for caption (only X and Y for center)
-    String center;
+    Dirty<String> center;
 
     // String for caption (only X and Y for center)
-    String center_axis_name[2u];
+    Dirty<String> center_axis_name[2u];
     // Data windows to show DRO (only X and Y for center)
     DataWindow center_dw[2u];
 
     // String for caption
-    String radius_name;
+    Dirty<String> radius_name;
     // Data windows to show radius
     DataWindow radius_dw;
 
     // String for caption
-    String z_axis_name;
+    Dirty<String> z_axis_name;
     // Data windows to show Z position
     DataWindow z_axis_dw;
 
     // String for caption
-    String arc_name;
+    Dirty<String> arc_name;
     // Data windows to show arc length
     DataWindow arc_dw;
 
     // Buttons to choose scale
-    UiButton scale_btn[3u];
+    Dirty<UiButton> scale_btn[3u];
     // Scale options(string)
     const char scale_str_metric[NumberOf(scale_btn)][9u] = {"0.001\nmm", "0.01\nmm", "0.1\nmm"};
     const char scale_str_imperial[NumberOf(scale_btn)][12u] = {"0.0001\ninch", "0.0005\ninch", "0.005\ninch"};
@@ -83,10 +83,10 @@ Result SettingsScr::Show()
   UpdateStrings();
 
   // Set callback handler for left and right buttons
-  InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT_DOWN | InputDrv::BTNM_RIGHT_DOWN, btn_cble);
+  Result result = InputDrv::GetInstance().AddButtonsCallbackHandler(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(ProcessButtonCallback), this, InputDrv::BTNM_LEFT_DOWN | InputDrv::BTNM_RIGHT_DOWN, btn_cble, InputDrv::PRIORITY_SCREEN);
 
-  // All good
-  return Result::RESULT_OK;
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -114,6 +114,9 @@ Result SettingsScr::Hide()
 // *****************************************************************************
 Result SettingsScr::TimerExpired(uint32_t interval)
 {
+  // Touch selection of menu items
+  menu.ProcessGestures();
+
   // Return ok - we don't check semaphore give error, because we don't need to.
   return Result::RESULT_OK;
 }
@@ -136,8 +139,14 @@ Result SettingsScr::ProcessCallback(const void* ptr)
     // Update variable and strings only if user pressed "OK" button
     if(change_box.GetResult())
     {
+      // General tab
+      if(tabs.GetSelectedTab() == GENERAL_TAB)
+      {
+        // Vector angle and rotary divisions are changed by change box
+        nvm.SetValue((NVM::Parameters)(change_box.GetId() + NVM::TX_CONTROL), change_box.GetValue());
+      }
       // MPG tab
-      if(tabs.GetSelectedTab() == MPG_TAB)
+      else if(tabs.GetSelectedTab() == MPG_TAB)
       {
         // Save value as is since we have separate values for metric and imperial
         nvm.SetValue((NVM::Parameters)(change_box.GetId() + NVM::MPG_METRIC_FEED_1), change_box.GetValue());
@@ -212,6 +221,52 @@ Result SettingsScr::ProcessMenuCallback(SettingsScr* obj_ptr, void* ptr)
       {
         ths.nvm.SetValue(NVM::SAVE_SCRIPT_RESULT, !ths.nvm.GetValue(NVM::SAVE_SCRIPT_RESULT));
       }
+      else if(nvm_idx == NVM::MPG_VELOCITY_JOG)
+      {
+        ths.nvm.SetValue(NVM::MPG_VELOCITY_JOG, !ths.nvm.GetValue(NVM::MPG_VELOCITY_JOG));
+      }
+      else if(nvm_idx == NVM::MPG_ACCEL_CURVE)
+      {
+        int32_t val = ths.nvm.GetValue(NVM::MPG_ACCEL_CURVE) + 1;  // Get current value and increment it by 1
+        if(val >= EncoderSpeed::CURVE_CNT) val = 0;                // Check overflow
+        ths.nvm.SetValue(NVM::MPG_ACCEL_CURVE, val);               // Store new value
+      }
+      else if(nvm_idx == NVM::MPG_VECTOR_PLANE)
+      {
+        int32_t val = ths.nvm.GetValue(NVM::MPG_VECTOR_PLANE) + 1;  // Get current value and increment it by 1
+        if(val >= DirectControlScr::VECTOR_CNT) val = 0;            // Check overflow
+        ths.nvm.SetValue(NVM::MPG_VECTOR_PLANE, val);               // Store new value
+      }
+      else if(nvm_idx == NVM::MPG_VECTOR_ANGLE)
+      {
+        // Setup object to change numerical parameters, title scale set to 1
+        ths.change_box.Setup(ths.menu_strings[nvm_idx], "deg", ths.nvm.GetValue(NVM::MPG_VECTOR_ANGLE), -180, 180, 0u, 1u);
+        // Set AppTask
+        ths.change_box.SetCallback(AppTask::GetCurrent());
+        // Save menu index as ID
+        ths.change_box.SetId(idx);
+        // Show change box
+        ths.change_box.Show(10000u);
+      }
+      else if(nvm_idx == NVM::DRO_PREDICTION)
+      {
+        ths.nvm.SetValue(NVM::DRO_PREDICTION, !ths.nvm.GetValue(NVM::DRO_PREDICTION));
+      }
+      else if(nvm_idx == NVM::ROTARY_WRAP)
+      {
+        ths.nvm.SetValue(NVM::ROTARY_WRAP, !ths.nvm.GetValue(NVM::ROTARY_WRAP));
+      }
+      else if(nvm_idx == NVM::ROTARY_DIVISIONS)
+      {
+        // Setup object to change numerical parameters, title scale set to 1
+        ths.change_box.Setup(ths.menu_strings[nvm_idx], "div", ths.nvm.GetValue(NVM::ROTARY_DIVISIONS), 0, 3600, 0u, 1u);
+        // Set AppTask
+        ths.change_box.SetCallback(AppTask::GetCurrent());
+        // Save menu index as ID
+        ths.change_box.SetId(idx);
+        // Show change box
+        ths.change_box.Show(10000u);
+      }
       else
       {
         ; // Do nothing - MISRA rule
@@ -373,6 +428,15 @@ void SettingsScr::UpdateStrings(void)
     menu.CreateString(menu_items[cnt++], menu_strings[NVM::SCREEN_INVERT], nvm.GetValue(NVM::SCREEN_INVERT) ? "inverted" : "normal");
     menu.CreateString(menu_items[cnt++], menu_strings[NVM::AUTO_MPG_ON_START], nvm.GetValue(NVM::AUTO_MPG_ON_START) ? "enabled" : "disabled");
     menu.CreateString(menu_items[cnt++], menu_strings[NVM::SAVE_SCRIPT_RESULT], nvm.GetValue(NVM::SAVE_SCRIPT_RESULT) ? "enabled" : "disabled");
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::MPG_VELOCITY_JOG], nvm.GetValue(NVM::MPG_VELOCITY_JOG) ? "velocity" : "step");
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::MPG_ACCEL_CURVE], EncoderSpeed::GetCurveName((EncoderSpeed::Curve)nvm.GetValue(NVM::MPG_ACCEL_CURVE)));
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::MPG_VECTOR_PLANE], DirectControlScr::GetVectorPlaneName((DirectControlScr::VectorPlane)nvm.GetValue(NVM::MPG_VECTOR_PLANE)));
+    snprintf(tmp_str, NumberOf(tmp_str), "%ld deg", nvm.GetValue(NVM::MPG_VECTOR_ANGLE));
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::MPG_VECTOR_ANGLE], tmp_str);
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::DRO_PREDICTION], nvm.GetValue(NVM::DRO_PREDICTION) ? "enabled" : "disabled");
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::ROTARY_WRAP], nvm.GetValue(NVM::ROTARY_WRAP) ? "0-360 deg" : "disabled");
+    if(nvm.GetValue(NVM::ROTARY_DIVISIONS) != 0) snprintf(tmp_str, NumberOf(tmp_str), "%ld per rev", nvm.GetValue(NVM::ROTARY_DIVISIONS));
+    menu.CreateString(menu_items[cnt++], menu_strings[NVM::ROTARY_DIVISIONS], (nvm.GetValue(NVM::ROTARY_DIVISIONS) != 0) ? tmp_str : "off");
   }
   // MPG tab
   else if(tabs.GetSelectedTab() == MPG_TAB)
@@ -94,6 +94,8 @@ class SettingsScr : public IScreen
       "Version",
       // General
       "MPG request", "Display Inversion", "Auto MPG on startup", "Save script result",
+      "MPG jog mode", "MPG acceleration", "MPG vector plane", "MPG vector angle",
+      "DRO prediction", "Rotary wrap", "Rotary divisions",
       // MPG
       "Metric Feed 1", "Metric Feed 2", "Metric Feed 3", "Metric Feed 4",
       "Imperial Feed 1", "Imperial Feed 2", "Imperial Feed 3", "Imperial Feed 4",
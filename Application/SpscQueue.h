@@ -0,0 +1,94 @@
+//******************************************************************************
+//  @file SpscQueue.h
+//  @author Nicolai Shlapunov
+//
+//  @details SpscQueue: lock-free single producer single consumer queue, header
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef SpscQueue_h
+#define SpscQueue_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+
+// *****************************************************************************
+// ***   SpscQueue Class   *****************************************************
+// *****************************************************************************
+// Producer is an interrupt handler(or interrupts with the same preemption
+// priority, since they can't interrupt each other), consumer is a task. Head
+// written only by producer, tail written only by consumer, so no lock needed.
+// Size must be power of two, one element is always empty to tell full queue
+// from empty one.
+template<typename T, uint32_t N> class SpscQueue
+{
+  static_assert((N & (N - 1u)) == 0u, "Queue size must be power of two");
+
+  public:
+    // *************************************************************************
+    // ***   Public: Push   ****************************************************
+    // *************************************************************************
+    // Called by producer. Return false if queue is full.
+    bool Push(const T& item)
+    {
+      bool result = false;
+      uint32_t next = (head + 1u) & (N - 1u);
+      // If queue isn't full
+      if(next != tail)
+      {
+        buf[head] = item;
+        // Item have to be written before consumer can see new head
+        __DMB();
+        head = next;
+        result = true;
+      }
+      return result;
+    }
+
+    // *************************************************************************
+    // ***   Public: Pop   *****************************************************
+    // *************************************************************************
+    // Called by consumer. Return false if queue is empty.
+    bool Pop(T& item)
+    {
+      bool result = false;
+      // If queue isn't empty
+      if(tail != head)
+      {
+        // Head have to be read before item
+        __DMB();
+        item = buf[tail];
+        // Item have to be read before producer can overwrite it
+        __DMB();
+        tail = (tail + 1u) & (N - 1u);
+        result = true;
+      }
+      return result;
+    }
+
+    // *************************************************************************
+    // ***   Public: IsEmpty   *************************************************
+    // *************************************************************************
+    bool IsEmpty() {return (tail == head);}
+
+  private:
+    // Items
+    T buf[N];
+    // Index to write next item
+    volatile uint32_t head = 0u;
+    // Index to read next item
+    volatile uint32_t tail = 0u;
+};
+
+#endif
@@ -22,6 +22,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "DirtyRegions.h"
 
 // *****************************************************************************
 // ***   Tabs Class   **********************************************************
@@ -117,6 +118,12 @@ class Tabs : public VisObject
     // *************************************************************************
     virtual void Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy);
 
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    // Tabs object is in its own list and has coordinates relative to it
+    virtual void InvalidateObjArea(bool force = false) {list.InvalidateObjArea(force);}
+
   private:
 
     // Callback function pointer
@@ -139,19 +146,19 @@ class Tabs : public VisObject
     int32_t tab_w = 0;
 
     // List that contains all menu elements
-    VisList list;
+    Dirty<VisList> list;
 
     // Tabs objects
-    Box box[MAX_TABS];
+    Dirty<Box> box[MAX_TABS];
     // Image object for each tab
-    Image img[MAX_TABS];
+    Dirty<Image> img[MAX_TABS];
     // Two string objects for each tab
-    String tab_cap[MAX_TABS][2];
+    Dirty<String> tab_cap[MAX_TABS][2];
     // Selected tab object
-    Box tab;
+    Dirty<Box> tab;
 
     // Box to disable tabs
-    ShadowBox shadowbox;
+    Dirty<ShadowBox> shadowbox;
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
@@ -122,7 +122,7 @@ Result Tetris::Loop()
   TetrisShape next_shape;
 
   // String to show pause
-  String pause_str("PAUSE", (display_drv.GetScreenW() - strlen("PAUSE")*12)/2,(display_drv.GetScreenH() - 16) / 2, COLOR_WHITE, Font_12x16::GetInstance());
+  Dirty<String> pause_str("PAUSE", (display_drv.GetScreenW() - strlen("PAUSE")*12)/2,(display_drv.GetScreenH() - 16) / 2, COLOR_WHITE, Font_12x16::GetInstance());
 
   // Play Sound (Demo)
   sound_drv.PlaySound(music_data_table, NumberOf(music_data_table), 120U, true);
@@ -135,7 +135,7 @@ Result Tetris::Loop()
   shape.Show(2);
   next_shape.Show(3);
   char scr_str[32] = {" "};
-  String score_str(scr_str, (WIDTH + 1u) * CUBE_SIZE, 16, COLOR_WHITE, Font_8x12::GetInstance());
+  Dirty<String> score_str(scr_str, (WIDTH + 1u) * CUBE_SIZE, 16, COLOR_WHITE, Font_8x12::GetInstance());
   score_str.Show(3);
 
   // Init ticks variable
@@ -169,10 +169,10 @@ Result Tetris::Loop()
     if(bucket.CheckShapeCollisionIntoBucket(shape))
     {
       char str[16] = {"GAME OVER"};
-      String gameover_str(str,(display_drv.GetScreenW() - strlen(str)*12)/2,(display_drv.GetScreenH() - 16) / 2, COLOR_WHITE, Font_12x16::GetInstance());
+      Dirty<String> gameover_str(str,(display_drv.GetScreenW() - strlen(str)*12)/2,(display_drv.GetScreenH() - 16) / 2, COLOR_WHITE, Font_12x16::GetInstance());
       gameover_str.Show(10);
-      // Update Display
-      display_drv.UpdateDisplay();
+      // Invalidate dirty regions and update display
+      DirtyRegions::GetInstance().EndFrame();
       // Pause until next tick
       RtosTick::DelayMs(3000U);
       // Exit from cycle
@@ -182,6 +182,8 @@ Result Tetris::Loop()
     round = true;
     while(round == true)
     {
+      // Start frame time measurement
+      DirtyRegions::GetInstance().StartFrame();
       // Lock Display
       display_drv.LockDisplay();
 
@@ -281,8 +283,8 @@ Result Tetris::Loop()
       score_str.SetString(scr_str, NumberOf(scr_str), "Score: %lu", bucket.GetScore());
       // Unlock Display
       display_drv.UnlockDisplay();
-      // Update Display
-      display_drv.UpdateDisplay();
+      // Invalidate dirty regions and update display
+      DirtyRegions::GetInstance().EndFrame();
       // Pause until next tick
       RtosTick::DelayUntilMs(last_wake_ticks, delay);
     }
@@ -319,8 +321,8 @@ void TetrisShape::RotateShape(int8_t dir)
     shapeArray[shapeRtArray[shapeRotate][n]] = shapesArray[shapeNum][n];
   }
 
-  // Invalidate area, during rotation position isn't changed
-  InvalidateObjArea();
+  // Invalidate only cells changed by rotation
+  InvalidateChangedCells();
 }
 
 // *****************************************************************************
@@ -328,8 +330,6 @@ void TetrisShape::RotateShape(int8_t dir)
 // *****************************************************************************
 void TetrisShape::MoveShape(int8_t x, int8_t y, bool is_delta)
 {
-  // Invalidate area before move to redraw area object move from
-  InvalidateObjArea();
   // Make changes
   if(is_delta == true)
   {
@@ -343,8 +343,9 @@ void TetrisShape::MoveShape(int8_t x, int8_t y, bool is_delta)
     shapeTopLeftX = x;
     shapeTopLeftY = y;
   }
-  // Invalidate area after move to redraw area object move to
-  InvalidateObjArea();
+  // Invalidate only cells shape left and cells shape moved to. Shape cells are
+  // solid, so cells covered before and after move don't need redraw.
+  InvalidateChangedCells();
 }
 
 // *****************************************************************************
@@ -402,6 +403,9 @@ void TetrisShape::PopulateShapeArray(uint8_t shapeType, uint8_t color_idx)
   {
     shapeArray[n] = shapesArray[shapeNum][n];
   }
+
+  // Invalidate cells changed by the new shape
+  InvalidateChangedCells();
 }
 
 // *****************************************************************************
@@ -419,6 +423,9 @@ void TetrisShape::PopulateShapeArray(TetrisShape& shape)
   {
     shapeArray[n] = shape.shapeArray[n];
   }
+
+  // Invalidate cells changed by the new shape
+  InvalidateChangedCells();
 }
 
 // ***************************************************************************
@@ -426,6 +433,7 @@ void TetrisShape::PopulateShapeArray(TetrisShape& shape)
 // ***************************************************************************
 void TetrisShape::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
+  PERF_HUD_DRAW_START();
   // Draw only if needed
   if((line >= shapeTopLeftY*CUBE_SIZE) && (line < (shapeTopLeftY+4)*CUBE_SIZE))
   {
@@ -443,13 +451,14 @@ void TetrisShape::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t star
     // Prevent write in memory before buffer
     if(start < 0) start = 0;
     // Prevent buffer overflow
-    if(end > n) end = n;
+    if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
     if(end > 0)
     {
       for(int32_t i = start; i <= end; i++) buf[i] = colors[shapeColorIdx];
     }
   }
+  PERF_HUD_DRAW_END("TetrisShape");
 }
 
 // *****************************************************************************
@@ -463,7 +472,81 @@ void TetrisShape::InvalidateObjArea(bool force)
   y_start = shapeTopLeftY * CUBE_SIZE;
   y_end = (shapeTopLeftY + 4) * CUBE_SIZE;
   // And invalidate object area
-  VisObject::InvalidateObjArea();
+  DirtyRegions::GetInstance().Invalidate(*this, force);
+  // Whole shape will be redrawn
+  SaveDrawnShape();
+}
+
+// *****************************************************************************
+// ***   InvalidateChangedCells   **********************************************
+// *****************************************************************************
+void TetrisShape::InvalidateChangedCells()
+{
+  // Cells area that covers drawn and current shape
+  int32_t min_x = (drawnTopLeftX < shapeTopLeftX) ? drawnTopLeftX : shapeTopLeftX;
+  int32_t min_y = (drawnTopLeftY < shapeTopLeftY) ? drawnTopLeftY : shapeTopLeftY;
+  int32_t max_x = ((drawnTopLeftX > shapeTopLeftX) ? drawnTopLeftX : shapeTopLeftX) + 4;
+  int32_t max_y = ((drawnTopLeftY > shapeTopLeftY) ? drawnTopLeftY : shapeTopLeftY) + 4;
+
+  for(int32_t y = min_y; y < max_y; y++)
+  {
+    // Start of changed cells run in the line
+    int32_t run_start = -1;
+    for(int32_t x = min_x; x <= max_x; x++)
+    {
+      bool changed = false;
+      // Last column used only to finish the run
+      if(x < max_x)
+      {
+        // Check if cell is covered by drawn and current shape
+        int32_t dx = x - drawnTopLeftX;
+        int32_t dy = y - drawnTopLeftY;
+        int32_t sx = x - shapeTopLeftX;
+        int32_t sy = y - shapeTopLeftY;
+        bool drawn = (dx >= 0) && (dx < 4) && (dy >= 0) && (dy < 4) && drawnArray[dy*4 + dx];
+        bool shape = (sx >= 0) && (sx < 4) && (sy >= 0) && (sy < 4) && shapeArray[sy*4 + sx];
+        // Cell need redraw if it appeared, disappeared or changed color
+        changed = (drawn != shape) || (drawn && (drawnColorIdx != shapeColorIdx));
+      }
+      if(changed && (run_start < 0))
+      {
+        run_start = x;
+      }
+      else if(!changed && (run_start >= 0))
+      {
+        // Invalidate run of changed cells
+        DirtyRegions::GetInstance().Invalidate(run_start * CUBE_SIZE, y * CUBE_SIZE, x * CUBE_SIZE - 1, (y + 1) * CUBE_SIZE - 1);
+        run_start = -1;
+      }
+      else
+      {
+        ; // Do nothing - MISRA rule
+      }
+    }
+  }
+
+  // Object area
+  x_start = shapeTopLeftX * CUBE_SIZE;
+  x_end = (shapeTopLeftX + 4) * CUBE_SIZE;
+  y_start = shapeTopLeftY * CUBE_SIZE;
+  y_end = (shapeTopLeftY + 4) * CUBE_SIZE;
+
+  // Changed cells will be redrawn
+  SaveDrawnShape();
+}
+
+// *****************************************************************************
+// ***   SaveDrawnShape   ******************************************************
+// *****************************************************************************
+void TetrisShape::SaveDrawnShape()
+{
+  for(int32_t n = 0; n < 4*4; n++)
+  {
+    drawnArray[n] = shapeArray[n];
+  }
+  drawnColorIdx = shapeColorIdx;
+  drawnTopLeftX = shapeTopLeftX;
+  drawnTopLeftY = shapeTopLeftY;
 }
 
 // *****************************************************************************
@@ -499,6 +582,7 @@ void TetrisBucket::RemoveFullLines()
 {
   int32_t y;
   int32_t cnt = 0;
+  int32_t last = 0;
   // Don't check last line with border
   for (y = 0; y < HEIGHT - 1; y++)
   {
@@ -512,17 +596,28 @@ void TetrisBucket::RemoveFullLines()
     {
       memcpyback(&bucket[WIDTH], bucket, (y - 1)*WIDTH + x);
       cnt++;
+      last = y;
     }
   }
   if (cnt > 0)
   {
     // Update score
     score += 100 + 200 * (cnt - 1);
-    // Invalidate bucket to update
-    InvalidateObjArea();
+    // Lines below the last removed one aren't changed - invalidate only
+    // lines above it
+    InvalidateLines(0, last);
   }
 }
 
+// *****************************************************************************
+// ***   InvalidateLines   *****************************************************
+// *****************************************************************************
+void TetrisBucket::InvalidateLines(int32_t first, int32_t last)
+{
+  // Inside of bucket without borders
+  DirtyRegions::GetInstance().Invalidate(CUBE_SIZE, first * CUBE_SIZE, (WIDTH - 1) * CUBE_SIZE - 1, (last + 1) * CUBE_SIZE - 1);
+}
+
 // *****************************************************************************
 // ***   InitBucket   **********************************************************
 // *****************************************************************************
@@ -555,6 +650,7 @@ void TetrisBucket::InitBucket()
 // *****************************************************************************
 void TetrisBucket::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
+  PERF_HUD_DRAW_START();
   // Draw only if needed
   if(line < HEIGHT*CUBE_SIZE)
   {
@@ -567,8 +663,11 @@ void TetrisBucket::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t sta
       {
         int32_t start = (i*CUBE_SIZE) - start_x;
         int32_t end = start + CUBE_SIZE - 1;
-        // Have sense draw only if end pointer in buffer
-        if(end > 0)
+        // Clip cube by buffer: only part of the line can be updated
+        if(start < 0) start = 0;
+        if(end >= n) end = n - 1;
+        // Have sense draw only if cube is in buffer
+        if(end >= start)
         {
           for(int32_t i = start; i <= end; i++) buf[i] = colors[color];
         }
@@ -580,6 +679,7 @@ void TetrisBucket::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t sta
     volatile int32_t bucket_line = line/CUBE_SIZE;
     bucket_line--;
   }
+  PERF_HUD_DRAW_END("TetrisBucket");
 }
 
 // *****************************************************************************
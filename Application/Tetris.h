@@ -22,8 +22,10 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCore.h"
+#include "DirtyRegions.h"
 
 #include "InputDrv.h"
+#include "PerfHud.h"
 
 // *****************************************************************************
 // ***   Local const variables   ***********************************************
@@ -157,10 +159,27 @@ class TetrisShape : public VisObject
     // Shape Y position on screen
     int8_t shapeTopLeftY = 0;
 
+    // Shape as it was drawn on the screen last time: only cells that differ
+    // from it need to be redrawn
+    bool drawnArray[4*4] = {false};
+    int8_t drawnColorIdx = 0;
+    int8_t drawnTopLeftX = 0;
+    int8_t drawnTopLeftY = 0;
+
     // Static array contains all shapes
     static const bool shapesArray[7][4*4];
     // Static shape rotating matrixes
     static const int8_t shapeRtArray[4][4*4];
+
+    // *************************************************************************
+    // ***   InvalidateChangedCells   ******************************************
+    // *************************************************************************
+    void InvalidateChangedCells();
+
+    // *************************************************************************
+    // ***   SaveDrawnShape   **************************************************
+    // *************************************************************************
+    void SaveDrawnShape();
 };
 
 // *****************************************************************************
@@ -209,6 +228,11 @@ class TetrisBucket : public VisObject
     // *************************************************************************
     virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y) {};
 
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false) {DirtyRegions::GetInstance().Invalidate(*this, force);}
+
 private:
   // Bucket buffer
   uint8_t bucket[WIDTH*HEIGHT] = {0U};
@@ -219,6 +243,11 @@ private:
   // ***   Copy from end to start(for overlapped blocks)   *********************
   // ***************************************************************************
   static void memcpyback(uint8_t * dst, uint8_t * src, int32_t num);
+
+  // ***************************************************************************
+  // ***   Invalidate bucket lines   *******************************************
+  // ***************************************************************************
+  void InvalidateLines(int32_t first, int32_t last);
 };
 
 #endif
@@ -46,6 +46,9 @@ Result TextBox::Setup(int32_t x, int32_t y, int32_t w, int32_t h)
   box.SetList(*this);
   box.SetParams(0, 0, VisList::GetWidth(), Font_10x18::GetInstance().GetCharH(), COLOR_RED, true);
 
+  // Receive touches to scroll text
+  SetActive(true);
+
   // Return result
   return result;
 }
@@ -298,8 +301,8 @@ Result TextBox::Scroll(int32_t n)
       while((*ptr == '\n') || (*ptr == '\r')) ptr++;
       // If reached end of string - break the cycle
       if(*ptr == 0) break;
-      // Copy text
-      ptr = &ptr[Strncpy(str_text[idx], ptr, NumberOf(str_text[idx]))];
+      // Copy text, only changed characters will be updated on the display
+      ptr = &ptr[UpdateLine(idx, ptr)];
       // Increase line index
       idx++;
       // If we set at least one string
@@ -308,10 +311,8 @@ Result TextBox::Scroll(int32_t n)
     // Clear remaining lines
     for(; idx < visible_cnt; idx++)
     {
-      str_text[idx][0] = '\0';
+      UpdateLine(idx, "");
     }
-    // Invalidate area to update all strings on the display
-    InvalidateObjArea();
   }
   else
   {
@@ -323,6 +324,51 @@ Result TextBox::Scroll(int32_t n)
   return result;
 }
 
+// *****************************************************************************
+// ***   Private: UpdateLine function   ****************************************
+// *****************************************************************************
+uint32_t TextBox::UpdateLine(int32_t idx, const char* src)
+{
+  // Line buffer. Use string pointer since AddLine() can swap buffers.
+  char* dst = (char*)str[idx].GetString();
+  // Copy new line to temporary buffer to compare it with the current one
+  char buf[NumberOf(str_text[0u])];
+  uint32_t len = Strncpy(buf, src, NumberOf(buf));
+
+  // Find first and last changed characters
+  int32_t first = -1;
+  int32_t last = -1;
+  for(int32_t i = 0; (i < (int32_t)NumberOf(buf)) && ((buf[i] != '\0') || (dst[i] != '\0')); i++)
+  {
+    if(buf[i] != dst[i])
+    {
+      if(first < 0) first = i;
+      last = i;
+    }
+    // After end of one of the strings all characters of other string changed
+    if((buf[i] == '\0') || (dst[i] == '\0'))
+    {
+      last = (int32_t)((strlen(buf) > strlen(dst)) ? strlen(buf) : strlen(dst)) - 1;
+      break;
+    }
+  }
+
+  // If line changed
+  if(first >= 0)
+  {
+    // Copy new line
+    memcpy(dst, buf, strlen(buf) + 1u);
+    // Invalidate changed characters only. Most of scrolled G-code lines share
+    // the beginning(G1 X...) with previous line on the same place.
+    int32_t char_w = str[idx].GetFontW();
+    DirtyRegions::GetInstance().Invalidate(GetStartX() + str[idx].GetStartX() + first * char_w, GetStartY() + str[idx].GetStartY(),
+                                           GetStartX() + str[idx].GetStartX() + (last + 1) * char_w - 1, GetStartY() + str[idx].GetEndY());
+  }
+
+  // Return source line length
+  return len;
+}
+
 // *****************************************************************************
 // ***   Private: Strncpy function   *******************************************
 // *****************************************************************************
@@ -348,3 +394,88 @@ uint32_t TextBox::Strncpy(char *dst, const char *src, uint32_t n)
   // Return string length
   return i;
 }
+
+// *****************************************************************************
+// ***   Public: ProcessGestures   *********************************************
+// *****************************************************************************
+void TextBox::ProcessGestures()
+{
+  GestureEngine::Sample sample;
+  // Samples received since previous call
+  while(touch_samples.Pop(sample))
+  {
+    gesture.Process(sample);
+  }
+  // Move content by inertia
+  gesture.Update(RtosTick::GetTimeMs());
+
+  int32_t dx = 0;
+  int32_t dy = 0;
+  gesture.TakeDelta(dx, dy);
+  // Finger moves up - text scrolls forward
+  scroll_px -= dy;
+
+  // Scroll by whole lines
+  int32_t line_h = Font_10x18::GetInstance().GetCharH();
+  int32_t lines = scroll_px / line_h;
+  if(lines != 0)
+  {
+    scroll_px -= lines * line_h;
+    int32_t prev_scroll = scroll_pos;
+    Scroll(scroll_pos + lines);
+    // Can't scroll more - stop fling
+    if(scroll_pos == prev_scroll)
+    {
+      gesture.Stop();
+      scroll_px = 0;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Action   **************************************************************
+// *****************************************************************************
+void TextBox::Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy)
+{
+  // Called from touch handler: sample is only queued and processed by task
+  // that owns TextBox
+  GestureEngine::Sample sample = {RtosTick::GetTimeMs(), GestureEngine::MOVE, tx, ty};
+
+  // Switch for process action
+  switch(action)
+  {
+    // Touch action
+    case VisObject::ACT_TOUCH:
+      sample.event = GestureEngine::TOUCH;
+      (void)touch_samples.Push(sample);
+      break;
+
+    // Finger moves
+    case VisObject::ACT_MOVEIN: // Intentional fall-trough
+    case VisObject::ACT_HOLD:
+      (void)touch_samples.Push(sample);
+      break;
+
+    // Untouch action. Finger out of the box is release too, so content can
+    // fling after finger left it.
+    case VisObject::ACT_UNTOUCH: // Intentional fall-trough
+    case VisObject::ACT_MOVEOUT:
+      sample.event = GestureEngine::RELEASE;
+      (void)touch_samples.Push(sample);
+      break;
+
+    case VisObject::ACT_MAX:
+    default:
+      break;
+  }
+}
+
+// *****************************************************************************
+// ***   Invalidate Object Area   **********************************************
+// *****************************************************************************
+void TextBox::InvalidateObjArea(bool force)
+{
+  // Area will be coalesced with other dirty regions and invalidated at the end
+  // of the frame
+  DirtyRegions::GetInstance().Invalidate(*this, force);
+}
@@ -25,6 +25,9 @@
 
 #include "IScreen.h"
 #include "InputDrv.h"
+#include "DirtyRegions.h"
+#include "GestureEngine.h"
+#include "SpscQueue.h"
 
 // *****************************************************************************
 // ***   TextBox Class   *******************************************************
@@ -97,20 +100,44 @@ class TextBox : public VisList
     // *************************************************************************
     Result Scroll(int32_t n = 0);
 
+    // *************************************************************************
+    // ***   Public: ProcessGestures   *****************************************
+    // *************************************************************************
+    // Scroll text by drag and fling. Should be called periodically from task
+    // that owns TextBox.
+    void ProcessGestures();
+
+    // *************************************************************************
+    // ***   Action   **********************************************************
+    // *************************************************************************
+    virtual void Action(VisObject::ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy);
+
+    // *************************************************************************
+    // ***   Invalidate Object Area   ******************************************
+    // *************************************************************************
+    virtual void InvalidateObjArea(bool force = false);
+
   private:
+    // Touch samples: written by touch handler, read by task that owns TextBox
+    SpscQueue<GestureEngine::Sample, 16u> touch_samples;
+    // Gesture recognizer
+    GestureEngine gesture;
+    // Content movement in pixels not applied yet, less than one line
+    int32_t scroll_px = 0;
+
     // Pointer to text
     const char* p_text = nullptr;
     // Pointer to current scroll position
     const char* p_scroll = nullptr;
 
     // Strings to show text
-    String str[16];
+    Dirty<String> str[16];
     char str_text[16][80 + 2 + 1] = {0}; // One 80 characters line + CR + LF + \0
     // Visible lines count
     int32_t visible_cnt = 0;
 
     // Selection box
-    Box box;
+    Dirty<Box> box;
     // Current TextBox scroll position
     int32_t scroll_pos = 0;
     // Current TextBox select position
@@ -121,6 +148,11 @@ class TextBox : public VisList
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
 
+    // *************************************************************************
+    // ***   Private: UpdateLine function   ************************************
+    // *************************************************************************
+    uint32_t UpdateLine(int32_t idx, const char* src);
+
     // *************************************************************************
     // ***   Private: Strncpy function   ***************************************
     // *************************************************************************
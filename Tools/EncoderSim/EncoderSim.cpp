@@ -0,0 +1,348 @@
+//******************************************************************************
+//  @file EncoderSim.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details EncoderSim: host simulation of handwheel jogging. It replays
+//           recorded encoder click timestamps through EncoderSpeed estimator
+//           and acceleration curve the same way DirectControlScr does in step
+//           mode, and shows commanded and machine motion.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "EncoderSpeed.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Application task period: jog command sent once per tick
+#define APP_TICK_MS 20u
+// Minimal feed in clicks per second, the same as in DirectControlScr
+#define MIN_FEED_CLICKS 20u
+// Plot size
+#define PLOT_W 100u
+#define PLOT_H 16u
+
+// *****************************************************************************
+// ***   Click sample: clicks read at given time   *****************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t time_ms;
+  int32_t clicks;
+} Sample;
+
+// *****************************************************************************
+// ***   Result of one application tick   **************************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t time_ms;
+  uint32_t old_speed;  // Speed from the last pair of clicks, as it was before
+  uint32_t speed;      // Estimated speed
+  uint32_t gain;       // Curve gain
+  double cmd_pos;      // Commanded position
+  double pos;          // Machine position
+  uint32_t queued_ms;  // Motion time queued in machine
+} Tick;
+
+// *****************************************************************************
+// ***   Jog segment in machine queue   ****************************************
+// *****************************************************************************
+typedef struct
+{
+  double distance; // Remaining distance, signed
+  double speed;    // Units per ms
+} Segment;
+
+// *****************************************************************************
+// ***   Load samples: "time_ms clicks" on each line, # for comments   *********
+// *****************************************************************************
+static bool Load(const char* file_name, std::vector<Sample>& samples)
+{
+  FILE* f = fopen(file_name, "r");
+  if(f == nullptr) return false;
+
+  char line[128u];
+  while(fgets(line, sizeof(line), f) != nullptr)
+  {
+    Sample s;
+    if((line[0u] != '#') && (sscanf(line, "%u %d", &s.time_ms, &s.clicks) == 2))
+    {
+      samples.push_back(s);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// *****************************************************************************
+// ***   Generate test profile   ***********************************************
+// *****************************************************************************
+// Fast spin up to 400 clicks/s and sudden stop, pause, slow detent by detent
+// rotation in opposite direction with jitter.
+static void Generate(std::vector<Sample>& samples)
+{
+  double t = 100.0;
+  // Spin up during 500 ms, hold for 500 ms
+  while(t < 1100.0)
+  {
+    double speed = (t < 600.0) ? 20.0 + 380.0 * (t - 100.0) / 500.0 : 400.0;
+    samples.push_back({(uint32_t)t, 1});
+    t += 1000.0 / speed;
+  }
+  // Detents, 5 per second with +-20% jitter
+  srand(12345);
+  t = 2000.0;
+  for(uint32_t i = 0u; i < 10u; i++)
+  {
+    samples.push_back({(uint32_t)t, -1});
+    t += 200.0 * (0.8 + 0.4 * rand() / RAND_MAX);
+  }
+}
+
+// *****************************************************************************
+// ***   Simulate   ************************************************************
+// *****************************************************************************
+static void Simulate(const std::vector<Sample>& samples, EncoderSpeed::Curve curve, int32_t scale, std::vector<Tick>& ticks)
+{
+  EncoderSpeed enc_speed;
+  std::deque<Segment> queue;
+  uint32_t last_click_ms = 0u;
+  uint32_t old_speed = 0u;
+  int32_t jog_val = 0;
+  double cmd_pos = 0.0;
+  double pos = 0.0;
+
+  uint32_t end_ms = (samples.empty() ? 0u : samples.back().time_ms) + 1000u;
+  size_t idx = 0u;
+  for(uint32_t t = 0u; (t < end_ms) || !queue.empty(); t++)
+  {
+    // InputDrv task: read clicks every ms
+    while((idx < samples.size()) && (samples[idx].time_ms <= t))
+    {
+      int32_t clicks = samples[idx].clicks;
+      if(clicks != 0)
+      {
+        // Old speed calculation from the last pair of clicks
+        uint32_t ms_per_click = (t - last_click_ms) / abs(clicks);
+        if(ms_per_click == 0u) ms_per_click = 1u;
+        old_speed = 1000u / ms_per_click;
+        last_click_ms = t;
+
+        enc_speed.AddClicks(t, clicks);
+        jog_val += clicks;
+      }
+      idx++;
+    }
+
+    // Application task: one jog command per tick
+    if((t % APP_TICK_MS) == 0u)
+    {
+      uint32_t speed = enc_speed.GetSpeed(t);
+      uint32_t gain = EncoderSpeed::GetGain(curve, speed);
+      if(jog_val != 0)
+      {
+        int32_t distance = jog_val * scale * (int32_t)gain / (int32_t)ENCODER_GAIN_SCALE;
+        uint32_t feed = (speed < MIN_FEED_CLICKS) ? MIN_FEED_CLICKS : speed;
+        double units_per_ms = (double)feed * scale * gain / ENCODER_GAIN_SCALE / 1000.0;
+        queue.push_back({(double)distance, units_per_ms});
+        cmd_pos += distance;
+        jog_val = 0;
+      }
+      // Motion time in queue
+      double queued = 0.0;
+      for(const Segment& seg : queue) queued += fabs(seg.distance) / seg.speed;
+      ticks.push_back({t, old_speed, speed, gain, cmd_pos, pos, (uint32_t)queued});
+    }
+
+    // Machine: execute queue at requested feed, without acceleration
+    double time_left = 1.0;
+    while((time_left > 0.0) && !queue.empty())
+    {
+      Segment& seg = queue.front();
+      double step = seg.speed * time_left;
+      if(step >= fabs(seg.distance))
+      {
+        time_left -= fabs(seg.distance) / seg.speed;
+        pos += seg.distance;
+        queue.pop_front();
+      }
+      else
+      {
+        double d = (seg.distance > 0.0) ? step : -step;
+        pos += d;
+        seg.distance -= d;
+        time_left = 0.0;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Plot two values over time   *******************************************
+// *****************************************************************************
+static void Plot(const char* title, const std::vector<Tick>& ticks, double (*get_a)(const Tick&), double (*get_b)(const Tick&), char ch_a, char ch_b)
+{
+  double min = 0.0;
+  double max = 0.0;
+  for(const Tick& t : ticks)
+  {
+    double vals[2u] = {get_a(t), get_b(t)};
+    for(double v : vals)
+    {
+      if(v < min) min = v;
+      if(v > max) max = v;
+    }
+  }
+  if(max == min) max = min + 1.0;
+
+  // Each column is the last tick of its time slot
+  std::vector<std::string> rows(PLOT_H, std::string(PLOT_W, ' '));
+  for(size_t i = 0u; i < ticks.size(); i++)
+  {
+    size_t x = i * PLOT_W / ticks.size();
+    size_t ya = (size_t)((get_a(ticks[i]) - min) * (PLOT_H - 1u) / (max - min) + 0.5);
+    size_t yb = (size_t)((get_b(ticks[i]) - min) * (PLOT_H - 1u) / (max - min) + 0.5);
+    rows[PLOT_H - 1u - ya][x] = ch_a;
+    rows[PLOT_H - 1u - yb][x] = (ya == yb) ? '=' : ch_b;
+  }
+
+  printf("%s\n", title);
+  for(uint32_t y = 0u; y < PLOT_H; y++)
+  {
+    double v = max - (max - min) * y / (PLOT_H - 1u);
+    printf("%10.0f |%s\n", v, rows[y].c_str());
+  }
+  printf("%10s +%s\n", "", std::string(PLOT_W, '-').c_str());
+  printf("%10s  0 ms%*u ms\n\n", "", (int)PLOT_W - 7, ticks.empty() ? 0u : ticks.back().time_ms);
+}
+
+// *****************************************************************************
+// ***   Usage   ***************************************************************
+// *****************************************************************************
+static void Usage()
+{
+  printf("Usage: encsim [options] [clicks.txt]\n");
+  printf("  clicks.txt     recorded clicks: \"time_ms clicks\" per line, test profile if omitted\n");
+  printf("  -c curve       acceleration curve: linear, exponential or detent\n");
+  printf("  -s scale       units per click, default 10\n");
+  printf("  -o file.csv    save every tick into CSV file\n");
+  printf("  -q             don't plot\n");
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  EncoderSpeed::Curve curve = EncoderSpeed::CURVE_LINEAR;
+  int32_t scale = 10;
+  const char* csv_name = nullptr;
+  const char* file_name = nullptr;
+  bool plot = true;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+    {
+      i++;
+      curve = EncoderSpeed::CURVE_CNT;
+      for(uint32_t c = 0u; c < EncoderSpeed::CURVE_CNT; c++)
+      {
+        if(strcmp(argv[i], EncoderSpeed::GetCurveName((EncoderSpeed::Curve)c)) == 0) curve = (EncoderSpeed::Curve)c;
+      }
+      if(curve == EncoderSpeed::CURVE_CNT)
+      {
+        Usage();
+        return 1;
+      }
+    }
+    else if((strcmp(argv[i], "-s") == 0) && (i + 1 < argc)) scale = atoi(argv[++i]);
+    else if((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) csv_name = argv[++i];
+    else if(strcmp(argv[i], "-q") == 0) plot = false;
+    else if(argv[i][0] != '-') file_name = argv[i];
+    else
+    {
+      Usage();
+      return 1;
+    }
+  }
+
+  // Clicks to replay
+  std::vector<Sample> samples;
+  if(file_name != nullptr)
+  {
+    if(!Load(file_name, samples))
+    {
+      printf("Can't open %s\n", file_name);
+      return 1;
+    }
+  }
+  else
+  {
+    Generate(samples);
+  }
+
+  std::vector<Tick> ticks;
+  Simulate(samples, curve, scale, ticks);
+
+  if(csv_name != nullptr)
+  {
+    FILE* f = fopen(csv_name, "w");
+    if(f == nullptr)
+    {
+      printf("Can't create %s\n", csv_name);
+      return 1;
+    }
+    fprintf(f, "time_ms,old_speed,speed,gain,cmd_pos,pos,queued_ms\n");
+    for(const Tick& t : ticks)
+    {
+      fprintf(f, "%u,%u,%u,%u,%.1f,%.1f,%u\n", t.time_ms, t.old_speed, t.speed, t.gain, t.cmd_pos, t.pos, t.queued_ms);
+    }
+    fclose(f);
+  }
+
+  if(plot)
+  {
+    Plot("Speed, clicks/s: # estimated, . last pair of clicks", ticks, [](const Tick& t) {return (double)t.speed;}, [](const Tick& t) {return (double)t.old_speed;}, '#', '.');
+    Plot("Position, units: # commanded, * machine", ticks, [](const Tick& t) {return t.cmd_pos;}, [](const Tick& t) {return t.pos;}, '#', '*');
+  }
+
+  // Summary: the last click, when machine reached commanded position and
+  // maximum motion queued
+  uint32_t last_click_ms = 0u;
+  for(const Sample& s : samples) if(s.clicks != 0) last_click_ms = s.time_ms;
+  uint32_t max_queued_ms = 0u;
+  uint32_t settle_ms = 0u;
+  for(const Tick& t : ticks)
+  {
+    if(t.queued_ms > max_queued_ms) max_queued_ms = t.queued_ms;
+    if(t.queued_ms != 0u) settle_ms = t.time_ms;
+  }
+  printf("Curve: %s, scale: %d, clicks: %zu\n", EncoderSpeed::GetCurveName(curve), scale, samples.size());
+  printf("Commanded: %.0f units, max queued motion: %u ms, motion after the last click: %u ms\n", ticks.empty() ? 0.0 : ticks.back().cmd_pos, max_queued_ms, (settle_ms > last_click_ms) ? settle_ms - last_click_ms : 0u);
+
+  return 0;
+}
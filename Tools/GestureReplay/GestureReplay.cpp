@@ -0,0 +1,287 @@
+//******************************************************************************
+//  @file GestureReplay.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details GestureReplay: host replay of recorded touch traces through
+//           GestureEngine. Shows recognized gestures and content movement, and
+//           checks that result doesn't depend on touch sample rate.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "GestureEngine.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Application task period: gestures processed once per tick
+#define APP_TICK_MS 20u
+// Allowed difference of content movement between sample rates
+#define RATE_TOLERANCE_PCT 5.0
+
+// *****************************************************************************
+// ***   Touch sample   ********************************************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t time_ms;
+  char event;       // 'd' - finger down, 'm' - move, 'u' - finger up
+  int32_t x;
+  int32_t y;
+} Sample;
+
+// *****************************************************************************
+// ***   Replay result   *******************************************************
+// *****************************************************************************
+typedef struct
+{
+  int32_t x;         // Content movement
+  int32_t y;
+  uint32_t taps;     // Number of taps
+  uint32_t flings;   // Number of flings
+  uint32_t end_ms;   // Time when motion stops
+} Summary;
+
+// *****************************************************************************
+// ***   Load samples: "time_ms event x y" on each line, # for comments   ******
+// *****************************************************************************
+static bool Load(const char* file_name, std::vector<Sample>& samples)
+{
+  FILE* f = fopen(file_name, "r");
+  if(f == nullptr) return false;
+
+  char line[128u];
+  while(fgets(line, sizeof(line), f) != nullptr)
+  {
+    Sample s = {0u, 'm', 0, 0};
+    if((line[0u] != '#') && (sscanf(line, "%u %c %d %d", &s.time_ms, &s.event, &s.x, &s.y) == 4))
+    {
+      samples.push_back(s);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// *****************************************************************************
+// ***   Generate test trace   *************************************************
+// *****************************************************************************
+// Tap, slow drag that stops before release and fast upward flick. Finger
+// positions are sampled with given rate.
+static void Generate(std::vector<Sample>& samples, uint32_t rate_hz)
+{
+  double period = 1000.0 / rate_hz;
+
+  // Tap with small jitter
+  samples.push_back({100u, 'd', 120, 200});
+  samples.push_back({100u + (uint32_t)period, 'm', 121, 201});
+  samples.push_back({180u, 'u', 121, 201});
+
+  // Slow drag down 100 px in 1 s, then hold for 200 ms
+  samples.push_back({500u, 'd', 120, 100});
+  for(double t = period; t < 1200.0; t += period)
+  {
+    double y = 100.0 + ((t < 1000.0) ? t : 1000.0) / 10.0;
+    samples.push_back({500u + (uint32_t)t, 'm', 120, (int32_t)lround(y)});
+  }
+  samples.push_back({1700u, 'u', 120, 200});
+
+  // Flick up 150 px in 100 ms with ease-in
+  samples.push_back({2500u, 'd', 120, 250});
+  for(double t = period; t < 100.0; t += period)
+  {
+    double k = t / 100.0;
+    samples.push_back({2500u + (uint32_t)t, 'm', 120, (int32_t)lround(250.0 - 150.0 * k * k)});
+  }
+  samples.push_back({2600u, 'u', 120, 100});
+}
+
+// *****************************************************************************
+// ***   Decimate trace: keep every n-th move sample   *************************
+// *****************************************************************************
+static void Decimate(const std::vector<Sample>& in, uint32_t n, std::vector<Sample>& out)
+{
+  uint32_t cnt = 0u;
+  for(size_t i = 0u; i < in.size(); i++)
+  {
+    // Down & up samples are always kept
+    if((in[i].event != 'm') || ((++cnt % n) == 0u))
+    {
+      out.push_back(in[i]);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Replay   **************************************************************
+// *****************************************************************************
+static void Replay(const std::vector<Sample>& samples, bool verbose, FILE* csv, Summary& sum)
+{
+  static const char* const state_str[] = {"idle", "pressed", "drag", "fling"};
+
+  GestureEngine gesture;
+  GestureEngine::State state = GestureEngine::IDLE;
+  memset(&sum, 0, sizeof(sum));
+
+  if(csv != nullptr) fprintf(csv, "time_ms,state,x,y,vx,vy\n");
+
+  uint32_t end_ms = (samples.empty() ? 0u : samples.back().time_ms) + 5000u;
+  size_t idx = 0u;
+  for(uint32_t t = 0u; t < end_ms; t += APP_TICK_MS)
+  {
+    // Touch samples received since previous tick
+    while((idx < samples.size()) && (samples[idx].time_ms <= t))
+    {
+      const Sample& s = samples[idx++];
+      GestureEngine::Sample gs = {s.time_ms, GestureEngine::MOVE, s.x, s.y};
+      if(s.event == 'd')      gs.event = GestureEngine::TOUCH;
+      else if(s.event == 'u') gs.event = GestureEngine::RELEASE;
+      else                    gs.event = GestureEngine::MOVE;
+      gesture.Process(gs);
+
+      if(gesture.GetState() != state)
+      {
+        if(verbose) printf("%6u ms  %-7s -> %-7s v = %7.1f, %7.1f px/s\n", s.time_ms, state_str[state], state_str[gesture.GetState()], gesture.GetVelocityX(), gesture.GetVelocityY());
+        if(gesture.GetState() == GestureEngine::FLING) sum.flings++;
+        state = gesture.GetState();
+      }
+    }
+
+    // Application tick
+    gesture.Update(t);
+    int32_t dx = 0;
+    int32_t dy = 0;
+    gesture.TakeDelta(dx, dy);
+    sum.x += dx;
+    sum.y += dy;
+    int32_t tx = 0;
+    int32_t ty = 0;
+    if(gesture.TakeTap(tx, ty))
+    {
+      sum.taps++;
+      if(verbose) printf("%6u ms  tap at %d, %d\n", t, tx, ty);
+    }
+    if(gesture.GetState() != state)
+    {
+      if(verbose) printf("%6u ms  %-7s -> %-7s content moved %d, %d px\n", t, state_str[state], state_str[gesture.GetState()], sum.x, sum.y);
+      state = gesture.GetState();
+    }
+    if((gesture.GetState() != GestureEngine::IDLE) || (dx != 0) || (dy != 0)) sum.end_ms = t;
+
+    if(csv != nullptr) fprintf(csv, "%u,%s,%d,%d,%.1f,%.1f\n", t, state_str[gesture.GetState()], sum.x, sum.y, gesture.GetVelocityX(), gesture.GetVelocityY());
+  }
+}
+
+// *****************************************************************************
+// ***   Usage   ***************************************************************
+// *****************************************************************************
+static void Usage()
+{
+  printf("Usage: gesture-replay [options] [trace.txt]\n");
+  printf("  trace.txt      recorded touch: \"time_ms d|m|u x y\" per line, test trace if omitted\n");
+  printf("  -o file.csv    save every tick into CSV file\n");
+  printf("  -r             check that result doesn't depend on sample rate\n");
+  printf("  -q             don't show gestures\n");
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  const char* csv_name = nullptr;
+  const char* file_name = nullptr;
+  bool verbose = true;
+  bool rate_check = false;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) csv_name = argv[++i];
+    else if(strcmp(argv[i], "-r") == 0) rate_check = true;
+    else if(strcmp(argv[i], "-q") == 0) verbose = false;
+    else if(argv[i][0] != '-') file_name = argv[i];
+    else
+    {
+      Usage();
+      return 1;
+    }
+  }
+
+  // Trace to replay
+  std::vector<Sample> samples;
+  if(file_name != nullptr)
+  {
+    if(!Load(file_name, samples))
+    {
+      printf("Can't open %s\n", file_name);
+      return 1;
+    }
+  }
+  else
+  {
+    Generate(samples, 120u);
+  }
+
+  FILE* csv = nullptr;
+  if(csv_name != nullptr)
+  {
+    csv = fopen(csv_name, "w");
+    if(csv == nullptr)
+    {
+      printf("Can't create %s\n", csv_name);
+      return 1;
+    }
+  }
+
+  Summary sum;
+  Replay(samples, verbose, csv, sum);
+  if(csv != nullptr) fclose(csv);
+  printf("Samples: %zu, taps: %u, flings: %u, content moved %d, %d px, motion ends at %u ms\n", samples.size(), sum.taps, sum.flings, sum.x, sum.y, sum.end_ms);
+
+  int ret = 0;
+  if(rate_check)
+  {
+    // Generated trace is sampled again with other rates, recorded trace
+    // is decimated
+    static const uint32_t rates[] = {240u, 60u, 30u};
+    static const uint32_t steps[] = {2u, 3u, 4u};
+    for(uint32_t i = 0u; i < 3u; i++)
+    {
+      std::vector<Sample> other;
+      if(file_name == nullptr) Generate(other, rates[i]);
+      else                     Decimate(samples, steps[i], other);
+
+      Summary s;
+      Replay(other, false, nullptr, s);
+      double len = sqrt((double)sum.x * sum.x + (double)sum.y * sum.y);
+      double diff = sqrt((double)(s.x - sum.x) * (s.x - sum.x) + (double)(s.y - sum.y) * (s.y - sum.y));
+      double pct = (len > 0.0) ? diff * 100.0 / len : 0.0;
+      bool ok = (pct <= RATE_TOLERANCE_PCT) && (s.taps == sum.taps) && (s.flings == sum.flings);
+      if(file_name == nullptr) printf("%4u Hz:", rates[i]);
+      else                     printf("1/%u samples:", steps[i]);
+      printf(" taps: %u, flings: %u, content moved %d, %d px, difference %.1f%% %s\n", s.taps, s.flings, s.x, s.y, pct, ok ? "OK" : "FAIL");
+      if(!ok) ret = 1;
+    }
+  }
+
+  return ret;
+}
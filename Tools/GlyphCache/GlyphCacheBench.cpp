@@ -0,0 +1,102 @@
+//******************************************************************************
+//  @file GlyphCacheBench.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details GlyphCacheBench: renders DataWindow updates into in-memory line
+//           buffer with and without glyph cache and compares time and result.
+//           DataWindow and GlyphCache are built from the application sources
+//           with DevCore replacement from Tools/UiRender.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DataWindow.h"
+#include "GlyphCache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+#define LINE_W 320
+
+// *****************************************************************************
+// ***   DrawLines   ***********************************************************
+// *****************************************************************************
+// Draws all lines of the window, returns time in microseconds. Last line stays
+// in the buffer.
+static double DrawLines(DataWindow& dw, color_t* buf, bool cache)
+{
+  GlyphCache::GetInstance().SetEnabled(cache);
+  auto start = std::chrono::steady_clock::now();
+  for(int32_t line = dw.GetStartY(); line <= dw.GetEndY(); line++)
+  {
+    dw.DrawInBufW(buf, LINE_W, line, 0);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+// *****************************************************************************
+// ***   main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  // Number of DRO updates
+  uint32_t updates = (argc > 1) ? atoi(argv[1]) : 20000u;
+  // Scale of the font
+  uint32_t scale = (argc > 2) ? atoi(argv[2]) : 2u;
+
+  // DRO window as on the main screen
+  DataWindow dw;
+  dw.SetParams(0, 0, LINE_W, Font_8x12::GetInstance().GetCharH() * scale + 8, 7u, 3u);
+  dw.SetDataFont(Font_8x12::GetInstance(), scale);
+
+  static color_t buf_str[LINE_W];
+  static color_t buf_cache[LINE_W];
+
+  double time[2u] = {0.0, 0.0};
+  uint32_t mismatch = 0u;
+
+  // Simulate jogging: value changes every update, every window line is drawn
+  for(uint32_t u = 0u; u < updates; u++)
+  {
+    dw.SetNumber((int32_t)(u * 7u) - 50000);
+
+    // Without and with cache
+    time[0u] += DrawLines(dw, buf_str, false);
+    time[1u] += DrawLines(dw, buf_cache, true);
+
+    // Compare every line of both renders
+    for(int32_t line = dw.GetStartY(); line <= dw.GetEndY(); line++)
+    {
+      GlyphCache::GetInstance().SetEnabled(false);
+      dw.DrawInBufW(buf_str, LINE_W, line, 0);
+      GlyphCache::GetInstance().SetEnabled(true);
+      dw.DrawInBufW(buf_cache, LINE_W, line, 0);
+      if(memcmp(buf_str, buf_cache, sizeof(buf_str)) != 0) mismatch++;
+    }
+  }
+
+  printf("Updates: %u, scale: %u\n", updates, scale);
+  printf("String:      %8.3f us/update\n", time[0u] / updates);
+  printf("Glyph cache: %8.3f us/update (x%.2f)\n", time[1u] / updates, time[0u] / time[1u]);
+  printf("Cache hits: %u, misses: %u\n", GlyphCache::GetInstance().GetHitCnt(), GlyphCache::GetInstance().GetMissCnt());
+  printf("Mismatched lines: %u\n", mismatch);
+
+  // Return error if cached output differs
+  return (mismatch == 0u) ? 0 : 1;
+}
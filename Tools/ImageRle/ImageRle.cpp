@@ -0,0 +1,353 @@
+//******************************************************************************
+//  @file ImageRle.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details ImageRle: host tool to compress 8-bit palette images for RleImage
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Line buffer width for benchmark: display width
+#define LINE_BUF_W 480
+// Number of benchmark passes over the whole image
+#define BENCH_PASSES 20000
+
+typedef uint16_t color_t;
+
+// *****************************************************************************
+// ***   Raw image   ***********************************************************
+// *****************************************************************************
+typedef struct
+{
+  std::string name;
+  int32_t width;
+  int32_t height;
+  std::string palette;
+  int32_t transparent;
+  std::vector<uint8_t> pixels;
+} RawImage;
+
+// *****************************************************************************
+// ***   RLE image in the same layout as RleImageDesc   ************************
+// *****************************************************************************
+typedef struct
+{
+  int32_t width;
+  int32_t height;
+  const uint16_t* lines;
+  const uint8_t* data;
+  const color_t* palette;
+  int32_t transparent;
+} RleImageDesc;
+
+// *****************************************************************************
+// ***   Encode   **************************************************************
+// *****************************************************************************
+static void Encode(const RawImage& img, std::vector<uint16_t>& lines, std::vector<uint8_t>& data)
+{
+  for(int32_t y = 0; y < img.height; y++)
+  {
+    // Every line starts from a new run, so it can be decoded on its own
+    lines.push_back((uint16_t)data.size());
+    const uint8_t* p = &img.pixels[y * img.width];
+    // Index of literal control byte, -1 if there is no open literal
+    int32_t literal = -1;
+    for(int32_t x = 0; x < img.width;)
+    {
+      int32_t cnt = 1;
+      while((x + cnt < img.width) && (cnt < 128) && (p[x + cnt] == p[x])) cnt++;
+      // Three or more same pixels are stored as run. Transparent pixels always
+      // stored as run, so decoder can skip them at once.
+      if((cnt >= 3) || ((int32_t)p[x] == img.transparent))
+      {
+        data.push_back((uint8_t)(0x80u | (cnt - 1)));
+        data.push_back(p[x]);
+        literal = -1;
+      }
+      else
+      {
+        for(int32_t i = 0; i < cnt; i++)
+        {
+          // Start new literal or append pixel to open one
+          if((literal < 0) || (data[literal] == 0x7Fu))
+          {
+            literal = (int32_t)data.size();
+            data.push_back(0u);
+          }
+          else
+          {
+            data[literal]++;
+          }
+          data.push_back(p[x]);
+        }
+      }
+      x += cnt;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   DrawLine: same as RleImage::DrawLine()   ******************************
+// *****************************************************************************
+static void DrawLine(const RleImageDesc& img_dsc, color_t* buf, int32_t n, int32_t line, int32_t x)
+{
+  if((line >= 0) && (line < img_dsc.height))
+  {
+    const uint8_t* p = &img_dsc.data[img_dsc.lines[line]];
+    int32_t end = x + img_dsc.width;
+    while((x < end) && (x < n))
+    {
+      int32_t cnt = (p[0u] & 0x7Fu) + 1;
+      int32_t i = (x < 0) ? 0 : x;
+      int32_t i_end = (x + cnt > n) ? n : x + cnt;
+      if(p[0u] & 0x80u)
+      {
+        if((int32_t)p[1u] != img_dsc.transparent)
+        {
+          color_t color = img_dsc.palette[p[1u]];
+          for(; i < i_end; i++) buf[i] = color;
+        }
+        p += 2u;
+      }
+      else
+      {
+        for(; i < i_end; i++) buf[i] = img_dsc.palette[p[1 + i - x]];
+        p += 1 + cnt;
+      }
+      x += cnt;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   DrawRawLine: per pixel palette lookup as for raw 8-bit image   ********
+// *****************************************************************************
+static void DrawRawLine(const RawImage& img, const color_t* palette, color_t* buf, int32_t n, int32_t line, int32_t x)
+{
+  if((line >= 0) && (line < img.height))
+  {
+    const uint8_t* p = &img.pixels[line * img.width];
+    for(int32_t i = 0; i < img.width; i++)
+    {
+      if((x + i >= 0) && (x + i < n) && ((int32_t)p[i] != img.transparent))
+      {
+        buf[x + i] = palette[p[i]];
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Parse C source with ImageDesc & data arrays   *************************
+// *****************************************************************************
+static bool ParseSource(const std::string& src, std::vector<RawImage>& images)
+{
+  bool result = true;
+  std::regex desc_re("const\\s+ImageDesc\\s+(\\w+)\\s*=\\s*\\{\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*\\d+\\s*,"
+                     "\\s*\\{\\s*\\.imgp\\s*=\\s*(\\w+)\\s*\\}\\s*,\\s*(\\w+)\\s*,\\s*\\(int32_t\\)\\w+\\[(\\w+)\\]");
+  for(std::sregex_iterator it(src.begin(), src.end(), desc_re); (it != std::sregex_iterator()) && result; ++it)
+  {
+    RawImage img;
+    img.name = (*it)[1];
+    img.width = atoi((*it)[2].str().c_str());
+    img.height = atoi((*it)[3].str().c_str());
+    img.palette = (*it)[5];
+    img.transparent = strtol((*it)[6].str().c_str(), nullptr, 0);
+    // Find data array
+    std::smatch m;
+    std::regex data_re("const\\s+uint8_t\\s+" + (*it)[4].str() + "\\s*\\[\\s*\\]\\s*=\\s*\\{([^}]*)\\}");
+    if(std::regex_search(src, m, data_re))
+    {
+      std::stringstream ss(m[1].str());
+      std::string val;
+      while(std::getline(ss, val, ','))
+      {
+        if(val.find_first_not_of(" \t\r\n") != std::string::npos) img.pixels.push_back((uint8_t)strtol(val.c_str(), nullptr, 0));
+      }
+    }
+    if(img.pixels.size() != (size_t)(img.width * img.height))
+    {
+      fprintf(stderr, "%s: expected %d pixels, found %zu\n", img.name.c_str(), img.width * img.height, img.pixels.size());
+      result = false;
+    }
+    else
+    {
+      images.push_back(img);
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Print array   *********************************************************
+// *****************************************************************************
+template<typename T> static void PrintArray(const char* type, const std::string& name, const std::vector<T>& arr, const char* fmt)
+{
+  printf("static const %s %s[] = {", type, name.c_str());
+  for(size_t i = 0u; i < arr.size(); i++)
+  {
+    if(i % 16u == 0u) printf("\n");
+    printf(fmt, (unsigned)arr[i]);
+  }
+  printf("\n};\n\n");
+}
+
+// *****************************************************************************
+// ***   Process image: encode, verify, measure, print   ***********************
+// *****************************************************************************
+static bool Process(const RawImage& img)
+{
+  bool result = true;
+  std::vector<uint16_t> lines;
+  std::vector<uint8_t> data;
+  Encode(img, lines, data);
+
+  // Synthetic palette: only lookup cost matters
+  static color_t palette[256];
+  for(uint32_t i = 0u; i < 256u; i++) palette[i] = (color_t)(i * 0x0101u + 1u);
+  RleImageDesc dsc = {img.width, img.height, lines.data(), data.data(), palette, img.transparent};
+
+  // Verify decoded image at few positions, including clipped ones
+  static color_t buf_rle[LINE_BUF_W];
+  static color_t buf_raw[LINE_BUF_W];
+  const int32_t pos[] = {0, 100, -7, LINE_BUF_W - 13};
+  for(uint32_t p = 0u; p < sizeof(pos) / sizeof(pos[0]); p++)
+  {
+    for(int32_t y = 0; y < img.height; y++)
+    {
+      memset(buf_rle, 0, sizeof(buf_rle));
+      memset(buf_raw, 0, sizeof(buf_raw));
+      DrawLine(dsc, buf_rle, LINE_BUF_W, y, pos[p]);
+      DrawRawLine(img, palette, buf_raw, LINE_BUF_W, y, pos[p]);
+      if(memcmp(buf_rle, buf_raw, sizeof(buf_rle)) != 0)
+      {
+        fprintf(stderr, "%s: line %d at x %d decoded with error\n", img.name.c_str(), y, pos[p]);
+        result = false;
+      }
+    }
+  }
+
+  // Measure render cost per line
+  auto t0 = std::chrono::steady_clock::now();
+  for(uint32_t i = 0u; i < BENCH_PASSES; i++)
+  {
+    for(int32_t y = 0; y < img.height; y++) DrawRawLine(img, palette, buf_raw, LINE_BUF_W, y, (int32_t)(i & 0xFFu));
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for(uint32_t i = 0u; i < BENCH_PASSES; i++)
+  {
+    for(int32_t y = 0; y < img.height; y++) DrawLine(dsc, buf_rle, LINE_BUF_W, y, (int32_t)(i & 0xFFu));
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  double lines_cnt = (double)BENCH_PASSES * img.height;
+  double raw_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / lines_cnt;
+  double rle_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / lines_cnt;
+
+  size_t raw_size = img.pixels.size();
+  size_t rle_size = data.size() + lines.size() * sizeof(uint16_t);
+  fprintf(stderr, "%-12s %3dx%-3d raw %5zu bytes, RLE %5zu bytes (%zu bytes of lines), saved %5ld bytes (%4.1f%%), line: raw %6.1f ns, RLE %6.1f ns\n",
+          img.name.c_str(), img.width, img.height, raw_size, rle_size, lines.size() * sizeof(uint16_t),
+          (long)raw_size - (long)rle_size, 100.0 * ((double)raw_size - (double)rle_size) / (double)raw_size, raw_ns, rle_ns);
+
+  // Print C source
+  printf("// %s: %dx%d, raw %zu bytes, RLE %zu bytes\n", img.name.c_str(), img.width, img.height, raw_size, rle_size);
+  PrintArray("uint16_t", img.name + "_lines", lines, "%u, ");
+  PrintArray("uint8_t", img.name + "_rle", data, "0x%02X, ");
+  printf("const RleImageDesc %s = {%d, %d, %s_lines, %s_rle, %s, 0x%02X};\n\n", img.name.c_str(), img.width, img.height,
+         img.name.c_str(), img.name.c_str(), img.palette.c_str(), img.transparent);
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Usage   ***************************************************************
+// *****************************************************************************
+static void Usage()
+{
+  fprintf(stderr, "Usage: imgrle <file.cpp>\n"
+                  "       imgrle -r <name> <width> <height> <palette> <transparent> <file.bin>\n"
+                  "\n"
+                  "Source file is parsed for 8-bit ImageDesc images and their data arrays.\n"
+                  "Raw file contains one palette index byte per pixel. Transparent is\n"
+                  "palette index or -1. RLE source printed to stdout, statistic to stderr.\n");
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  bool result = true;
+  std::vector<RawImage> images;
+
+  if((argc == 8) && (strcmp(argv[1], "-r") == 0))
+  {
+    RawImage img;
+    img.name = argv[2];
+    img.width = atoi(argv[3]);
+    img.height = atoi(argv[4]);
+    img.palette = argv[5];
+    img.transparent = strtol(argv[6], nullptr, 0);
+    std::ifstream f(argv[7], std::ios::binary);
+    img.pixels.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    if(img.pixels.size() != (size_t)(img.width * img.height))
+    {
+      fprintf(stderr, "%s: expected %d pixels, found %zu\n", argv[7], img.width * img.height, img.pixels.size());
+      result = false;
+    }
+    else
+    {
+      images.push_back(img);
+    }
+  }
+  else if(argc == 2)
+  {
+    std::ifstream f(argv[1]);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    result = ParseSource(ss.str(), images);
+    if(result && images.empty())
+    {
+      fprintf(stderr, "%s: no images found\n", argv[1]);
+      result = false;
+    }
+  }
+  else
+  {
+    Usage();
+    result = false;
+  }
+
+  for(size_t i = 0u; (i < images.size()) && result; i++)
+  {
+    result = Process(images[i]);
+  }
+
+  return result ? 0 : 1;
+}
@@ -0,0 +1,368 @@
+//******************************************************************************
+//  @file JogLatencySim.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details JogLatencySim: host simulation of jog latency from encoder click to
+//           machine motion. Tasks of the pendant and fake controller are
+//           simulated with 1 us step, trace points are marked at the same
+//           stages as in firmware and report is made by the same JogTrace.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+
+#include "JogTrace.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Application task period
+#define APP_TICK_US 20000u
+// GrblComm task period: serial port polled once per tick
+#define GRBL_TICK_US 1000u
+// GrblComm retries busy message after this delay
+#define GRBL_RETRY_US 1000u
+// Application task time to process encoder callback
+#define APP_CALLBACK_US 20u
+// Message lengths, bytes
+#define JOG_CMD_LEN 28u
+#define OK_LEN 4u
+#define STATUS_LEN 64u
+
+// *****************************************************************************
+// ***   Simulation parameters   ***********************************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t click_rate;   // Handwheel clicks per second
+  uint32_t time_s;       // Simulation time
+  uint32_t app_busy_us;  // Application task time for one tick
+  uint32_t wake_us;      // Time from interrupt to InputDrv task wake up
+  uint32_t status_ms;    // Status request period
+  uint32_t baud;         // UART baudrate
+  uint32_t plan_us;      // Controller time to parse and plan jog command
+  uint32_t start_us;     // Controller time from plan to first step
+  uint32_t jog_us;       // Controller motion time for one click, 0 - click period
+  uint32_t seed;         // Random seed for click jitter
+} Params;
+
+// *****************************************************************************
+// ***   Line received by pendant from controller   ****************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t time_us;   // Time when last byte received
+  bool is_status;     // Status report or "ok"
+  bool pos_changed;   // Status: position changed since previous report
+} RxLine;
+
+// *****************************************************************************
+// ***   Motion interval of the fake controller   ******************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t start_us;
+  uint32_t end_us;
+} Motion;
+
+// *****************************************************************************
+// ***   Random number: simple LCG, the same sequence on every host   **********
+// *****************************************************************************
+static uint32_t Random(uint32_t& state)
+{
+  state = state * 1664525u + 1013904223u;
+  return state >> 8u;
+}
+
+// *****************************************************************************
+// ***   UART transfer time   **************************************************
+// *****************************************************************************
+static uint32_t TransferUs(uint32_t bytes, uint32_t baud)
+{
+  // Start, 8 data bits and stop
+  return (uint32_t)((uint64_t)bytes * 10u * 1000000u / baud);
+}
+
+// *****************************************************************************
+// ***   Simulate   ************************************************************
+// *****************************************************************************
+static void Simulate(const Params& p)
+{
+  JogTrace& trace = JogTrace::GetInstance();
+  trace.Setup(1u);
+
+  uint32_t rnd = p.seed;
+  uint32_t click_period = 1000000u / p.click_rate;
+  uint32_t end_us = p.time_s * 1000000u;
+
+  // Handwheel
+  uint32_t next_click_us = 1000u;
+  // Encoder interrupt: clicks not taken by InputDrv task yet
+  int32_t isr_clicks = 0;
+  bool input_wake = false;
+  uint32_t input_wake_us = 0u;
+  // InputDrv: clicks accumulated for handler, notification in the queue
+  int32_t pending_clicks = 0;
+  bool notify_pending = false;
+  // Application task: queue(true - encoder callback, false - timer) and time
+  // until task is busy
+  std::deque<bool> app_queue;
+  uint32_t app_busy_us = 0u;
+  // Screen: clicks to jog on the next tick, jog sent at the end of the tick
+  int32_t jog_clicks = 0;
+  bool jog_pending = false;
+  uint32_t jog_us = 0u;
+  // GrblComm: queued jog commands(clicks), pending response, status request
+  std::deque<int32_t> grbl_queue;
+  uint32_t grbl_retry_us = 0u;
+  bool respond_pending = false;
+  bool status_received = true;
+  uint32_t status_tx_us = 0u;
+  // UART from pendant to controller: busy until, bytes delivered at the end
+  uint32_t tx_busy_us = 0u;
+  bool tx_is_status = false;
+  int32_t tx_clicks = 0;
+  bool tx_active = false;
+  // UART from controller to pendant
+  uint32_t rx_busy_us = 0u;
+  std::deque<RxLine> rx_lines;
+  // Controller: queued motion and time of the previous status report
+  std::deque<Motion> motion;
+  uint32_t last_report_us = 0u;
+
+  for(uint32_t t = 0u; t < end_us; t++)
+  {
+    // Handwheel click: interrupt
+    if(t == next_click_us)
+    {
+      trace.Mark(JogTrace::CLICK, t);
+      isr_clicks++;
+      if(!input_wake)
+      {
+        input_wake = true;
+        input_wake_us = t + p.wake_us;
+      }
+      // Click period with +-25% jitter
+      next_click_us = t + click_period * 3u / 4u + Random(rnd) % (click_period / 2u + 1u);
+    }
+
+    // InputDrv task: lower priority than Application task, so it runs only
+    // when Application task is idle
+    if(input_wake && (t >= input_wake_us) && (t >= app_busy_us))
+    {
+      trace.Mark(JogTrace::INPUT, t);
+      pending_clicks += isr_clicks;
+      isr_clicks = 0;
+      input_wake = false;
+      // Only one notification in the queue
+      if(!notify_pending)
+      {
+        notify_pending = true;
+        app_queue.push_back(true);
+      }
+    }
+
+    // Application task timer
+    if((t % APP_TICK_US) == 0u) app_queue.push_back(false);
+    // Jog sent by screen at the end of the tick
+    if(jog_pending && (t >= jog_us))
+    {
+      trace.Mark(JogTrace::JOG, t);
+      grbl_queue.push_back(jog_clicks);
+      jog_clicks = 0;
+      jog_pending = false;
+    }
+    // Application task takes next message
+    if((t >= app_busy_us) && !app_queue.empty())
+    {
+      bool is_callback = app_queue.front();
+      app_queue.pop_front();
+      if(is_callback)
+      {
+        trace.Mark(JogTrace::HANDLER, t);
+        jog_clicks += pending_clicks;
+        pending_clicks = 0;
+        notify_pending = false;
+        app_busy_us = t + APP_CALLBACK_US;
+      }
+      else
+      {
+        app_busy_us = t + p.app_busy_us;
+        if(jog_clicks != 0)
+        {
+          jog_pending = true;
+          jog_us = app_busy_us;
+        }
+      }
+    }
+
+    // UART transfer to controller finished
+    if(tx_active && (t >= tx_busy_us))
+    {
+      tx_active = false;
+      if(tx_is_status)
+      {
+        // Status report: machine state at the time of request
+        RxLine line = {0u, true, false};
+        for(size_t i = 0u; i < motion.size(); i++)
+        {
+          if((motion[i].start_us < t) && (motion[i].end_us > last_report_us)) line.pos_changed = true;
+        }
+        last_report_us = t;
+        // Drop motion that is done
+        while(!motion.empty() && (motion.front().end_us <= t)) motion.pop_front();
+        rx_busy_us = ((rx_busy_us > t) ? rx_busy_us : t) + TransferUs(STATUS_LEN, p.baud);
+        line.time_us = rx_busy_us;
+        rx_lines.push_back(line);
+      }
+      else
+      {
+        // Jog command: planned motion starts after previous one. Its feed
+        // matches handwheel speed or, for short jogs, it is done faster and
+        // machine stops between clicks.
+        uint32_t start = t + p.plan_us + p.start_us;
+        if(!motion.empty() && (motion.back().end_us > start)) start = motion.back().end_us;
+        motion.push_back({start, start + (uint32_t)tx_clicks * ((p.jog_us != 0u) ? p.jog_us : click_period)});
+        RxLine line = {0u, false, false};
+        rx_busy_us = ((rx_busy_us > t + p.plan_us) ? rx_busy_us : t + p.plan_us) + TransferUs(OK_LEN, p.baud);
+        line.time_us = rx_busy_us;
+        rx_lines.push_back(line);
+      }
+    }
+
+    // GrblComm task timer: poll serial port and request status
+    if((t % GRBL_TICK_US) == 0u)
+    {
+      while(!rx_lines.empty() && (rx_lines.front().time_us <= t))
+      {
+        RxLine& line = rx_lines.front();
+        if(line.is_status)
+        {
+          status_received = true;
+          // Short jog can finish between reports: Idle with changed position
+          // is motion too, as in GrblComm
+          if(line.pos_changed) trace.Mark(JogTrace::MOTION, t);
+        }
+        else
+        {
+          respond_pending = false;
+          trace.Mark(JogTrace::ACK, t);
+        }
+        rx_lines.pop_front();
+      }
+      if(status_received && (t - status_tx_us > p.status_ms * 1000u) && !tx_active)
+      {
+        status_tx_us = t;
+        status_received = false;
+        tx_active = true;
+        tx_is_status = true;
+        tx_busy_us = t + TransferUs(1u, p.baud);
+      }
+    }
+
+    // GrblComm task message: jog is sent if UART is free and previous
+    // command answered, otherwise it is retried later
+    if(!grbl_queue.empty() && (t >= grbl_retry_us))
+    {
+      if(!tx_active && !respond_pending)
+      {
+        trace.Mark(JogTrace::UART_TX, t);
+        respond_pending = true;
+        tx_active = true;
+        tx_is_status = false;
+        tx_clicks = grbl_queue.front();
+        tx_busy_us = t + TransferUs(JOG_CMD_LEN, p.baud);
+        grbl_queue.pop_front();
+      }
+      else
+      {
+        grbl_retry_us = t + GRBL_RETRY_US;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Usage   ***************************************************************
+// *****************************************************************************
+static void Usage()
+{
+  printf("Usage: jog-latency-sim [options]\n");
+  printf("  -r clicks      handwheel clicks per second, default 20\n");
+  printf("  -t seconds     simulation time, default 30\n");
+  printf("  -b us          Application task time for one tick, default 3000\n");
+  printf("  -w us          interrupt to InputDrv task wake up time, default 20\n");
+  printf("  -p ms          status request period, default 100\n");
+  printf("  -u baud        UART baudrate, default 115200\n");
+  printf("  -c us          controller plan time, default 500\n");
+  printf("  -m us          controller plan to motion time, default 1000\n");
+  printf("  -j us          controller motion time for one click, 0 - click period, default 2000\n");
+  printf("  -s seed        random seed for click jitter, default 1\n");
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  Params p = {20u, 30u, 3000u, 20u, 100u, 115200u, 500u, 1000u, 2000u, 1u};
+
+  for(int i = 1; i < argc; i++)
+  {
+    uint32_t* val = nullptr;
+    if(strcmp(argv[i], "-r") == 0)      val = &p.click_rate;
+    else if(strcmp(argv[i], "-t") == 0) val = &p.time_s;
+    else if(strcmp(argv[i], "-b") == 0) val = &p.app_busy_us;
+    else if(strcmp(argv[i], "-w") == 0) val = &p.wake_us;
+    else if(strcmp(argv[i], "-p") == 0) val = &p.status_ms;
+    else if(strcmp(argv[i], "-u") == 0) val = &p.baud;
+    else if(strcmp(argv[i], "-c") == 0) val = &p.plan_us;
+    else if(strcmp(argv[i], "-m") == 0) val = &p.start_us;
+    else if(strcmp(argv[i], "-j") == 0) val = &p.jog_us;
+    else if(strcmp(argv[i], "-s") == 0) val = &p.seed;
+    else
+    {
+      ; // Do nothing - MISRA rule
+    }
+
+    if((val == nullptr) || (i + 1 >= argc))
+    {
+      Usage();
+      return 1;
+    }
+    *val = (uint32_t)strtoul(argv[++i], nullptr, 10);
+  }
+
+  if((p.click_rate == 0u) || (p.click_rate > 1000u) || (p.baud == 0u) || (p.app_busy_us >= APP_TICK_US))
+  {
+    printf("Clicks per second should be 1..1000, baudrate non zero and tick time less than %u us\n", APP_TICK_US);
+    return 1;
+  }
+
+  Simulate(p);
+
+  printf("%u clicks/s, %u s, tick %u us, wake %u us, status %u ms, %u baud, plan %u us, start %u us, jog %u us\n",
+         p.click_rate, p.time_s, p.app_busy_us, p.wake_us, p.status_ms, p.baud, p.plan_us, p.start_us, p.jog_us);
+  char buf[512u];
+  JogTrace::GetInstance().Report(buf, sizeof(buf));
+  printf("%s", buf);
+
+  return 0;
+}
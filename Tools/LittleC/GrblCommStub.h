@@ -0,0 +1,82 @@
+//******************************************************************************
+//  @file GrblCommStub.h
+//  @author Nicolai Shlapunov
+//
+//  @details GrblCommStub: GrblComm replacement for host build of Little-C
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef GrblCommStub_h
+#define GrblCommStub_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   GrblComm Class   ******************************************************
+// *****************************************************************************
+class GrblComm
+{
+  public:
+    // *************************************************************************
+    // ***   Axis Index Enum   *************************************************
+    // *************************************************************************
+    typedef enum
+    {
+       AXIS_X = 0,
+       AXIS_Y = 1,
+       AXIS_Z = 2,
+       AXIS_A = 3,
+       AXIS_B = 4,
+       AXIS_C = 5,
+       AXIS_CNT
+    } Axis_t;
+
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static GrblComm& GetInstance()
+    {
+      static GrblComm grbl_comm;
+      return grbl_comm;
+    }
+
+    // *************************************************************************
+    // ***   Public: GetAxisPosition function   ********************************
+    // *************************************************************************
+    int32_t GetAxisPosition(uint8_t axis) {return (axis < AXIS_CNT) ? axis_pos[axis] : 0;}
+
+    // *************************************************************************
+    // ***   Public: SetAxisPosition function   ********************************
+    // *************************************************************************
+    void SetAxisPosition(uint8_t axis, int32_t pos) {if(axis < AXIS_CNT) axis_pos[axis] = pos;}
+
+    // *************************************************************************
+    // ***   Public: IsLatheDiameterMode function   ****************************
+    // *************************************************************************
+    inline bool IsLatheDiameterMode() {return diameter_mode;}
+
+    // *************************************************************************
+    // ***   Public: SetLatheDiameterMode function   ***************************
+    // *************************************************************************
+    inline void SetLatheDiameterMode(bool mode) {diameter_mode = mode;}
+
+  private:
+    // Axis positions in um
+    int32_t axis_pos[AXIS_CNT] = {0};
+    // Lathe diameter mode
+    bool diameter_mode = false;
+};
+
+#endif
@@ -0,0 +1,488 @@
+//******************************************************************************
+//  @file LittleCRunner.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details LittleCRunner: host runner and benchmark for Little-C scripts
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "GrblCommStub.h"
+#include "Little-C.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+#define DEFAULT_OUTPUT_SIZE (64u * 1024u) // Approximate size available on the pendant
+#define DEFAULT_RUNS        5u            // Number of runs for each benchmark point
+#define TIME_THRESHOLD      10            // Execution time change in percent to report
+
+// *****************************************************************************
+// ***   Benchmark result   ****************************************************
+// *****************************************************************************
+struct BenchResult
+{
+  std::string script;  // script file name
+  std::string params;  // changed parameters
+  long time_us;        // best execution time
+  long size;           // output size in bytes
+  long lines;          // number of output lines
+  unsigned long hash;  // output hash to detect changes
+  bool ok;             // execution result
+};
+
+// *****************************************************************************
+// ***   Options   *************************************************************
+// *****************************************************************************
+static std::vector<std::string> overrides; // parameter overrides name=value
+static uint32_t output_size = DEFAULT_OUTPUT_SIZE;
+static uint32_t runs = DEFAULT_RUNS;
+
+// Interpreter is big, so it shouldn't be on the stack
+static LittleC interpreter;
+
+// *****************************************************************************
+// ***   Get time in microseconds   ********************************************
+// *****************************************************************************
+static long GetTimeUs()
+{
+  return (long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// *****************************************************************************
+// ***   Read file into the string   *******************************************
+// *****************************************************************************
+static bool ReadFile(const char* fn, std::vector<char>& buf)
+{
+  bool result = false;
+  FILE* f = fopen(fn, "rb");
+  if(f != nullptr)
+  {
+    fseek(f, 0, SEEK_END);
+    long fsize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    // Add one byte for null-terminator
+    buf.assign(fsize + 1, '\0');
+    result = (fread(buf.data(), 1u, fsize, f) == (size_t)fsize);
+    fclose(f);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get field from variable comment   *************************************
+// *****************************************************************************
+// Comment format is the same as GCodeGeneratorScr uses: description; scaler;
+// units; min value; max value or description; 0; first value; ...; last value
+static bool GetCommentField(int idx, int pos, std::string& str)
+{
+  const char* ptr = nullptr;
+  bool result = interpreter.GetGlobalVariableCommentPtr(idx, ptr);
+  // Find field start
+  for(int i = 0; result && (i < pos); i++)
+  {
+    while((*ptr != ';') && (*ptr != '\r') && (*ptr != '\n') && (*ptr != '\0')) ptr++;
+    if(*ptr == ';') ptr++;
+    else result = false;
+  }
+  if(result)
+  {
+    // Skip white spaces
+    while((*ptr == ' ') || (*ptr == '\t')) ptr++;
+    // Copy field
+    str.clear();
+    while((*ptr != ';') && (*ptr != '\r') && (*ptr != '\n') && (*ptr != '\0')) str += *ptr++;
+    // Remove trailing white spaces
+    while(!str.empty() && ((str.back() == ' ') || (str.back() == '\t'))) str.pop_back();
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get variable name   ***************************************************
+// *****************************************************************************
+static std::string GetName(int idx)
+{
+  char name[80u] = {0};
+  interpreter.GetGlobalVariableName(idx, name, sizeof(name));
+  return name;
+}
+
+// *****************************************************************************
+// ***   Reset all parameters and apply overrides   ****************************
+// *****************************************************************************
+static bool ApplyParams(const std::vector<std::string>& params)
+{
+  bool result = true;
+  // Reset parameters to values from the script
+  for(int i = 0; i < interpreter.GetGlobalVariablesCnt(); i++)
+  {
+    interpreter.ResetGlobalVariableValue(i);
+  }
+  // Apply overrides
+  for(const std::string& param : params)
+  {
+    size_t eq = param.find('=');
+    bool found = false;
+    for(int i = 0; (eq != std::string::npos) && (i < interpreter.GetGlobalVariablesCnt()); i++)
+    {
+      if(GetName(i) == param.substr(0u, eq))
+      {
+        interpreter.SetGlobalVariableValue(i, atoi(param.c_str() + eq + 1u));
+        found = true;
+        break;
+      }
+    }
+    if(!found)
+    {
+      fprintf(stderr, "Unknown parameter: %s\n", param.c_str());
+      result = false;
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Load script and prescan it   ******************************************
+// *****************************************************************************
+static bool LoadScript(const char* fn, std::vector<char>& pgm, std::vector<char>& out)
+{
+  bool result = ReadFile(fn, pgm);
+  if(result)
+  {
+    out.assign(output_size, '\0');
+    interpreter.SetPgmBuffer(pgm.data(), pgm.size());
+    interpreter.SetOutputBuf(out.data(), out.size());
+    result = interpreter.Prescan();
+    if(!result) fprintf(stderr, "%s: %s\n", fn, out.data());
+  }
+  else
+  {
+    fprintf(stderr, "Can't read %s\n", fn);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Run script once and fill benchmark result   ***************************
+// *****************************************************************************
+static void RunScript(std::vector<char>& out, BenchResult& res)
+{
+  interpreter.SetOutputBuf(out.data(), out.size());
+  long start = GetTimeUs();
+  res.ok = interpreter.Execute();
+  res.time_us = GetTimeUs() - start;
+  // Output statistics
+  res.size = strlen(out.data());
+  res.lines = std::count(out.data(), out.data() + res.size, '\n');
+  // FNV-1a hash
+  res.hash = 2166136261u;
+  for(long i = 0; i < res.size; i++) res.hash = ((res.hash ^ (uint8_t)out[i]) * 16777619u) & 0xFFFFFFFFu;
+}
+
+// *****************************************************************************
+// ***   Run single script and print result   **********************************
+// *****************************************************************************
+static int Run(const char* fn, bool list)
+{
+  std::vector<char> pgm;
+  std::vector<char> out;
+
+  long start = GetTimeUs();
+  bool result = LoadScript(fn, pgm, out);
+  long prescan_us = GetTimeUs() - start;
+
+  // Print parameters
+  if(result && list)
+  {
+    for(int i = 0; i < interpreter.GetGlobalVariablesCnt(); i++)
+    {
+      int val = 0;
+      std::string descr;
+      interpreter.GetGlobalVariableValue(i, val);
+      if(!GetCommentField(i, 0, descr)) descr.clear();
+      fprintf(stderr, "%s=%d\t%s\n", GetName(i).c_str(), val, descr.c_str());
+    }
+  }
+
+  if(result) result = ApplyParams(overrides);
+
+  if(result)
+  {
+    BenchResult res;
+    RunScript(out, res);
+    result = res.ok;
+    // G-code or error message
+    fputs(out.data(), result ? stdout : stderr);
+    if(!result) fputc('\n', stderr);
+    fprintf(stderr, "Prescan: %ld us, Execute: %ld us, Output: %ld bytes, %ld lines\n", prescan_us, res.time_us, res.size, res.lines);
+    fprintf(stderr, "Folded conditions: %d, eliminated branches: %d\n", interpreter.GetFoldedConditionsCnt(), interpreter.GetEliminatedBranchesCnt());
+  }
+
+  return result ? 0 : 1;
+}
+
+// *****************************************************************************
+// ***   Build parameters sweep   **********************************************
+// *****************************************************************************
+// First point uses default values. Then each parameter changes one at a time:
+// enum parameters go through all values, numerical parameters use half and
+// double of the default value within min/max range from the comment.
+static std::vector<std::vector<std::string>> BuildSweep()
+{
+  std::vector<std::vector<std::string>> sweep(1u);
+
+  for(int i = 0; i < interpreter.GetGlobalVariablesCnt(); i++)
+  {
+    int def = 0;
+    std::string str;
+    std::vector<int> values;
+    interpreter.GetGlobalVariableValue(i, def);
+    int scaler = GetCommentField(i, 1, str) ? atoi(str.c_str()) : 1;
+    if(scaler == 0)
+    {
+      // Enum: count values
+      int cnt = 0;
+      while(GetCommentField(i, 2 + cnt, str)) cnt++;
+      for(int v = 0; v < cnt; v++) values.push_back(v);
+    }
+    else
+    {
+      int min = GetCommentField(i, 3, str) ? atoi(str.c_str()) : -10000000;
+      int max = GetCommentField(i, 4, str) ? atoi(str.c_str()) :  10000000;
+      // Zero default: use 10 units
+      if(def == 0) values.push_back(scaler * 10);
+      else { values.push_back(def / 2); values.push_back(def * 2); }
+      for(int& v : values) v = std::min(std::max(v, min), max);
+    }
+    for(int v : values)
+    {
+      if(v != def) sweep.push_back({GetName(i) + "=" + std::to_string(v)});
+    }
+  }
+
+  return sweep;
+}
+
+// *****************************************************************************
+// ***   Load results of previous benchmark   **********************************
+// *****************************************************************************
+static std::map<std::string, BenchResult> LoadResults(const char* fn)
+{
+  std::map<std::string, BenchResult> results;
+  FILE* f = fopen(fn, "r");
+  if(f != nullptr)
+  {
+    char line[512u];
+    while(fgets(line, sizeof(line), f) != nullptr)
+    {
+      char script[128u], params[256u], status[16u];
+      BenchResult res;
+      if(sscanf(line, "%127[^,],%255[^,],%ld,%ld,%ld,%lx,%15s", script, params, &res.time_us, &res.size, &res.lines, &res.hash, status) == 7)
+      {
+        res.script = script;
+        res.params = params;
+        res.ok = (strcmp(status, "OK") == 0);
+        results[res.script + "," + res.params] = res;
+      }
+    }
+    fclose(f);
+  }
+  else
+  {
+    fprintf(stderr, "Can't read %s\n", fn);
+  }
+  return results;
+}
+
+// *****************************************************************************
+// ***   Run benchmark for all scripts in the directory   **********************
+// *****************************************************************************
+static int Benchmark(const char* dir_name, const char* save_fn, const char* compare_fn)
+{
+  int result = 0;
+  std::vector<std::string> files;
+  std::vector<BenchResult> results;
+
+  // Find all .ms and .ls scripts
+  DIR* dir = opendir(dir_name);
+  if(dir == nullptr)
+  {
+    fprintf(stderr, "Can't open %s\n", dir_name);
+    return 1;
+  }
+  for(struct dirent* de = readdir(dir); de != nullptr; de = readdir(dir))
+  {
+    std::string fn = de->d_name;
+    if((fn.size() > 3u) && ((fn.substr(fn.size() - 3u) == ".ms") || (fn.substr(fn.size() - 3u) == ".ls"))) files.push_back(fn);
+  }
+  closedir(dir);
+  std::sort(files.begin(), files.end());
+
+  std::map<std::string, BenchResult> baseline;
+  if(compare_fn != nullptr) baseline = LoadResults(compare_fn);
+
+  printf("%-20s %-32s %10s %8s %6s %s\n", "Script", "Parameters", "Time(us)", "Bytes", "Lines", "Status");
+  for(const std::string& fn : files)
+  {
+    std::vector<char> pgm;
+    std::vector<char> out;
+    std::string path = std::string(dir_name) + "/" + fn;
+    if(!LoadScript(path.c_str(), pgm, out))
+    {
+      result = 1;
+      continue;
+    }
+    for(const std::vector<std::string>& params : BuildSweep())
+    {
+      BenchResult best;
+      best.script = fn;
+      best.params = params.empty() ? "default" : params[0];
+      // Run several times and keep the best time
+      for(uint32_t r = 0u; r < runs; r++)
+      {
+        BenchResult res = best;
+        ApplyParams(params);
+        RunScript(out, res);
+        if((r == 0u) || (res.time_us < best.time_us)) best = res;
+      }
+      std::string status = best.ok ? "OK" : "ERROR";
+      // Compare with baseline
+      auto it = baseline.find(best.script + "," + best.params);
+      if(it != baseline.end())
+      {
+        const BenchResult& base = it->second;
+        if((base.hash != best.hash) || (base.ok != best.ok))
+        {
+          status += " OUTPUT CHANGED";
+          result = 1;
+        }
+        if((base.time_us > 0) && (labs(best.time_us - base.time_us) * 100 / base.time_us >= TIME_THRESHOLD))
+        {
+          status += " TIME " + std::to_string((best.time_us - base.time_us) * 100 / base.time_us) + "%";
+        }
+      }
+      printf("%-20s %-32s %10ld %8ld %6ld %s\n", best.script.c_str(), best.params.c_str(), best.time_us, best.size, best.lines, status.c_str());
+      results.push_back(best);
+    }
+  }
+
+  // Save results
+  if(save_fn != nullptr)
+  {
+    FILE* f = fopen(save_fn, "w");
+    if(f != nullptr)
+    {
+      for(const BenchResult& res : results)
+      {
+        fprintf(f, "%s,%s,%ld,%ld,%ld,%lx,%s\n", res.script.c_str(), res.params.c_str(), res.time_us, res.size, res.lines, res.hash, res.ok ? "OK" : "ERROR");
+      }
+      fclose(f);
+    }
+    else
+    {
+      fprintf(stderr, "Can't write %s\n", save_fn);
+      result = 1;
+    }
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Print usage   *********************************************************
+// *****************************************************************************
+static void Usage()
+{
+  fprintf(stderr,
+          "Usage: lcrun [options] script      Run script and print G-code\n"
+          "       lcrun -b [options] dir      Benchmark all .ms/.ls scripts in dir\n"
+          "Options:\n"
+          "  -D name=value  Set script parameter (raw value, e.g. um for mm)\n"
+          "  -x, -y, -z um  Axis position returned by GetAxisPosX/Y/Z()\n"
+          "  -d             Lathe diameter mode for IsLatheDiameterMode()\n"
+          "  -l             List script parameters\n"
+          "  -m bytes       Output buffer size, default %u\n"
+          "  -n runs        Benchmark runs for each point, default %u\n"
+          "  -s file        Save benchmark results\n"
+          "  -c file        Compare benchmark with saved results\n",
+          DEFAULT_OUTPUT_SIZE, DEFAULT_RUNS);
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  bool bench = false;
+  bool list = false;
+  const char* save_fn = nullptr;
+  const char* compare_fn = nullptr;
+  const char* fn = nullptr;
+  GrblComm& grbl_comm = GrblComm::GetInstance();
+
+  for(int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    // Options with value
+    if((arg.size() == 2u) && (arg[0] == '-') && strchr("Dxyzmnsc", arg[1]))
+    {
+      if(i + 1 >= argc)
+      {
+        Usage();
+        return 1;
+      }
+      const char* val = argv[++i];
+      switch(arg[1])
+      {
+        case 'D': overrides.push_back(val); break;
+        case 'x': grbl_comm.SetAxisPosition(GrblComm::AXIS_X, atoi(val)); break;
+        case 'y': grbl_comm.SetAxisPosition(GrblComm::AXIS_Y, atoi(val)); break;
+        case 'z': grbl_comm.SetAxisPosition(GrblComm::AXIS_Z, atoi(val)); break;
+        case 'm': output_size = strtoul(val, nullptr, 0); break;
+        case 'n': runs = std::max(1ul, strtoul(val, nullptr, 0)); break;
+        case 's': save_fn = val; break;
+        case 'c': compare_fn = val; break;
+      }
+    }
+    else if(arg == "-b") bench = true;
+    else if(arg == "-d") grbl_comm.SetLatheDiameterMode(true);
+    else if(arg == "-l") list = true;
+    else if((arg[0] != '-') && (fn == nullptr)) fn = argv[i];
+    else
+    {
+      Usage();
+      return 1;
+    }
+  }
+
+  if(fn == nullptr)
+  {
+    Usage();
+    return 1;
+  }
+
+  return bench ? Benchmark(fn, save_fn, compare_fn) : Run(fn, list);
+}
@@ -0,0 +1,27 @@
+//******************************************************************************
+//  @file DevCfg.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: device configuration replacement for host rendering of
+//           the UI objects
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef DevCfg_h
+#define DevCfg_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+
+#endif
@@ -0,0 +1,516 @@
+//******************************************************************************
+//  @file DevCore.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: minimal DevCore replacement for host rendering of the UI
+//           objects, implementation
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCore.h"
+
+#include <algorithm>
+#include <cmath>
+
+// *****************************************************************************
+// ***   Data   ****************************************************************
+// *****************************************************************************
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+uint32_t SystemCoreClock = 100000000u;
+
+// Palette 8-8-4: 3 bits of red, 3 bits of green and 2 bits of blue
+static struct Palette884
+{
+  color_t data[256];
+  Palette884()
+  {
+    for(uint32_t i = 0u; i < 256u; i++)
+    {
+      uint32_t r = (i >> 5) & 0x07u;
+      uint32_t g = (i >> 2) & 0x07u;
+      uint32_t b = i & 0x03u;
+      data[i] = (color_t)(((r * 31u / 7u) << 11) | ((g * 63u / 7u) << 5) | (b * 31u / 3u));
+    }
+  }
+} palette_884;
+const color_t* const PALETTE_884 = palette_884.data;
+
+// *****************************************************************************
+// ***   Font: synthetic glyphs   **********************************************
+// *****************************************************************************
+Font::Font(uint32_t cw, uint32_t ch) : w(cw), h(ch), data(256u * ch, 0u)
+{
+  static const uint8_t seg[10u] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+  uint16_t left = 1u << (w - 2u);
+  uint16_t right = 1u << 1u;
+  uint16_t hor = (uint16_t)(((1u << (w - 2u)) - 1u) & ~1u);
+  uint32_t mid = h / 2u;
+  for(uint32_t c = 0u; c < 256u; c++)
+  {
+    uint16_t* g = &data[c * h];
+    if((c >= '0') && (c <= '9'))
+    {
+      uint8_t s = seg[c - '0'];
+      if(s & 0x01) g[1] |= hor;
+      if(s & 0x02) for(uint32_t i = 1u; i < mid; i++) g[i] |= right;
+      if(s & 0x04) for(uint32_t i = mid; i < h - 2u; i++) g[i] |= right;
+      if(s & 0x08) g[h - 2u] |= hor;
+      if(s & 0x10) for(uint32_t i = mid; i < h - 2u; i++) g[i] |= left;
+      if(s & 0x20) for(uint32_t i = 1u; i < mid; i++) g[i] |= left;
+      if(s & 0x40) g[mid] |= hor;
+    }
+    else if(c == '-')
+    {
+      g[mid] = hor;
+    }
+    else if(c == '.')
+    {
+      g[h - 2u] = 0x03u << (w / 2u - 1u);
+    }
+    else if((c > ' ') && (c < 0x7F))
+    {
+      // Pseudo random pattern inside character cell
+      uint32_t x = c * 2654435761u;
+      for(uint32_t i = 1u; i < h - 1u; i++)
+      {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        g[i] = (uint16_t)(x & hor);
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Font: glyphs from the firmware   **************************************
+// *****************************************************************************
+void Font::SetGlyphs(const uint8_t* glyphs)
+{
+  uint32_t line_bytes = (w + 7u) / 8u;
+  for(uint32_t i = 0u; i < 256u * h; i++)
+  {
+    uint32_t bits = 0u;
+    for(uint32_t b = 0u; b < line_bytes; b++) bits |= (uint32_t)glyphs[i * line_bytes + b] << (b * 8u);
+    // Mirror line: leftmost pixel is bit 0 in DevCore and MSB of w bits here
+    uint16_t line = 0u;
+    for(uint32_t x = 0u; x < w; x++) if(bits & (1u << x)) line |= 1u << (w - 1u - x);
+    data[i] = line;
+  }
+}
+
+// Read Intel HEX file into flash image starting from FLASH_BASE
+static bool ReadHex(const char* fn, std::vector<uint8_t>& flash)
+{
+  static const uint32_t FLASH_BASE = 0x08000000u;
+  bool result = false;
+  FILE* f = fopen(fn, "r");
+  if(f != nullptr)
+  {
+    char str[600];
+    uint32_t base = 0u;
+    while(fgets(str, sizeof(str), f) != nullptr)
+    {
+      uint8_t rec[256u + 5u];
+      uint32_t len = 0u;
+      for(const char* p = str + 1; (str[0] == ':') && (len < sizeof(rec)) && (sscanf(p, "%2hhx", &rec[len]) == 1); p += 2) len++;
+      if((len < 5u) || (len != rec[0] + 5u)) continue;
+      uint32_t addr = base + (rec[1] << 8) + rec[2];
+      if(rec[3] == 0x00u) // Data
+      {
+        if((addr >= FLASH_BASE) && (addr - FLASH_BASE + rec[0] <= 0x00100000u))
+        {
+          if(flash.size() < addr - FLASH_BASE + rec[0]) flash.resize(addr - FLASH_BASE + rec[0], 0xFFu);
+          memcpy(&flash[addr - FLASH_BASE], &rec[4], rec[0]);
+        }
+      }
+      else if(rec[3] == 0x01u) // End of file
+      {
+        result = !flash.empty();
+        break;
+      }
+      else if(rec[3] == 0x02u) // Extended segment address
+      {
+        base = ((rec[4] << 8) + rec[5]) << 4;
+      }
+      else if(rec[3] == 0x04u) // Extended linear address
+      {
+        base = ((rec[4] << 8) + rec[5]) << 16;
+      }
+      else
+      {
+        ; // Do nothing - MISRA rule
+      }
+    }
+    fclose(f);
+  }
+  return result;
+}
+
+// DevCore font object keeps dimensions word (w | h << 8 | bytes per
+// char << 16) followed by pointer to glyphs. Constructors of fonts store both
+// in literal pools, so glyphs are found by dimensions.
+static bool FindGlyphs(const std::vector<uint8_t>& flash, Font& font)
+{
+  static const uint32_t FLASH_BASE = 0x08000000u;
+  bool result = false;
+  uint32_t bytes_per_char = (font.GetCharW() + 7u) / 8u * font.GetCharH();
+  uint32_t dims = font.GetCharW() | (font.GetCharH() << 8) | (bytes_per_char << 16);
+  for(size_t i = 0u; (i + 8u <= flash.size()) && !result; i += 4u)
+  {
+    uint32_t word;
+    uint32_t ptr;
+    memcpy(&word, &flash[i], sizeof(word));
+    memcpy(&ptr, &flash[i + 4u], sizeof(ptr));
+    if((word == dims) && (ptr >= FLASH_BASE) && (ptr - FLASH_BASE + 256u * bytes_per_char <= flash.size()))
+    {
+      font.SetGlyphs(&flash[ptr - FLASH_BASE]);
+      result = true;
+    }
+  }
+  return result;
+}
+
+bool LoadFirmwareFonts(const char* fn)
+{
+  std::vector<uint8_t> flash;
+  bool result = ReadHex(fn, flash);
+  if(result)
+  {
+    result &= FindGlyphs(flash, Font_6x8::GetInstance());
+    result &= FindGlyphs(flash, Font_8x8::GetInstance());
+    result &= FindGlyphs(flash, Font_8x12::GetInstance());
+    result &= FindGlyphs(flash, Font_10x18::GetInstance());
+    result &= FindGlyphs(flash, Font_12x16::GetInstance());
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Lists of objects sorted by Z   ****************************************
+// *****************************************************************************
+static void AddSorted(std::vector<VisObject*>& list, VisObject* obj)
+{
+  // Objects with the same Z drawn in order of adding
+  auto it = std::upper_bound(list.begin(), list.end(), obj, [](VisObject* a, VisObject* b) {return a->GetZ() < b->GetZ();});
+  list.insert(it, obj);
+}
+
+static void Remove(std::vector<VisObject*>& list, VisObject* obj)
+{
+  list.erase(std::remove(list.begin(), list.end(), obj), list.end());
+}
+
+// *****************************************************************************
+// ***   VisObject   ***********************************************************
+// *****************************************************************************
+Result VisObject::Show(uint32_t z_pos)
+{
+  if(is_show) Hide();
+  z = z_pos;
+  is_show = true;
+  if(p_list != nullptr) p_list->AddVisObjectToList(this);
+  else                  DisplayDrv::GetInstance().AddVisObjectToList(this);
+  InvalidateObjArea();
+  return Result::RESULT_OK;
+}
+
+Result VisObject::Hide()
+{
+  if(is_show)
+  {
+    if(p_list != nullptr) p_list->DelVisObjectFromList(this);
+    else                  DisplayDrv::GetInstance().DelVisObjectFromList(this);
+    is_show = false;
+    InvalidateObjArea();
+  }
+  return Result::RESULT_OK;
+}
+
+void VisObject::InvalidateObjArea(bool force)
+{
+  // Coordinates of objects in the list are relative to it
+  int32_t x = 0;
+  int32_t y = 0;
+  for(VisList* list = p_list; list != nullptr; list = list->p_list)
+  {
+    x += list->x_start;
+    y += list->y_start;
+  }
+  DisplayDrv::GetInstance().InvalidateArea(x + x_start, y + y_start, x + x_end, y + y_end);
+}
+
+void VisObject::DrawPixelsW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  if((line >= y_start) && (line <= y_end))
+  {
+    for(int32_t x = 0; x < width; x++)
+    {
+      int32_t pos = x_start + x - start_x;
+      if((pos >= 0) && (pos < n))
+      {
+        color_t c = buf[pos];
+        if(GetPixel(x, line - y_start, c)) buf[pos] = c;
+      }
+    }
+  }
+}
+
+void VisObject::DrawPixelsH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  if((row >= x_start) && (row <= x_end))
+  {
+    for(int32_t y = 0; y < height; y++)
+    {
+      int32_t pos = y_start + y - start_y;
+      if((pos >= 0) && (pos < n))
+      {
+        color_t c = buf[pos];
+        if(GetPixel(row - x_start, y, c)) buf[pos] = c;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   VisList   *************************************************************
+// *****************************************************************************
+void VisList::AddVisObjectToList(VisObject* obj)
+{
+  AddSorted(list, obj);
+}
+
+void VisList::DelVisObjectFromList(VisObject* obj)
+{
+  Remove(list, obj);
+}
+
+void VisList::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Part of the buffer inside the list
+  int32_t xs = std::max(x_start, start_x);
+  int32_t xe = std::min(x_end, start_x + n - 1);
+  if((line >= y_start) && (line <= y_end) && (xe >= xs))
+  {
+    for(VisObject* obj : list) obj->DrawInBufW(buf + xs - start_x, xe - xs + 1, line - y_start, xs - x_start);
+  }
+}
+
+void VisList::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Part of the buffer inside the list
+  int32_t ys = std::max(y_start, start_y);
+  int32_t ye = std::min(y_end, start_y + n - 1);
+  if((row >= x_start) && (row <= x_end) && (ye >= ys))
+  {
+    for(VisObject* obj : list) obj->DrawInBufH(buf + ys - start_y, ye - ys + 1, row - x_start, ys - y_start);
+  }
+}
+
+// *****************************************************************************
+// ***   String   **************************************************************
+// *****************************************************************************
+bool String::GetPixel(int32_t x, int32_t y, color_t& c)
+{
+  // The same way as DevCore draws scaled strings
+  int32_t char_w = font->GetCharW() * scale;
+  uint32_t fx = (x % char_w) / scale;
+  bool result = font->GetCharLine((uint8_t)str[x / char_w], y / scale) & (1u << (font->GetCharW() - 1u - fx));
+  if(result) c = color;
+  return result;
+}
+
+// *****************************************************************************
+// ***   Box   *****************************************************************
+// *****************************************************************************
+bool Box::GetPixel(int32_t x, int32_t y, color_t& c)
+{
+  bool result = true;
+  // Border
+  if((x < border_width) || (y < border_width) || (x >= width - border_width) || (y >= height - border_width))
+  {
+    c = color;
+  }
+  else if(fill) // Inside
+  {
+    c = (border_width == 0u) ? color : bg_color;
+  }
+  else
+  {
+    result = false;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Line   ****************************************************************
+// *****************************************************************************
+void Line::SetParams(int32_t xs, int32_t ys, int32_t xe, int32_t ye, color_t c)
+{
+  x_start = std::min(xs, xe);
+  y_start = std::min(ys, ye);
+  x_end = std::max(xs, xe);
+  y_end = std::max(ys, ye);
+  width = x_end - x_start + 1;
+  height = y_end - y_start + 1;
+  x0 = xs - x_start;
+  y0 = ys - y_start;
+  x1 = xe - x_start;
+  y1 = ye - y_start;
+  color = c;
+}
+
+bool Line::GetPixel(int32_t x, int32_t y, color_t& c)
+{
+  bool result = false;
+  // One pixel on every step along the longest side
+  if(width >= height)
+  {
+    result = (width == 1) ? (y == y0) : (y == y0 + (int32_t)lround((double)(x - x0) * (y1 - y0) / (x1 - x0)));
+  }
+  else
+  {
+    result = (x == x0 + (int32_t)lround((double)(y - y0) * (x1 - x0) / (y1 - y0)));
+  }
+  if(result) c = color;
+  return result;
+}
+
+// *****************************************************************************
+// ***   Image   ***************************************************************
+// *****************************************************************************
+bool Image::GetPixel(int32_t x, int32_t y, color_t& c)
+{
+  bool result = false;
+  if(img != nullptr)
+  {
+    int32_t val = (img->bits_per_pixel == 8u) ? img->img8[y * width + x] : img->img16[y * width + x];
+    if(val != img->transparent_color)
+    {
+      c = (img->bits_per_pixel == 8u) ? img->palette[val] : (color_t)val;
+      result = true;
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   UiButton   ************************************************************
+// *****************************************************************************
+bool UiButton::GetPixel(int32_t x, int32_t y, color_t& c)
+{
+  // Text in the center of the button
+  int32_t tx = x - (width - (int32_t)(strlen(str) * font->GetCharW())) / 2;
+  int32_t ty = y - (height - (int32_t)font->GetCharH()) / 2;
+  // Border
+  if((x == 0) || (y == 0) || (x == width - 1) || (y == height - 1))
+  {
+    c = COLOR_WHITE;
+  }
+  else if((tx >= 0) && (tx < (int32_t)(strlen(str) * font->GetCharW())) && (ty >= 0) && (ty < (int32_t)font->GetCharH()) &&
+          (font->GetCharLine((uint8_t)str[tx / font->GetCharW()], ty) & (1u << (font->GetCharW() - 1u - tx % font->GetCharW()))))
+  {
+    c = pressed ? COLOR_BLACK : COLOR_WHITE;
+  }
+  else
+  {
+    c = pressed ? COLOR_WHITE : COLOR_GREY;
+  }
+  return true;
+}
+
+// *****************************************************************************
+// ***   DisplayDrv   **********************************************************
+// *****************************************************************************
+void DisplayDrv::AddVisObjectToList(VisObject* obj)
+{
+  AddSorted(list, obj);
+}
+
+void DisplayDrv::DelVisObjectFromList(VisObject* obj)
+{
+  Remove(list, obj);
+}
+
+void DisplayDrv::InvalidateArea(int32_t xs, int32_t ys, int32_t xe, int32_t ye)
+{
+  // Clip area by screen
+  if(xs < 0) xs = 0;
+  if(ys < 0) ys = 0;
+  if(xe >= width) xe = width - 1;
+  if(ye >= height) ye = height - 1;
+  if((xe >= xs) && (ye >= ys))
+  {
+    // Empty update area is replaced, otherwise it grows to cover new one
+    if((area.xe < area.xs) || (area.ye < area.ys))
+    {
+      area = {xs, ys, xe, ye};
+    }
+    else
+    {
+      if(xs < area.xs) area.xs = xs;
+      if(ys < area.ys) area.ys = ys;
+      if(xe > area.xe) area.xe = xe;
+      if(ye > area.ye) area.ye = ye;
+    }
+  }
+}
+
+void DisplayDrv::DrawArea(const Area& a)
+{
+  std::vector<color_t> buf(a.xe - a.xs + 1);
+  for(int32_t y = a.ys; y <= a.ye; y++)
+  {
+    std::fill(buf.begin(), buf.end(), bg_color);
+    for(VisObject* obj : list) obj->DrawInBufW(buf.data(), (int32_t)buf.size(), y, a.xs);
+    std::copy(buf.begin(), buf.end(), fb.begin() + y * width + a.xs);
+  }
+}
+
+uint32_t DisplayDrv::UpdateDisplay()
+{
+  uint32_t pixels = 0u;
+  if((area.xe >= area.xs) && (area.ye >= area.ys))
+  {
+    DrawArea(area);
+    pixels = (area.xe - area.xs + 1) * (area.ye - area.ys + 1);
+  }
+  area = {0, 0, -1, -1};
+  return pixels;
+}
+
+void DisplayDrv::RenderFrame(bool vertical)
+{
+  if(vertical)
+  {
+    std::vector<color_t> buf(height);
+    for(int32_t x = 0; x < width; x++)
+    {
+      std::fill(buf.begin(), buf.end(), bg_color);
+      for(VisObject* obj : list) obj->DrawInBufH(buf.data(), height, x, 0);
+      for(int32_t y = 0; y < height; y++) fb[y * width + x] = buf[y];
+    }
+  }
+  else
+  {
+    DrawArea({0, 0, width - 1, height - 1});
+  }
+}
+
+void DisplayDrv::Clear()
+{
+  list.clear();
+  area = {0, 0, -1, -1};
+  std::fill(fb.begin(), fb.end(), bg_color);
+}
@@ -0,0 +1,594 @@
+//******************************************************************************
+//  @file DevCore.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: minimal DevCore replacement for host rendering of the UI
+//           objects. It provides VisObject, String, Box, fonts and display
+//           driver that composes frames in memory instead of sending them to
+//           the LCD. Glyphs of fonts are loaded from the firmware HEX file,
+//           so text looks exactly as on the device. Until they loaded, fonts
+//           are synthetic: digits are seven segment glyphs and other
+//           characters are pseudo random patterns. Buttons are drawn as
+//           boxes with centered text and don't look exactly as on the device.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef DevCore_h
+#define DevCore_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <vector>
+
+// *****************************************************************************
+// ***   Types and helpers   ***************************************************
+// *****************************************************************************
+typedef uint16_t color_t;
+
+// RGB565 colors
+#define COLOR_BLACK   0x0000u
+#define COLOR_BLUE    0x001Fu
+#define COLOR_RED     0xF800u
+#define COLOR_GREEN   0x07E0u
+#define COLOR_CYAN    0x07FFu
+#define COLOR_MAGENTA 0xF81Fu
+#define COLOR_YELLOW  0xFFE0u
+#define COLOR_GREY    0x7BEFu
+#define COLOR_DARKGREY 0x39E7u
+#define COLOR_WHITE   0xFFFFu
+
+#define NumberOf(x) (sizeof(x) / sizeof((x)[0]))
+
+class Result
+{
+  public:
+    enum ResultCode
+    {
+      RESULT_OK = 0,
+      ERR_NULL_PTR,
+      ERR_BAD_PARAMETER,
+      ERR_INVALID_ITEM,
+      ERR_CANNOT_EXECUTE
+    };
+
+    Result(ResultCode r = RESULT_OK) : result(r) {}
+    bool IsGood() const {return result == RESULT_OK;}
+    bool IsBad() const {return result != RESULT_OK;}
+    bool operator==(const Result& r) const {return result == r.result;}
+    bool operator!=(const Result& r) const {return result != r.result;}
+
+  private:
+    ResultCode result;
+};
+
+// Palette 8-8-4
+extern const color_t* const PALETTE_884;
+
+// *****************************************************************************
+// ***   Cortex-M debug registers used for frame time measurement   ************
+// *****************************************************************************
+typedef struct {uint32_t CTRL; uint32_t CYCCNT;} DWT_Type;
+typedef struct {uint32_t DEMCR;} CoreDebug_Type;
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_core_debug;
+extern uint32_t SystemCoreClock;
+#define DWT (&host_dwt)
+#define CoreDebug (&host_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk 1u
+#define CoreDebug_DEMCR_TRCENA_Msk (1u << 24)
+#define __DMB() __sync_synchronize()
+
+// *****************************************************************************
+// ***   HAL types and pins used by the input driver   *************************
+// *****************************************************************************
+typedef struct {uint32_t CNT;} TIM_TypeDef;
+typedef struct {TIM_TypeDef* Instance;} TIM_HandleTypeDef;
+typedef struct {uint32_t IDR;} GPIO_TypeDef;
+typedef enum {GPIO_PIN_RESET = 0, GPIO_PIN_SET} GPIO_PinState;
+
+#define BTN_LEFT_GPIO_Port  nullptr
+#define BTN_LEFT_Pin        0x0002u
+#define BTN_RIGHT_GPIO_Port nullptr
+#define BTN_RIGHT_Pin       0x0004u
+#define BTN_LU_GPIO_Port    nullptr
+#define BTN_LU_Pin          0x0008u
+#define BTN_LD_GPIO_Port    nullptr
+#define BTN_LD_Pin          0x0010u
+#define BTN_RU_GPIO_Port    nullptr
+#define BTN_RU_Pin          0x0020u
+#define BTN_RD_GPIO_Port    nullptr
+#define BTN_RD_Pin          0x0040u
+#define BTN_USR_GPIO_Port   nullptr
+#define BTN_USR_Pin         0x0001u
+
+#define INPUT_DRV_TASK_STACK_SIZE   256u
+#define INPUT_DRV_TASK_PRIORITY     3u
+#define APPLICATION_TASK_STACK_SIZE 1024u
+#define APPLICATION_TASK_PRIORITY   2u
+
+// *****************************************************************************
+// ***   RtosTick Class   ******************************************************
+// *****************************************************************************
+// Time doesn't go on the host, so frames don't depend on the run
+class RtosTick
+{
+  public:
+    static uint32_t GetTimeMs() {return 0u;}
+    static uint32_t GetTickCount() {return 0u;}
+    static void DelayMs(uint32_t ms) {}
+    static void DelayTicks(uint32_t ticks) {}
+    static void DelayUntilMs(uint32_t& last_wake_ticks, uint32_t ms) {}
+};
+
+// *****************************************************************************
+// ***   SoundDrv Class   ******************************************************
+// *****************************************************************************
+class SoundDrv
+{
+  public:
+    static SoundDrv& GetInstance() {static SoundDrv sound_drv; return sound_drv;}
+    void PlaySound(const uint16_t* melody, uint16_t size, uint16_t temp_ms = 100u, bool rep = false) {}
+};
+
+// *****************************************************************************
+// ***   RtosMutex Class   *****************************************************
+// *****************************************************************************
+class RtosMutex
+{
+  public:
+    Result Lock() {return Result::RESULT_OK;}
+    Result Release() {return Result::RESULT_OK;}
+};
+
+// *****************************************************************************
+// ***   AppTask Class   *******************************************************
+// *****************************************************************************
+typedef Result (*CallbackPtr)(void* obj_ptr, void* param_ptr);
+
+class AppTask
+{
+  public:
+    virtual ~AppTask() {};
+    static AppTask* GetCurrent() {return nullptr;}
+    Result Callback(CallbackPtr func, void* param, void* obj) {return (func != nullptr) ? func(obj, param) : Result::RESULT_OK;}
+
+  protected:
+    AppTask(uint16_t stack_size, uint8_t priority, const char* name) {};
+};
+
+// *****************************************************************************
+// ***   Font Class   **********************************************************
+// *****************************************************************************
+class Font
+{
+  public:
+    uint32_t GetCharW() {return w;}
+    uint32_t GetCharH() {return h;}
+    // Glyph line, MSB of w bits is the leftmost pixel
+    uint16_t GetCharLine(uint8_t c, uint32_t line) {return data[c * h + line];}
+    // Set glyphs of 256 characters in DevCore format: every line is
+    // (w + 7) / 8 bytes little endian, bit 0 is the leftmost pixel
+    void SetGlyphs(const uint8_t* glyphs);
+
+  protected:
+    Font(uint32_t cw, uint32_t ch);
+
+  private:
+    uint32_t w;
+    uint32_t h;
+    std::vector<uint16_t> data;
+};
+
+#define HOST_FONT(name, cw, ch)                                            \
+class name : public Font                                                   \
+{                                                                          \
+  public:                                                                  \
+    static name& GetInstance() {static name font; return font;}            \
+  private:                                                                 \
+    name() : Font(cw, ch) {}                                               \
+};
+
+HOST_FONT(Font_4x6, 4u, 6u)
+HOST_FONT(Font_6x8, 6u, 8u)
+HOST_FONT(Font_8x8, 8u, 8u)
+HOST_FONT(Font_8x12, 8u, 12u)
+HOST_FONT(Font_10x18, 10u, 18u)
+HOST_FONT(Font_12x16, 12u, 16u)
+
+// Load glyphs of fonts from the firmware Intel HEX file. Returns false if file
+// can't be read or any of fonts isn't found. Font_4x6 isn't linked into the
+// firmware and always keeps synthetic glyphs.
+bool LoadFirmwareFonts(const char* fn);
+
+class VisList;
+
+// *****************************************************************************
+// ***   VisObject Class   *****************************************************
+// *****************************************************************************
+class VisObject
+{
+  public:
+    enum ActionType
+    {
+      ACT_TOUCH,
+      ACT_UNTOUCH,
+      ACT_MOVEIN,
+      ACT_MOVEOUT,
+      ACT_HOLD,
+      ACT_MAX
+    };
+
+    virtual ~VisObject() {};
+
+    Result Show(uint32_t z);
+    Result Hide();
+    bool IsShow() {return is_show;}
+    bool IsInList() {return is_show;}
+    uint32_t GetZ() {return z;}
+    void SetActive(bool is_active) {active = is_active;}
+    // Objects in the list have coordinates relative to it
+    void SetList(VisList& list) {p_list = &list;}
+
+    // Shown object invalidates old and new areas
+    void Move(int32_t x, int32_t y, bool is_delta = false)
+    {
+      if(is_show) InvalidateObjArea();
+      if(is_delta) {x += x_start; y += y_start;}
+      x_start = x;
+      y_start = y;
+      x_end = x + width - 1;
+      y_end = y + height - 1;
+      if(is_show) InvalidateObjArea();
+    }
+
+    int32_t GetStartX() {return x_start;}
+    int32_t GetStartY() {return y_start;}
+    int32_t GetEndX() {return x_end;}
+    int32_t GetEndY() {return y_end;}
+    int32_t GetWidth() {return width;}
+    int32_t GetHeight() {return height;}
+
+    virtual void InvalidateObjArea(bool force = false);
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) = 0;
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) = 0;
+    virtual void Action(ActionType action, int32_t tx, int32_t ty, int32_t tpx, int32_t tpy) {};
+
+  protected:
+    int32_t x_start = 0;
+    int32_t y_start = 0;
+    int32_t x_end = 0;
+    int32_t y_end = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+    bool is_show = false;
+    bool active = false;
+    uint32_t z = 0u;
+    VisList* p_list = nullptr;
+
+    // Object pixel at x, y from the object start. On call c is the color
+    // under the object. Returns false if pixel is transparent.
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c) {return false;}
+    // Draw object pixel by pixel using GetPixel()
+    void DrawPixelsW(color_t* buf, int32_t n, int32_t line, int32_t start_x);
+    void DrawPixelsH(color_t* buf, int32_t n, int32_t row, int32_t start_y);
+};
+
+// *****************************************************************************
+// ***   VisList Class   *******************************************************
+// *****************************************************************************
+// Objects in the list are drawn in Z order and clipped by the list area
+class VisList : public VisObject
+{
+  public:
+    void SetParams(int32_t x, int32_t y, int32_t w, int32_t h)
+    {
+      x_start = x; y_start = y; width = w; height = h;
+      x_end = x + w - 1; y_end = y + h - 1;
+    }
+
+    void AddVisObjectToList(VisObject* obj);
+    void DelVisObjectFromList(VisObject* obj);
+
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0);
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0);
+
+  private:
+    std::vector<VisObject*> list;
+};
+
+// *****************************************************************************
+// ***   String Class   ********************************************************
+// *****************************************************************************
+class String : public VisObject
+{
+  public:
+    String() {}
+    String(const char* s, int32_t x, int32_t y, color_t c, Font& f) {SetParams(s, x, y, c, f);}
+    void SetParams(const char* s, int32_t x, int32_t y, color_t c, Font& f)
+    {
+      str = s; color = c; font = &f; x_start = x; y_start = y; UpdateSize();
+    }
+    void SetFont(Font& f) {font = &f; UpdateSize();}
+    void SetScale(uint32_t s) {scale = s; UpdateSize();}
+    uint32_t GetScale() {return scale;}
+    int32_t GetFontW() {return font->GetCharW();}
+    int32_t GetFontH() {return font->GetCharH();}
+    const char* GetString() {return str;}
+    void SetString(const char* s) {if(is_show) InvalidateObjArea(); str = s; UpdateSize(); if(is_show) InvalidateObjArea();}
+    void SetStringPtr(const char* s) {str = s; UpdateSize();}
+    void SetString(char* buf, uint32_t n, const char* fmt, ...)
+    {
+      if(is_show) InvalidateObjArea();
+      va_list args;
+      va_start(args, fmt);
+      vsnprintf(buf, n, fmt, args);
+      va_end(args);
+      str = buf;
+      UpdateSize();
+      if(is_show) InvalidateObjArea();
+    }
+
+    // String buffer can be changed without SetString(), as TextBox does, so
+    // size is updated before drawing
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) {UpdateSize(); DrawPixelsW(buf, n, line, start_x);}
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) {UpdateSize(); DrawPixelsH(buf, n, row, start_y);}
+
+  protected:
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c);
+
+  private:
+    const char* str = "";
+    color_t color = COLOR_WHITE;
+    Font* font = &Font_8x12::GetInstance();
+    uint32_t scale = 1u;
+
+    void UpdateSize()
+    {
+      width = strlen(str) * font->GetCharW() * scale;
+      height = font->GetCharH() * scale;
+      x_end = x_start + width - 1;
+      y_end = y_start + height - 1;
+    }
+};
+
+// *****************************************************************************
+// ***   Box Class   ***********************************************************
+// *****************************************************************************
+class Box : public VisObject
+{
+  public:
+    // Shown box invalidates old and new areas
+    void SetParams(int32_t x, int32_t y, int32_t w, int32_t h, color_t c, bool is_fill = false)
+    {
+      if(is_show) InvalidateObjArea();
+      x_start = x; y_start = y; width = w; height = h; color = c; fill = is_fill;
+      x_end = x + w - 1; y_end = y + h - 1;
+      if(is_show) InvalidateObjArea();
+    }
+    void SetColor(color_t c) {color = c; if(is_show) InvalidateObjArea();}
+    color_t GetColor() {return color;}
+    void SetBackgroundColor(color_t c) {bg_color = c;}
+    void SetBorderWidth(uint16_t w) {border_width = w;}
+    uint16_t GetBorderWidth() {return border_width;}
+
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) {DrawPixelsW(buf, n, line, start_x);}
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) {DrawPixelsH(buf, n, row, start_y);}
+
+  protected:
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c);
+
+  private:
+    color_t color = COLOR_BLACK;
+    color_t bg_color = COLOR_BLACK;
+    bool fill = false;
+    uint16_t border_width = 0u;
+};
+
+// *****************************************************************************
+// ***   ShadowBox Class   *****************************************************
+// *****************************************************************************
+// Makes everything under it two times darker
+class ShadowBox : public VisObject
+{
+  public:
+    void SetParams(int32_t x, int32_t y, int32_t w, int32_t h)
+    {
+      x_start = x; y_start = y; width = w; height = h;
+      x_end = x + w - 1; y_end = y + h - 1;
+    }
+
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) {DrawPixelsW(buf, n, line, start_x);}
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) {DrawPixelsH(buf, n, row, start_y);}
+
+  protected:
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c) {c = (c >> 1) & 0x7BEFu; return true;}
+};
+
+// *****************************************************************************
+// ***   Line Class   **********************************************************
+// *****************************************************************************
+class Line : public VisObject
+{
+  public:
+    void SetParams(int32_t xs, int32_t ys, int32_t xe, int32_t ye, color_t c);
+
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) {DrawPixelsW(buf, n, line, start_x);}
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) {DrawPixelsH(buf, n, row, start_y);}
+
+  protected:
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c);
+
+  private:
+    // Line ends from the object start
+    int32_t x0 = 0;
+    int32_t y0 = 0;
+    int32_t x1 = 0;
+    int32_t y1 = 0;
+    color_t color = COLOR_WHITE;
+};
+
+// *****************************************************************************
+// ***   Image Class   *********************************************************
+// *****************************************************************************
+typedef struct
+{
+  int32_t width;             // Image width
+  int32_t height;            // Image height
+  uint32_t bits_per_pixel;   // 8 for palette images, 16 for RGB565
+  union
+  {
+    const uint8_t* img8;     // Palette indexes
+    const color_t* img16;    // Colors
+  };
+  const color_t* palette;    // Palette for 8 bit images
+  int32_t transparent_color; // Transparent color or index, -1 if there is none
+} ImageDesc;
+
+class Image : public VisObject
+{
+  public:
+    void SetImage(const ImageDesc& img_dsc)
+    {
+      if(is_show) InvalidateObjArea();
+      img = &img_dsc; width = img_dsc.width; height = img_dsc.height;
+      x_end = x_start + width - 1; y_end = y_start + height - 1;
+      if(is_show) InvalidateObjArea();
+    }
+
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) {DrawPixelsW(buf, n, line, start_x);}
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) {DrawPixelsH(buf, n, row, start_y);}
+
+  protected:
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c);
+
+  private:
+    const ImageDesc* img = nullptr;
+};
+
+// *****************************************************************************
+// ***   UiButton Class   ******************************************************
+// *****************************************************************************
+// Box with one pixel border and centered text. Pressed button is darker.
+class UiButton : public VisObject
+{
+  public:
+    void SetParams(const char* s, int32_t x, int32_t y, int32_t w, int32_t h, bool is_active = false)
+    {
+      str = s; active = is_active;
+      x_start = x; y_start = y; width = w; height = h;
+      x_end = x + w - 1; y_end = y + h - 1;
+    }
+    void SetPosition(int32_t x, int32_t y, int32_t w, int32_t h)
+    {
+      if(is_show) InvalidateObjArea();
+      SetParams(str, x, y, w, h, active);
+      if(is_show) InvalidateObjArea();
+    }
+    void SetFont(Font& f) {font = &f; if(is_show) InvalidateObjArea();}
+    void SetCallback(AppTask* task, CallbackPtr func = nullptr, void* param = nullptr)
+    {
+      callback_task = task; callback_func = func; callback_param = param;
+    }
+    void SetPressed(bool is_pressed)
+    {
+      if(pressed != is_pressed) {pressed = is_pressed; if(is_show) InvalidateObjArea();}
+    }
+    bool GetPressed() {return pressed;}
+
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) {DrawPixelsW(buf, n, line, start_x);}
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0) {DrawPixelsH(buf, n, row, start_y);}
+
+  protected:
+    virtual bool GetPixel(int32_t x, int32_t y, color_t& c);
+
+  private:
+    const char* str = "";
+    Font* font = &Font_8x12::GetInstance();
+    bool pressed = false;
+    AppTask* callback_task = nullptr;
+    CallbackPtr callback_func = nullptr;
+    void* callback_param = nullptr;
+};
+
+// *****************************************************************************
+// ***   IDisplay Class   ******************************************************
+// *****************************************************************************
+class IDisplay
+{
+  public:
+    typedef enum
+    {
+      ROTATION_TOP,
+      ROTATION_LEFT,
+      ROTATION_BOTTOM,
+      ROTATION_RIGHT,
+      ROTATION_CNT
+    } Rotation;
+};
+
+// *****************************************************************************
+// ***   DisplayDrv Class   ****************************************************
+// *****************************************************************************
+// Instead of LCD it keeps frame buffer in memory. As DevCore driver, it keeps
+// one update area: every InvalidateArea() call extends it. UpdateDisplay()
+// redraws that area the same way as driver does: line by line, every object
+// draws itself into line buffer in Z order.
+class DisplayDrv
+{
+  public:
+    static DisplayDrv& GetInstance() {static DisplayDrv display_drv; return display_drv;}
+
+    int32_t GetScreenW() {return width;}
+    int32_t GetScreenH() {return height;}
+    void SetBackgroundColor(color_t c) {bg_color = c;}
+    // Frame is always rendered in portrait orientation
+    void SetRotation(IDisplay::Rotation r) {}
+    Result LockDisplay() {return Result::RESULT_OK;}
+    Result UnlockDisplay() {return Result::RESULT_OK;}
+
+    // Display list
+    void AddVisObjectToList(VisObject* obj);
+    void DelVisObjectFromList(VisObject* obj);
+    // Extend area to update
+    void InvalidateArea(int32_t xs, int32_t ys, int32_t xe, int32_t ye);
+
+    // Draw update area into frame buffer. Returns number of pixels drawn.
+    uint32_t UpdateDisplay();
+    // Draw whole frame into frame buffer using DrawInBufW() or DrawInBufH()
+    void RenderFrame(bool vertical = false);
+    // Frame buffer
+    const color_t* GetFrameBuffer() {return fb.data();}
+    // Remove all objects and update area
+    void Clear();
+
+  private:
+    typedef struct {int32_t xs; int32_t ys; int32_t xe; int32_t ye;} Area;
+
+    int32_t width = 320;
+    int32_t height = 480;
+    color_t bg_color = COLOR_BLACK;
+    std::vector<color_t> fb;
+    std::vector<VisObject*> list;
+    Area area = {0, 0, -1, -1};
+
+    void DrawArea(const Area& a);
+
+    DisplayDrv() : fb(320 * 480, COLOR_BLACK) {};
+};
+
+#endif
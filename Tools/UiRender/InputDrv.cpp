@@ -0,0 +1,102 @@
+//******************************************************************************
+//  @file InputDrv.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details InputDrv: input driver replacement for host rendering of the UI
+//           objects. There are no buttons and encoder on the host, so
+//           handlers are accepted, but never called.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "InputDrv.h"
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+InputDrv& InputDrv::GetInstance(void)
+{
+  static InputDrv input_drv;
+  return input_drv;
+}
+
+// *****************************************************************************
+// ***   Input Driver Setup   **************************************************
+// *****************************************************************************
+Result InputDrv::Setup()
+{
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Input Driver Loop   ***************************************************
+// *****************************************************************************
+Result InputDrv::Loop()
+{
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   AddButtonsCallbackHandler   *******************************************
+// *****************************************************************************
+Result InputDrv::AddButtonsCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, uint8_t mask, CallbackListEntry& cble, HandlerPriority priority)
+{
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   DeleteButtonsCallbackHandler   ****************************************
+// *****************************************************************************
+void InputDrv::DeleteButtonsCallbackHandler(CallbackListEntry& cble)
+{
+}
+
+// *****************************************************************************
+// ***   AddEncoderCallbackHandler   *******************************************
+// *****************************************************************************
+Result InputDrv::AddEncoderCallbackHandler(AppTask* callback_task, CallbackPtr callback, void* obj_ptr, CallbackListEntry& cble, HandlerPriority priority)
+{
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   DeleteEncoderCallbackHandler   ****************************************
+// *****************************************************************************
+void InputDrv::DeleteEncoderCallbackHandler(CallbackListEntry& cble)
+{
+}
+
+// *****************************************************************************
+// ***   GetButtonCurrentState   ***********************************************
+// *****************************************************************************
+bool InputDrv::GetButtonCurrentState(ButtonType button)
+{
+  return false;
+}
+
+// *****************************************************************************
+// ***   GetButtonState   ******************************************************
+// *****************************************************************************
+bool InputDrv::GetButtonState(ButtonType button)
+{
+  return false;
+}
+
+// *****************************************************************************
+// ***   GetEncoderState   *****************************************************
+// *****************************************************************************
+int32_t InputDrv::GetEncoderState(int32_t& last_enc_val)
+{
+  return 0;
+}
@@ -0,0 +1,530 @@
+//******************************************************************************
+//  @file UiRender.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details UiRender: host renderer of the UI objects. Fonts are loaded from
+//           the firmware HEX file. Every scene is drawn into in-memory frame
+//           buffer and checked three ways:
+//            - frame updated by dirty regions must be equal to full redraw
+//            - frame drawn by DrawInBufH() must be equal to DrawInBufW() one
+//            - frame must be equal to golden image saved by previous run
+//           Full redraw time printed for every scene.
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "DevCore.h"
+#include "DataWindow.h"
+#include "DirtyRegions.h"
+#include "Header.h"
+#include "Images.h"
+#include "Tabs.h"
+#include "Tetris.h"
+#include "TextBox.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Border width as in application screens
+#define BORDER_W 4
+
+// Pixel budget of dirty regions, zero - flush all regions every frame
+static uint32_t pixel_budget = 0u;
+
+// *****************************************************************************
+// ***   UI objects: layout of the DRO screen   ********************************
+// *****************************************************************************
+static DataWindow dw[3u];
+static DataWindow spindle_dw;
+static DataWindow feed_dw;
+static RleImage img[2u];
+
+// *****************************************************************************
+// ***   UI objects: layout of the G-code generator screen   *******************
+// *****************************************************************************
+static Header header;
+static Tabs tabs;
+static TextBox text_box;
+
+static const char gcode[] =
+  "; Pocket 40x20 mm, depth 1 mm\n"
+  "G21\n"
+  "G90\n"
+  "G0 Z5.000\n"
+  "G0 X0.000 Y0.000\n"
+  "M3 S12000\n"
+  "G1 Z-0.500 F100\n"
+  "G1 X40.000 Y0.000 F600\n"
+  "G1 X40.000 Y3.000\n"
+  "G1 X0.000 Y3.000\n"
+  "G1 X0.000 Y6.000\n"
+  "G1 X40.000 Y6.000\n"
+  "G1 X40.000 Y9.000\n"
+  "G1 X0.000 Y9.000\n"
+  "G1 X0.000 Y12.000\n"
+  "G1 X40.000 Y12.000\n"
+  "G1 X40.000 Y15.000\n"
+  "G1 X0.000 Y15.000\n"
+  "G1 X0.000 Y18.000\n"
+  "G1 X40.000 Y18.000\n"
+  "G1 X40.000 Y20.000\n"
+  "G1 X0.000 Y20.000\n"
+  "G1 X0.000 Y0.000\n"
+  "G1 Z-1.000 F100\n"
+  "G1 X40.000 Y0.000 F600\n"
+  "G1 X40.000 Y20.000\n"
+  "G1 X0.000 Y20.000\n"
+  "G1 X0.000 Y0.000\n"
+  "G0 Z5.000\n"
+  "M5\n"
+  "M30\n";
+
+// *****************************************************************************
+// ***   UI objects: Tetris game   *********************************************
+// *****************************************************************************
+static TetrisBucket bucket;
+static TetrisShape shape;
+static TetrisShape next_shape;
+// Shape is falling
+static bool tetris_round = false;
+// Score string
+static char score_buf[32] = {" "};
+static String score_str;
+
+// *****************************************************************************
+// ***   Random numbers: the same on every host   ******************************
+// *****************************************************************************
+static uint32_t Random()
+{
+  static uint32_t x = 2463534242u;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+// *****************************************************************************
+// ***   Setup   ***************************************************************
+// *****************************************************************************
+static void Setup()
+{
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  int32_t window_height = Font_8x12::GetInstance().GetCharH() * 5;
+  int32_t start_y = 48;
+
+  // Budget from command line
+  DirtyRegions::GetInstance().Setup();
+  DirtyRegions::GetInstance().SetPixelBudget(pixel_budget);
+
+  // Header images
+  img[0u].SetImage(MPG);
+  img[0u].Move(BORDER_W, BORDER_W);
+  img[0u].Show(10u);
+  img[1u].SetImage(RotaryTable);
+  img[1u].Move(display_drv.GetScreenW() - RotaryTable.width - BORDER_W, BORDER_W);
+  img[1u].Show(10u);
+
+  // Axis windows, the same as on DirectControlScr
+  for(uint32_t i = 0u; i < NumberOf(dw); i++)
+  {
+    dw[i].SetParams(display_drv.GetScreenW() / 6, start_y + (window_height + BORDER_W*2) * i, (display_drv.GetScreenW() - BORDER_W*2) * 4 / 6,  window_height, 8u, 3u);
+    dw[i].SetBorder(BORDER_W, COLOR_RED);
+    dw[i].SetDataFont(Font_8x12::GetInstance(), 2u);
+    dw[i].SetNumber(0);
+    dw[i].SetUnits("mm", DataWindow::RIGHT);
+    dw[i].Show(100u);
+  }
+
+  // Spindle speed
+  spindle_dw.SetParams(BORDER_W, dw[2u].GetEndY() + BORDER_W*2, display_drv.GetScreenW() / 2 - BORDER_W * 3 / 2,  window_height, 5u, 0);
+  spindle_dw.SetBorder(BORDER_W, COLOR_RED);
+  spindle_dw.SetDataFont(Font_8x12::GetInstance(), 2u);
+  spindle_dw.SetLimits(0, 24000);
+  spindle_dw.SetNumber(1000);
+  spindle_dw.SetUnits("RPM", DataWindow::RIGHT);
+  spindle_dw.SetSelected(true);
+  spindle_dw.Show(100u);
+
+  // Feed with small font, as on DelayControlScr
+  feed_dw.SetParams(spindle_dw.GetEndX() + BORDER_W*2, spindle_dw.GetStartY(), display_drv.GetScreenW() / 2 - BORDER_W * 3 / 2,  window_height, 5u, 1u);
+  feed_dw.SetBorder(BORDER_W, COLOR_BLUE);
+  feed_dw.SetDataFont(Font_8x12::GetInstance());
+  feed_dw.SetNumber(0);
+  feed_dw.SetUnits("mm/min", DataWindow::BOTTOM_RIGHT, Font_6x8::GetInstance());
+  feed_dw.Show(100u);
+}
+
+// *****************************************************************************
+// ***   Setup of G-code generator screen, as in application   ***************
+// *****************************************************************************
+static void SetupGCode()
+{
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+
+  // Hide DRO screen
+  for(uint32_t i = 0u; i < NumberOf(dw); i++) dw[i].Hide();
+  spindle_dw.Hide();
+  feed_dw.Hide();
+  img[0u].Hide();
+  img[1u].Hide();
+
+  // Header, as Application::InitHeader() does
+  header.SetParams(0, 0, display_drv.GetScreenW(), 40, 3u);
+  header.SetText(0u, "MPG", Font_12x16::GetInstance());
+  header.SetImage(0u, MPG);
+  header.SetText(1u, "GCODE SENDER", Font_12x16::GetInstance());
+  header.SetText(2u, "GCODE GENERATOR", Font_12x16::GetInstance());
+  header.ResizeButtons();
+  header.Show(2000u);
+
+  // Tabs, as GCodeGeneratorScr::Setup() does
+  tabs.SetParams(0, header.GetHeight(), display_drv.GetScreenW(), 40, 3u);
+  tabs.SetText(0u, "----", nullptr, Font_10x18::GetInstance());
+  tabs.SetText(1u, "Scripts", nullptr, Font_10x18::GetInstance());
+  tabs.SetText(2u, "Preview", nullptr, Font_10x18::GetInstance());
+  tabs.Show(2000u);
+
+  // Preview text
+  text_box.Setup(0, header.GetHeight() + tabs.GetHeight(), display_drv.GetScreenW(), display_drv.GetScreenH() - header.GetHeight() - tabs.GetHeight() - BORDER_W * 2);
+  text_box.SetText(gcode);
+  text_box.Show(100u);
+}
+
+// *****************************************************************************
+// ***   Setup of Tetris game, as Tetris::Loop() does   ************************
+// *****************************************************************************
+static void SetupTetris()
+{
+  // Hide G-code generator screen
+  header.Enable();
+  header.Hide();
+  tabs.Enable();
+  tabs.Hide();
+  text_box.Hide();
+
+  bucket.Show(1u);
+  shape.Show(2u);
+  next_shape.Show(3u);
+  score_str.SetParams(score_buf, (WIDTH + 1) * CUBE_SIZE, 16, COLOR_WHITE, Font_8x12::GetInstance());
+  score_str.Show(3u);
+}
+
+// *****************************************************************************
+// ***   Tetris game step: random player input and one fall   ******************
+// *****************************************************************************
+// Step is a frame of Tetris::Loop() where shape falls down. Player moves or
+// rotates shape before it.
+static void TetrisStep(uint32_t i)
+{
+  // Previous shape landed - next one
+  if(!tetris_round)
+  {
+    bucket.RemoveFullLines();
+    shape.PopulateShapeArray(next_shape);
+    next_shape.PopulateShapeArray(Random() % 7u, 1u + Random() % 5u);
+    next_shape.MoveShape(WIDTH + 2, 5);
+    // Game over - start new game
+    if(bucket.CheckShapeCollisionIntoBucket(shape))
+    {
+      bucket.InitBucket();
+      bucket.InvalidateObjArea();
+    }
+    tetris_round = true;
+  }
+
+  // Player: move by encoder, rotate by buttons or do nothing
+  uint32_t action = Random() % 4u;
+  if(action == 0u)
+  {
+    int8_t dir = (Random() & 1u) ? 1 : -1;
+    for(uint32_t n = Random() % 3u; n > 0u; n--)
+    {
+      shape.MoveShape(dir, 0, true);
+      if(bucket.CheckShapeCollisionIntoBucket(shape))
+      {
+        shape.MoveShape(-dir, 0, true);
+        break;
+      }
+    }
+  }
+  else if(action == 1u)
+  {
+    int8_t rot = (Random() & 1u) ? 1 : -1;
+    shape.RotateShape(rot);
+    if(bucket.CheckShapeCollisionIntoBucket(shape)) shape.RotateShape(-rot);
+  }
+  else
+  {
+    ; // Do nothing - MISRA rule
+  }
+
+  // Fall down
+  shape.MoveShape(0, 1, true);
+  if(bucket.CheckShapeCollisionIntoBucket(shape))
+  {
+    shape.MoveShape(0, -1, true);
+    bucket.PutShapeIntoBucket(shape);
+    tetris_round = false;
+  }
+  score_str.SetString(score_buf, NumberOf(score_buf), "Score: %lu", (unsigned long)bucket.GetScore());
+}
+
+// *****************************************************************************
+// ***   Scenes: every scene changes objects, frame is checked after it   *****
+// *****************************************************************************
+typedef struct
+{
+  const char* name;
+  void (*setup)();
+  uint32_t steps;
+  void (*step)(uint32_t i);
+  // Objects implement DrawInBufW() only(Tetris runs rotated), skip DrawInBufH() check
+  bool only_w;
+} Scene;
+
+static const Scene scenes[] =
+{
+  {"dro_idle", Setup, 1u, [](uint32_t i) {}},
+  {"dro_jog", nullptr, 200u, [](uint32_t i) {dw[0u].SetNumber(dw[0u].GetNumber() + 7); dw[1u].SetNumber(dw[1u].GetNumber() - 123); feed_dw.SetNumber(i * 5);}},
+  {"dro_negative", nullptr, 50u, [](uint32_t i) {dw[2u].SetNumber(-(int32_t)i * 20); spindle_dw.SetNumber(24000 - i * 480);}},
+  {"dro_select", nullptr, 4u, [](uint32_t i) {spindle_dw.SetSelected(i & 1u); dw[i % 3u].SetSelected(true);}},
+  {"dro_limits", nullptr, 2u, [](uint32_t i) {spindle_dw.SetNumber(i ? 99999 : -5); dw[0u].SetNumber(i ? -99999999 : 99999999);}},
+  {"img_clip", nullptr, 1u, [](uint32_t i) {img[0u].Move(-13, -9); img[1u].Move(DisplayDrv::GetInstance().GetScreenW() - 17, 30);}},
+  {"gcode_idle", SetupGCode, 1u, [](uint32_t i) {}},
+  {"gcode_select", nullptr, 30u, [](uint32_t i) {text_box.Select(i);}},
+  {"gcode_scroll", nullptr, 12u, [](uint32_t i) {text_box.Scroll(text_box.GetScroll() - 1);}},
+  {"tabs_select", nullptr, 2u, [](uint32_t i) {tabs.SetSelectedTab(2u - i);}},
+  {"header_page", nullptr, 2u, [](uint32_t i) {header.SetSelectedPage(i + 1u);}},
+  {"header_menu", nullptr, 1u, [](uint32_t i) {header.Action(VisObject::ACT_UNTOUCH, header.GetWidth() / 2, header.GetHeight() / 2, 0, 0);}},
+  {"header_close", nullptr, 1u, [](uint32_t i) {header.Action(VisObject::ACT_UNTOUCH, header.GetWidth() / 2, header.GetHeight() / 2, 0, 0);}},
+  {"disabled", nullptr, 1u, [](uint32_t i) {header.Disable(); tabs.Disable();}},
+  {"tetris", SetupTetris, 20000u, TetrisStep, true},
+};
+
+// *****************************************************************************
+// ***   PPM files   ***********************************************************
+// *****************************************************************************
+static bool SavePpm(const std::string& fn, const color_t* fb, int32_t w, int32_t h)
+{
+  bool result = false;
+  FILE* f = fopen(fn.c_str(), "wb");
+  if(f != nullptr)
+  {
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    for(int32_t i = 0; i < w * h; i++)
+    {
+      uint8_t rgb[3] = {(uint8_t)((fb[i] >> 11) * 255 / 31), (uint8_t)(((fb[i] >> 5) & 0x3F) * 255 / 63), (uint8_t)((fb[i] & 0x1F) * 255 / 31)};
+      fwrite(rgb, 1u, sizeof(rgb), f);
+    }
+    result = (fclose(f) == 0);
+  }
+  return result;
+}
+
+static bool LoadPpm(const std::string& fn, std::vector<uint8_t>& rgb, int32_t w, int32_t h)
+{
+  bool result = false;
+  FILE* f = fopen(fn.c_str(), "rb");
+  if(f != nullptr)
+  {
+    int32_t fw = 0;
+    int32_t fh = 0;
+    int32_t max = 0;
+    if((fscanf(f, "P6 %d %d %d", &fw, &fh, &max) == 3) && (fw == w) && (fh == h) && (max == 255) && (fgetc(f) != EOF))
+    {
+      rgb.resize(w * h * 3);
+      result = (fread(rgb.data(), 1u, rgb.size(), f) == rgb.size());
+    }
+    fclose(f);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Count different pixels   **********************************************
+// *****************************************************************************
+static uint32_t Diff(const std::vector<color_t>& a, const color_t* b, int32_t& first)
+{
+  uint32_t cnt = 0u;
+  first = -1;
+  for(size_t i = 0u; i < a.size(); i++)
+  {
+    if(a[i] != b[i])
+    {
+      if(first < 0) first = (int32_t)i;
+      cnt++;
+    }
+  }
+  return cnt;
+}
+
+// *****************************************************************************
+// ***   Usage   ***************************************************************
+// *****************************************************************************
+static void Usage()
+{
+  fprintf(stderr, "Usage: uirender [-r hex] [-s dir] [-c dir] [-n runs] [-b pixels]\n"
+                  "  -r hex   firmware HEX file to load fonts from, default is\n"
+                  "           " FIRMWARE_HEX "\n"
+                  "  -s dir   save frames of all scenes as PPM golden images\n"
+                  "  -c dir   compare frames with golden images pixel by pixel\n"
+                  "  -n runs  number of full redraws to measure time, default 20\n"
+                  "  -b pixels  dirty regions pixel budget per frame, default 0 - no limit\n");
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  bool result = true;
+  const char* hex_file = FIRMWARE_HEX;
+  const char* save_dir = nullptr;
+  const char* compare_dir = nullptr;
+  uint32_t runs = 20u;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if((i + 1 < argc) && (strcmp(argv[i], "-r") == 0)) hex_file = argv[++i];
+    else if((i + 1 < argc) && (strcmp(argv[i], "-s") == 0)) save_dir = argv[++i];
+    else if((i + 1 < argc) && (strcmp(argv[i], "-c") == 0)) compare_dir = argv[++i];
+    else if((i + 1 < argc) && (strcmp(argv[i], "-n") == 0)) runs = strtoul(argv[++i], nullptr, 0) ? strtoul(argv[i], nullptr, 0) : 1u;
+    else if((i + 1 < argc) && (strcmp(argv[i], "-b") == 0)) pixel_budget = strtoul(argv[++i], nullptr, 0);
+    else
+    {
+      Usage();
+      return 1;
+    }
+  }
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  DirtyRegions& dirty_regions = DirtyRegions::GetInstance();
+  int32_t w = display_drv.GetScreenW();
+  int32_t h = display_drv.GetScreenH();
+  std::vector<color_t> partial(w * h);
+  std::vector<color_t> full(w * h);
+
+  // Golden images are made with fonts of the device
+  if(!LoadFirmwareFonts(hex_file))
+  {
+    fprintf(stderr, "Can't load fonts from %s\n", hex_file);
+    return 1;
+  }
+
+  printf("%-14s %10s %10s %10s %s\n", "scene", "W, ms", "H, ms", "px/step", "result");
+  for(uint32_t s = 0u; s < NumberOf(scenes); s++)
+  {
+    const Scene& scene = scenes[s];
+    std::string status;
+    int32_t first = -1;
+    uint64_t pixels = 0u;
+
+    if(scene.setup != nullptr) scene.setup();
+
+    // Every step updates only dirty regions, as application task does. Frames
+    // with deferred regions follow until all of them are flushed. After that
+    // frame must be equal to the full redraw.
+    for(uint32_t i = 0u; (i < scene.steps) && status.empty(); i++)
+    {
+      scene.step(i);
+      do
+      {
+        dirty_regions.StartFrame();
+        dirty_regions.EndFrame();
+        pixels += dirty_regions.GetFramePixels();
+      }
+      while(dirty_regions.GetDeferredPixels() != 0u);
+      partial.assign(display_drv.GetFrameBuffer(), display_drv.GetFrameBuffer() + w * h);
+      display_drv.RenderFrame(false);
+      full.assign(display_drv.GetFrameBuffer(), display_drv.GetFrameBuffer() + w * h);
+      uint32_t cnt = Diff(full, partial.data(), first);
+      if(cnt != 0u)
+      {
+        status = "dirty regions missed " + std::to_string(cnt) + " px at step " + std::to_string(i) + ", first at " +
+                 std::to_string(first % w) + "," + std::to_string(first / w);
+      }
+    }
+
+    // Measure full redraw time with both draw functions
+    auto t0 = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < runs; i++) display_drv.RenderFrame(false);
+    auto t1 = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < runs; i++) display_drv.RenderFrame(true);
+    auto t2 = std::chrono::steady_clock::now();
+    double w_ms = std::chrono::duration<double, std::milli>(t1 - t0).count() / runs;
+    double h_ms = std::chrono::duration<double, std::milli>(t2 - t1).count() / runs;
+
+    // Vertical drawing must give the same frame
+    if(status.empty() && !scene.only_w)
+    {
+      uint32_t cnt = Diff(full, display_drv.GetFrameBuffer(), first);
+      if(cnt != 0u)
+      {
+        status = "DrawInBufH() differs in " + std::to_string(cnt) + " px, first at " + std::to_string(first % w) + "," + std::to_string(first / w);
+      }
+    }
+
+    // Save golden image
+    std::string fn = std::string(scene.name) + ".ppm";
+    if(save_dir != nullptr)
+    {
+      if(!SavePpm(std::string(save_dir) + "/" + fn, full.data(), w, h)) status += "can't save " + fn;
+    }
+    // Compare with golden image
+    if(compare_dir != nullptr)
+    {
+      std::vector<uint8_t> rgb;
+      if(!LoadPpm(std::string(compare_dir) + "/" + fn, rgb, w, h))
+      {
+        status += "can't load " + fn;
+      }
+      else
+      {
+        // Convert current frame the same way it was saved
+        std::string tmp_fn = std::string(compare_dir) + "/" + scene.name + ".new.ppm";
+        std::vector<uint8_t> cur;
+        SavePpm(tmp_fn, full.data(), w, h);
+        LoadPpm(tmp_fn, cur, w, h);
+        uint32_t cnt = 0u;
+        for(size_t i = 0u; i < rgb.size(); i += 3u)
+        {
+          if(memcmp(&rgb[i], &cur[i], 3u) != 0)
+          {
+            if(cnt == 0u) first = (int32_t)(i / 3u);
+            cnt++;
+          }
+        }
+        if(cnt != 0u)
+        {
+          status += "differs from golden in " + std::to_string(cnt) + " px, first at " + std::to_string(first % w) + "," +
+                    std::to_string(first / w) + ", see " + tmp_fn;
+        }
+        else
+        {
+          remove(tmp_fn.c_str());
+        }
+      }
+    }
+
+    printf("%-14s %10.3f %10.3f %10llu %s\n", scene.name, w_ms, h_ms, (unsigned long long)(pixels / scene.steps), status.empty() ? "OK" : status.c_str());
+    if(!status.empty()) result = false;
+  }
+
+  return result ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+//******************************************************************************
+//  @file semphr.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: FreeRTOS semaphore type replacement for host rendering of
+//           the UI objects
+//
+//  @copyright Copyright (c) 2025, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef semphr_h
+#define semphr_h
+
+// *****************************************************************************
+// ***   Types   ***************************************************************
+// *****************************************************************************
+typedef void* SemaphoreHandle_t;
+
+#endif